@@ -0,0 +1,1021 @@
+#define _POSIX_C_SOURCE 200809L
+#include <silk.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <malloc.h>
+#include <unistd.h>
+
+#include "parser.h"
+#include "emit.h"
+#include "optimizer.h"
+#include "bytecode.h"
+#include "jit.h"
+#include "cache.h"
+
+#ifndef BENCH_VARIANT
+#define BENCH_VARIANT "default"
+#endif
+
+// Linked with -Wl,--wrap so every heap allocation made by the
+// interpreter goes through these counters. heap_peak is the high-water
+// mark of live heap bytes since the last reset_peak(). The interpreter
+// allocates from several threads at once, so updates are atomic.
+static size_t n_allocs;
+static size_t heap_bytes;
+static size_t heap_peak;
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void __real_free(void* ptr);
+
+static inline void* track(void* ptr) {
+	if(ptr) {
+		size_t bytes = __atomic_add_fetch(&heap_bytes, malloc_usable_size(ptr), __ATOMIC_RELAXED);
+		size_t peak = __atomic_load_n(&heap_peak, __ATOMIC_RELAXED);
+		while(bytes > peak &&
+			!__atomic_compare_exchange_n(&heap_peak, &peak, bytes, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+			;
+	}
+	return ptr;
+}
+
+void* __wrap_malloc(size_t size) {
+	__atomic_add_fetch(&n_allocs, 1, __ATOMIC_RELAXED);
+	return track(__real_malloc(size));
+}
+
+void* __wrap_calloc(size_t n, size_t size) {
+	__atomic_add_fetch(&n_allocs, 1, __ATOMIC_RELAXED);
+	return track(__real_calloc(n, size));
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+	__atomic_add_fetch(&n_allocs, 1, __ATOMIC_RELAXED);
+	size_t old_size = ptr ? malloc_usable_size(ptr) : 0;
+	void* new = __real_realloc(ptr, size);
+	if(!new && size)
+		return NULL;
+	__atomic_sub_fetch(&heap_bytes, old_size, __ATOMIC_RELAXED);
+	return track(new);
+}
+
+void __wrap_free(void* ptr) {
+	if(ptr)
+		__atomic_sub_fetch(&heap_bytes, malloc_usable_size(ptr), __ATOMIC_RELAXED);
+	__real_free(ptr);
+}
+
+static inline size_t reset_peak(void) {
+	size_t bytes = __atomic_load_n(&heap_bytes, __ATOMIC_RELAXED);
+	__atomic_store_n(&heap_peak, bytes, __ATOMIC_RELAXED);
+	return bytes;
+}
+
+static double now_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static int cmp_double(const void* a, const void* b) {
+	double lhs = *(const double*) a;
+	double rhs = *(const double*) b;
+	return (lhs > rhs) - (lhs < rhs);
+}
+
+// Sorts the samples and picks out the median and the 99th percentile
+static void summarize(double* times, int runs, double* median, double* p99) {
+	qsort(times, runs, sizeof(double), cmp_double);
+	*median = times[runs / 2];
+	*p99 = times[(runs * 99 + 99) / 100 - 1];
+}
+
+// One CSV row per measurement, so results can be diffed between builds.
+// Throughput is source bytes over the median time.
+static void print_row(const char* filename, size_t size, const char* mode, const char* phase,
+	double* times, int runs, size_t allocs, size_t peak) {
+	double median;
+	double p99;
+	summarize(times, runs, &median, &p99);
+	printf("%s,%s,%s,%s,%d,%.4f,%.4f,%.4f,%.1f,%zu,%zu\n", BENCH_VARIANT, filename, mode, phase,
+		runs, median, p99, times[0], size / 1e3 / median, allocs, peak / 1024);
+}
+
+static char* read_file(const char* filename, size_t* size) {
+	FILE* file = fopen(filename, "rb");
+	if(!file)
+		return NULL;
+	fseek(file, 0, SEEK_END);
+	*size = ftell(file);
+	rewind(file);
+	char* data = malloc(*size);
+	if(data && fread(data, 1, *size, file) != *size) {
+		free(data);
+		data = NULL;
+	}
+	fclose(file);
+	return data;
+}
+
+typedef enum {
+	MODE_INST,
+	MODE_PACKED,
+	MODE_JIT,
+	// Only run end to end, as they compile while running or don't
+	// compile at all
+	MODE_LAZY,
+	MODE_CACHED
+} Mode;
+
+static const char* mode_names[] = { "inst", "packed", "jit", "lazy", "cached" };
+
+// Sized the same way silk_run sizes its VM, with ctx's budget
+static int init_vm(VM* vm, const Silk_Ctx* ctx, Vector_FunctionInfo* funcs) {
+	vm_init(vm);
+	if(vm_reserve(vm, ctx, funcs->data[0].max_stack, funcs->data[0].n_locals)) {
+		vm_deinit(vm);
+		return 1;
+	}
+	return 0;
+}
+
+// Runs one execution mode on a fresh VM and hands back a copy of the
+// final operand stack. Returns what the mode returned.
+static int run_mode(Mode mode, const Silk_Ctx* ctx, Vector_Instruction* insts,
+	Vector_FunctionInfo* funcs, PackedCode* packed, int64_t** stack, size_t* stack_size) {
+	VM vm;
+	if(init_vm(&vm, ctx, funcs))
+		return 1;
+
+	int failed = 1;
+	JitCode jit;
+	switch(mode) {
+		case MODE_INST:
+			failed = vm_run(&vm, insts->data, insts->size, funcs->data, funcs->size);
+			break;
+		case MODE_PACKED:
+			failed = vm_run_packed(&vm, packed, funcs->data, funcs->size);
+			break;
+		case MODE_JIT:
+			if(jit_compile(&jit, insts->data, insts->size, funcs->data, funcs->size))
+				break;
+			failed = jit_run(&jit, &vm, funcs->data, funcs->size);
+			jit_free(&jit);
+			break;
+		case MODE_LAZY:
+		case MODE_CACHED:
+			assert(0);
+			break;
+	}
+	if(!failed) {
+		*stack_size = vm.operand_stack.sp;
+		*stack = malloc(sizeof(int64_t) * (*stack_size + 1));
+		failed = !*stack;
+		if(!failed)
+			memcpy(*stack, vm.operand_stack.data, sizeof(int64_t) * *stack_size);
+	}
+	vm_deinit(&vm);
+	return failed;
+}
+
+static int same_code(Vector_Instruction* insts, Vector_FunctionInfo* funcs,
+	Vector_Instruction* other_insts, Vector_FunctionInfo* other_funcs) {
+	if(other_insts->size != insts->size || other_funcs->size != funcs->size)
+		return 0;
+	for(size_t i = 0; i < insts->size; ++i)
+		if(other_insts->data[i].type != insts->data[i].type ||
+			other_insts->data[i].val != insts->data[i].val)
+			return 0;
+	return !memcmp(other_funcs->data, funcs->data, sizeof(FunctionInfo) * funcs->size);
+}
+
+// Checks that the single-pass front end emits exactly what the tree
+// walk does, before the peephole pass touches either
+static int check_single_pass(const char* filename, const char* data, size_t size,
+	Vector_Instruction* insts, Vector_FunctionInfo* funcs) {
+	Silk_Ctx ctx;
+	silk_ctx_init(&ctx);
+	Lexer lexer;
+	Parser parser;
+	lexer_init(&lexer, &ctx, data, data + size);
+	parser_init(&parser, &lexer);
+	Vector_Instruction direct_insts;
+	vector_Instruction_ainit(&direct_insts, 64);
+	Vector_FunctionInfo direct_funcs;
+	vector_FunctionInfo_ainit(&direct_funcs, 16);
+
+	size_t n_folded;
+	int ret = emit_program(&parser, &direct_insts, &direct_funcs, &n_folded);
+	if(ret)
+		fprintf(stderr, "%-8s %-32s single-pass failed to compile\n", BENCH_VARIANT, filename);
+	else if(!same_code(insts, funcs, &direct_insts, &direct_funcs)) {
+		fprintf(stderr, "%-8s %-32s single-pass bytecode differs from ast\n", BENCH_VARIANT, filename);
+		ret = 1;
+	}
+
+	vector_deinit(&direct_insts);
+	vector_deinit(&direct_funcs);
+	parser_deinit(&parser);
+	lexer_deinit(&lexer);
+	silk_ctx_deinit(&ctx);
+	return ret;
+}
+
+// Checks that compiling function bodies on several threads gives the
+// same code as compiling them on one
+static int check_parallel(const char* filename, ASTNode* root, size_t n_symbols,
+	Vector_Instruction* insts, Vector_FunctionInfo* funcs) {
+	Silk_Ctx ctx;
+	silk_ctx_init(&ctx);
+	ctx.compile_threads = 4;
+	Vector_Instruction parallel_insts;
+	vector_Instruction_ainit(&parallel_insts, 64);
+	Vector_FunctionInfo parallel_funcs;
+	vector_FunctionInfo_ainit(&parallel_funcs, 16);
+
+	int ret = ast_compile(&ctx, &parallel_insts, &parallel_funcs, root, n_symbols);
+	if(ret)
+		fprintf(stderr, "%-8s %-32s parallel compile failed\n", BENCH_VARIANT, filename);
+	else if(!same_code(insts, funcs, &parallel_insts, &parallel_funcs)) {
+		fprintf(stderr, "%-8s %-32s parallel bytecode differs from serial\n", BENCH_VARIANT, filename);
+		ret = 1;
+	}
+
+	vector_deinit(&parallel_insts);
+	vector_deinit(&parallel_funcs);
+	silk_ctx_deinit(&ctx);
+	return ret;
+}
+
+// Compiles the file like silk_run does, reports the size of the
+// instruction stream both as Instruction structs and packed, and checks
+// that every execution mode leaves the same operand stack behind.
+static int inspect_file(const char* filename) {
+	size_t size;
+	char* data = read_file(filename, &size);
+	if(!data)
+		return 1;
+
+	Silk_Ctx ctx;
+	silk_ctx_init(&ctx);
+	ctx.compile_threads = 1;
+	Lexer lexer;
+	Parser parser;
+	lexer_init(&lexer, &ctx, data, data + size);
+	parser_init(&parser, &lexer);
+	ASTNode* root = parser_parse(&parser);
+	if(!root) {
+		parser_deinit(&parser);
+		lexer_deinit(&lexer);
+		free(data);
+		return 1;
+	}
+	ast_fold_constants(root, lexer.symbols.size);
+
+	int ret = 1;
+	Vector_Instruction insts;
+	vector_Instruction_ainit(&insts, 64);
+	Vector_FunctionInfo funcs;
+	vector_FunctionInfo_ainit(&funcs, 16);
+	PackedCode packed = { 0 };
+	if(ast_compile(&ctx, &insts, &funcs, root, lexer.symbols.size))
+		goto quit;
+	int single_pass_differs = check_single_pass(filename, data, size, &insts, &funcs);
+	int parallel_differs = check_parallel(filename, root, lexer.symbols.size, &insts, &funcs);
+	optimizer_run(&insts, &funcs);
+	if(bytecode_pack(&packed, insts.data, insts.size, funcs.data, funcs.size))
+		goto quit;
+	fprintf(stderr, "%-8s %-32s code size %zu bytes as Instruction, %zu bytes packed (%.1f%%)\n",
+		BENCH_VARIANT, filename, insts.size * sizeof(Instruction), packed.size,
+		100.0 * packed.size / (insts.size * sizeof(Instruction)));
+
+	int64_t* expected;
+	size_t expected_size;
+	if(run_mode(MODE_INST, &ctx, &insts, &funcs, &packed, &expected, &expected_size))
+		goto quit;
+	ret = 0;
+	for(Mode mode = MODE_PACKED; mode <= MODE_JIT; ++mode) {
+		int64_t* stack;
+		size_t stack_size;
+		if(run_mode(mode, &ctx, &insts, &funcs, &packed, &stack, &stack_size)) {
+			fprintf(stderr, "%-8s %-32s %s failed to run\n", BENCH_VARIANT, filename, mode_names[mode]);
+			ret = 1;
+			continue;
+		}
+		if(stack_size != expected_size || memcmp(stack, expected, sizeof(int64_t) * stack_size)) {
+			fprintf(stderr, "%-8s %-32s %s result differs from inst\n", BENCH_VARIANT, filename, mode_names[mode]);
+			ret = 1;
+		}
+		free(stack);
+	}
+	free(expected);
+	if(single_pass_differs || parallel_differs)
+		ret = 1;
+
+quit:
+	bytecode_deinit(&packed);
+	vector_deinit(&insts);
+	vector_deinit(&funcs);
+	parser_deinit(&parser);
+	lexer_deinit(&lexer);
+	silk_ctx_deinit(&ctx);
+	free(data);
+	return ret;
+}
+
+// Recursion with no way out, which every mode has to stop with a stack
+// overflow however deep the budget goes. The JIT's calls also take
+// machine stack, more than a thread has at the deeper budgets.
+static const char overflow_script[] = "f();\nfunction f() {\n\treturn f() + 1;\n}\n";
+static const size_t overflow_depths[] = { 1000, 1000000, 4000000 };
+
+static int check_overflow(void) {
+	Silk_Ctx ctx;
+	silk_ctx_init(&ctx);
+	ctx.filename = "(overflow)";
+	Lexer lexer;
+	Parser parser;
+	lexer_init(&lexer, &ctx, overflow_script, overflow_script + sizeof(overflow_script) - 1);
+	parser_init(&parser, &lexer);
+	ASTNode* root = parser_parse(&parser);
+
+	int ret = 1;
+	Vector_Instruction insts;
+	vector_Instruction_ainit(&insts, 64);
+	Vector_FunctionInfo funcs;
+	vector_FunctionInfo_ainit(&funcs, 16);
+	PackedCode packed = { 0 };
+	if(!root || ast_compile(&ctx, &insts, &funcs, root, lexer.symbols.size))
+		goto quit;
+	optimizer_run(&insts, &funcs);
+	if(bytecode_pack(&packed, insts.data, insts.size, funcs.data, funcs.size))
+		goto quit;
+
+	ret = 0;
+	for(size_t i = 0; i < sizeof(overflow_depths) / sizeof(overflow_depths[0]); ++i) {
+		ctx.call_depth = overflow_depths[i];
+		for(Mode mode = MODE_INST; mode <= MODE_JIT; ++mode) {
+			int64_t* stack;
+			size_t stack_size;
+			int failed = run_mode(mode, &ctx, &insts, &funcs, &packed, &stack, &stack_size);
+			if(!failed)
+				free(stack);
+			if(failed != VM_STACK_OVERFLOW) {
+				fprintf(stderr, "%-8s %-32s %s failed to overflow at depth %zu\n", BENCH_VARIANT,
+					ctx.filename, mode_names[mode], overflow_depths[i]);
+				ret = 1;
+			}
+		}
+	}
+
+quit:
+	bytecode_deinit(&packed);
+	vector_deinit(&insts);
+	vector_deinit(&funcs);
+	parser_deinit(&parser);
+	lexer_deinit(&lexer);
+	silk_ctx_deinit(&ctx);
+	return ret;
+}
+
+typedef enum {
+	PHASE_LEX,
+	PHASE_PARSE,
+	PHASE_FOLD,
+	PHASE_COMPILE,
+	PHASE_COMPILE_SERIAL,
+	PHASE_OPTIMIZE,
+	PHASE_RUN,
+	N_PHASES
+} Phase;
+
+static const char* phase_names[] = { "lex", "parse", "fold", "compile", "compile1", "optimize", "run" };
+
+static int lex_pass(Silk_Ctx* ctx, const char* data, size_t size) {
+	Lexer lexer;
+	Token tok;
+	if(lexer_init(&lexer, ctx, data, data + size))
+		return 1;
+	int ret = 0;
+	do {
+		if(lexer_next(&lexer, &tok)) {
+			ret = 1;
+			break;
+		}
+	} while(tok.type != TOKEN_EOF);
+	lexer_deinit(&lexer);
+	return ret;
+}
+
+// Lexer throughput on its own, for -l
+static int lex_file(const char* filename, int runs, double* times) {
+	size_t size;
+	char* data = read_file(filename, &size);
+	if(!data)
+		return 1;
+
+	Silk_Ctx ctx;
+	silk_ctx_init(&ctx);
+	int ret = 0;
+	for(int run = 0; run < runs && !ret; ++run) {
+		double start = now_ms();
+		ret = lex_pass(&ctx, data, size);
+		times[run] = now_ms() - start;
+	}
+	if(!ret)
+		print_row(filename, size, "lexer", "lex", times, runs, 0, 0);
+	silk_ctx_deinit(&ctx);
+	free(data);
+	return ret;
+}
+
+// Times every stage of silk_run on its own. The parser pulls tokens on
+// demand, so "lex" is a separate token-only pass over the source and
+// "parse" includes lexing.
+static int phase_file(const char* filename, int runs, double* times[N_PHASES]) {
+	size_t size;
+	char* data = read_file(filename, &size);
+	if(!data)
+		return 1;
+
+	size_t allocs[N_PHASES] = { 0 };
+	size_t peaks[N_PHASES] = { 0 };
+	int ret = 1;
+	for(int run = 0; run < runs; ++run) {
+		Silk_Ctx ctx;
+		silk_ctx_init(&ctx);
+		Lexer lexer;
+		size_t allocs_before;
+		size_t bytes_before;
+		double start;
+
+#define PHASE(phase, ...) \
+	do { \
+		allocs_before = n_allocs; \
+		bytes_before = reset_peak(); \
+		start = now_ms(); \
+		__VA_ARGS__; \
+		times[phase][run] = now_ms() - start; \
+		allocs[phase] = n_allocs - allocs_before; \
+		peaks[phase] = heap_peak - bytes_before; \
+	} while(0)
+
+		int failed;
+		PHASE(PHASE_LEX, failed = lex_pass(&ctx, data, size));
+		if(failed)
+			goto quit;
+
+		Parser parser;
+		ASTNode* root;
+		PHASE(PHASE_PARSE,
+			lexer_init(&lexer, &ctx, data, data + size);
+			parser_init(&parser, &lexer);
+			root = parser_parse(&parser));
+		if(!root) {
+			parser_deinit(&parser);
+			lexer_deinit(&lexer);
+			goto quit;
+		}
+		PHASE(PHASE_FOLD, ast_fold_constants(root, lexer.symbols.size));
+
+		Vector_Instruction insts;
+		vector_Instruction_ainit(&insts, 64);
+		Vector_FunctionInfo funcs;
+		vector_FunctionInfo_ainit(&funcs, 16);
+		PHASE(PHASE_COMPILE, failed = ast_compile(&ctx, &insts, &funcs, root, lexer.symbols.size));
+		if(!failed) {
+			// The same on a single thread, for comparison
+			Silk_Ctx serial = ctx;
+			serial.compile_threads = 1;
+			Vector_Instruction serial_insts;
+			vector_Instruction_ainit(&serial_insts, 64);
+			Vector_FunctionInfo serial_funcs;
+			vector_FunctionInfo_ainit(&serial_funcs, 16);
+			PHASE(PHASE_COMPILE_SERIAL,
+				failed = ast_compile(&serial, &serial_insts, &serial_funcs, root, lexer.symbols.size));
+			vector_deinit(&serial_insts);
+			vector_deinit(&serial_funcs);
+		}
+		if(!failed) {
+			PHASE(PHASE_OPTIMIZE, optimizer_run(&insts, &funcs));
+			VM vm;
+			failed = init_vm(&vm, &ctx, &funcs);
+			if(!failed) {
+				PHASE(PHASE_RUN, failed = vm_run(&vm, insts.data, insts.size, funcs.data, funcs.size));
+				vm_deinit(&vm);
+			}
+		}
+#undef PHASE
+		vector_deinit(&insts);
+		vector_deinit(&funcs);
+		parser_deinit(&parser);
+		lexer_deinit(&lexer);
+		silk_ctx_deinit(&ctx);
+		if(failed)
+			goto quit;
+	}
+
+	for(Phase phase = 0; phase < N_PHASES; ++phase)
+		print_row(filename, size, "inst", phase_names[phase], times[phase], runs, allocs[phase],
+			peaks[phase]);
+	ret = 0;
+
+quit:
+	if(ret)
+		fprintf(stderr, "%-8s %-32s failed to run phases\n", BENCH_VARIANT, filename);
+	free(data);
+	return ret;
+}
+
+// Source to instructions through the single-pass front end, to set
+// against parse, fold and compile together
+static int direct_file(const char* filename, int runs, double* times) {
+	size_t size;
+	char* data = read_file(filename, &size);
+	if(!data)
+		return 1;
+
+	size_t allocs = 0;
+	size_t peak = 0;
+	int ret = 0;
+	for(int run = 0; run < runs && !ret; ++run) {
+		Silk_Ctx ctx;
+		silk_ctx_init(&ctx);
+		Lexer lexer;
+		Parser parser;
+		Vector_Instruction insts;
+		Vector_FunctionInfo funcs;
+		size_t n_folded;
+		size_t allocs_before = n_allocs;
+		size_t bytes_before = reset_peak();
+		double start = now_ms();
+		lexer_init(&lexer, &ctx, data, data + size);
+		parser_init(&parser, &lexer);
+		vector_Instruction_ainit(&insts, 64);
+		vector_FunctionInfo_ainit(&funcs, 16);
+		ret = emit_program(&parser, &insts, &funcs, &n_folded);
+		times[run] = now_ms() - start;
+		allocs = n_allocs - allocs_before;
+		peak = heap_peak - bytes_before;
+		vector_deinit(&insts);
+		vector_deinit(&funcs);
+		parser_deinit(&parser);
+		lexer_deinit(&lexer);
+		silk_ctx_deinit(&ctx);
+	}
+	if(ret)
+		fprintf(stderr, "%-8s %-32s single-pass failed to compile\n", BENCH_VARIANT, filename);
+	else
+		print_row(filename, size, "direct", "compile", times, runs, allocs, peak);
+	free(data);
+	return ret;
+}
+
+// End to end through silk_run_file. Cached runs start with the cache
+// already written, by a run that isn't timed, and remove it when done.
+static int bench_file(const char* filename, int runs, double* times, Mode mode) {
+	struct stat st;
+	if(stat(filename, &st))
+		return 1;
+	size_t allocs = 0;
+	size_t peak = 0;
+	for(int run = mode == MODE_CACHED ? -1 : 0; run < runs; ++run) {
+		Silk_Ctx ctx;
+		silk_ctx_init(&ctx);
+		ctx.compact_bytecode = mode == MODE_PACKED;
+		ctx.jit = mode == MODE_JIT;
+		ctx.lazy = mode == MODE_LAZY;
+		ctx.bytecode_cache = mode == MODE_CACHED;
+		size_t allocs_before = n_allocs;
+		size_t bytes_before = reset_peak();
+		double start = now_ms();
+		if(silk_run_file(&ctx, filename)) {
+			fprintf(stderr, "%-8s %-32s %s failed to run\n", BENCH_VARIANT, filename, mode_names[mode]);
+			return 1;
+		}
+		if(run >= 0)
+			times[run] = now_ms() - start;
+		allocs = n_allocs - allocs_before;
+		peak = heap_peak - bytes_before;
+		silk_ctx_deinit(&ctx);
+	}
+	print_row(filename, st.st_size, mode_names[mode], "total", times, runs, allocs, peak);
+	if(mode == MODE_CACHED) {
+		char path[4096];
+		snprintf(path, sizeof(path), "%s" CACHE_SUFFIX, filename);
+		remove(path);
+	}
+	return 0;
+}
+
+// Compiles once, then times silk_program_run alone
+static int program_file(const char* filename, int runs, double* times) {
+	struct stat st;
+	if(stat(filename, &st))
+		return 1;
+	Silk_Ctx ctx;
+	silk_ctx_init(&ctx);
+	Silk_Program* program = silk_compile_file(&ctx, filename);
+	if(!program) {
+		fprintf(stderr, "%-8s %-32s program failed to compile\n", BENCH_VARIANT, filename);
+		silk_ctx_deinit(&ctx);
+		return 1;
+	}
+
+	int ret = 0;
+	size_t allocs = 0;
+	size_t peak = 0;
+	for(int run = 0; run < runs && !ret; ++run) {
+		size_t allocs_before = n_allocs;
+		size_t bytes_before = reset_peak();
+		double start = now_ms();
+		ret = silk_program_run(&ctx, program);
+		times[run] = now_ms() - start;
+		allocs = n_allocs - allocs_before;
+		peak = heap_peak - bytes_before;
+	}
+	if(ret)
+		fprintf(stderr, "%-8s %-32s program failed to run\n", BENCH_VARIANT, filename);
+	else
+		print_row(filename, st.st_size, "program", "run", times, runs, allocs, peak);
+	silk_program_free(program);
+	silk_ctx_deinit(&ctx);
+	return ret;
+}
+
+#define REQUEST_SCRIPT "function add(a, b) { return a + b; } var x = 2; add(x, 40);"
+#define REQUESTS 10000
+
+typedef enum {
+	REQUEST_STRING,
+	REQUEST_PROGRAM,
+	REQUEST_POOL
+} RequestMode;
+
+static const char* request_names[] = { "string", "program", "pool" };
+
+static int request(RequestMode mode, Silk_Ctx* ctx, Silk_Program* program, Silk_VMPool* pool) {
+	switch(mode) {
+		case REQUEST_STRING: {
+			Silk_Ctx fresh;
+			silk_ctx_init(&fresh);
+			int ret = silk_run_string(&fresh, REQUEST_SCRIPT);
+			silk_ctx_deinit(&fresh);
+			return ret;
+		}
+		case REQUEST_PROGRAM:
+			return silk_program_run(ctx, program);
+		case REQUEST_POOL: {
+			Silk_VM* vm = silk_vm_pool_acquire(pool);
+			if(!vm)
+				return 1;
+			int ret = silk_program_run_on(ctx, program, vm);
+			silk_vm_pool_release(pool, vm);
+			return ret;
+		}
+	}
+	return 1;
+}
+
+// Requests per second for a trivial script, for -r: compiled and run
+// from scratch each time, run as a program on the ctx's VM, and run as a
+// program on a VM checked out of a pool. Each run times a batch.
+static int request_bench(int runs, double* times) {
+	Silk_Ctx ctx;
+	silk_ctx_init(&ctx);
+	Silk_Program* program = silk_compile(&ctx, REQUEST_SCRIPT, REQUEST_SCRIPT + strlen(REQUEST_SCRIPT));
+	Silk_VMPool* pool = silk_vm_pool_create();
+	int ret = !program || !pool;
+
+	puts("variant,mode,requests,median_ms,requests_per_s,allocs_per_request");
+	for(RequestMode mode = REQUEST_STRING; mode <= REQUEST_POOL && !ret; ++mode) {
+		// Warm up whatever gets reused
+		ret = request(mode, &ctx, program, pool);
+		size_t allocs = 0;
+		for(int run = 0; run < runs && !ret; ++run) {
+			size_t allocs_before = n_allocs;
+			double start = now_ms();
+			for(int i = 0; i < REQUESTS && !ret; ++i)
+				ret = request(mode, &ctx, program, pool);
+			times[run] = now_ms() - start;
+			allocs = n_allocs - allocs_before;
+		}
+		if(ret)
+			break;
+		double median;
+		double p99;
+		summarize(times, runs, &median, &p99);
+		printf("%s,%s,%d,%.4f,%.0f,%.2f\n", BENCH_VARIANT, request_names[mode], REQUESTS, median,
+			REQUESTS / (median / 1e3), (double) allocs / REQUESTS);
+	}
+	if(ret)
+		fprintf(stderr, "%-8s requests failed\n", BENCH_VARIANT);
+
+	silk_vm_pool_free(pool);
+	silk_program_free(program);
+	silk_ctx_deinit(&ctx);
+	return ret;
+}
+
+// Each batch is sized to take about this long on one thread
+#define SCALING_BATCH_MS 100.0
+
+// Runs one compiled program in batches on 1, 2, 4... up to max_threads
+// worker threads, for -t. Every batch does the same number of runs, so
+// the speedup is the single-thread time over the batch time. Under
+// ThreadSanitizer this is also the check that a program and a ctx can
+// be shared between threads.
+static int scaling_file(const char* filename, int runs, double* times, int max_threads) {
+	Silk_Ctx ctx;
+	if(silk_ctx_init(&ctx))
+		return 1;
+	Silk_Program* program = silk_compile_file(&ctx, filename);
+	if(!program) {
+		fprintf(stderr, "%-8s %-32s program failed to compile\n", BENCH_VARIANT, filename);
+		silk_ctx_deinit(&ctx);
+		return 1;
+	}
+
+	double start = now_ms();
+	int ret = silk_program_run(&ctx, program);
+	double single = now_ms() - start;
+	size_t batch = single > 0 ? SCALING_BATCH_MS / single : 100000;
+	if(batch < 16)
+		batch = 16;
+	if(batch > 100000)
+		batch = 100000;
+	int* results = malloc(sizeof(int) * batch);
+	ret |= !results;
+
+	double base = 0;
+	for(int n_threads = 1; !ret; n_threads *= 2) {
+		if(n_threads > max_threads)
+			n_threads = max_threads;
+		Silk_Workers* workers = silk_workers_create(n_threads);
+		if(!workers) {
+			ret = 1;
+			break;
+		}
+		for(int run = 0; run < runs && !ret; ++run) {
+			start = now_ms();
+			ret = silk_workers_run(workers, &ctx, program, batch, results);
+			times[run] = now_ms() - start;
+		}
+		silk_workers_free(workers);
+		if(ret)
+			break;
+
+		double median;
+		double p99;
+		summarize(times, runs, &median, &p99);
+		if(n_threads == 1)
+			base = median;
+		printf("%s,%s,%d,%zu,%.4f,%.0f,%.2f\n", BENCH_VARIANT, filename, n_threads, batch, median,
+			batch / (median / 1e3), base / median);
+		if(n_threads == max_threads)
+			break;
+	}
+	if(ret)
+		fprintf(stderr, "%-8s %-32s batch failed to run\n", BENCH_VARIANT, filename);
+
+	free(results);
+	silk_program_free(program);
+	silk_ctx_deinit(&ctx);
+	return ret;
+}
+
+#define BENCH_CHUNK (64 * 1024)
+
+// Feeds the file through a stream in fixed-size chunks, like a pipe
+// would. "first" is the time until the first chunk's statements have
+// run, the peak is what the stream holds on top of the source.
+static int stream_file(const char* filename, int runs, double* times, double* first_times) {
+	size_t size;
+	char* data = read_file(filename, &size);
+	if(!data)
+		return 1;
+
+	size_t allocs = 0;
+	size_t peak = 0;
+	int ret = 0;
+	for(int run = 0; run < runs && !ret; ++run) {
+		Silk_Ctx ctx;
+		silk_ctx_init(&ctx);
+		size_t allocs_before = n_allocs;
+		size_t bytes_before = reset_peak();
+		double start = now_ms();
+		Silk_Stream* stream = silk_stream_open(&ctx);
+		ret = !stream;
+		for(size_t pos = 0; pos < size && !ret; pos += BENCH_CHUNK) {
+			ret = silk_stream_feed(stream, data + pos, size - pos < BENCH_CHUNK ? size - pos : BENCH_CHUNK);
+			if(!pos)
+				first_times[run] = now_ms() - start;
+		}
+		if(stream && silk_stream_close(stream))
+			ret = 1;
+		times[run] = now_ms() - start;
+		allocs = n_allocs - allocs_before;
+		peak = heap_peak - bytes_before;
+		silk_ctx_deinit(&ctx);
+	}
+	if(ret)
+		fprintf(stderr, "%-8s %-32s stream failed to run\n", BENCH_VARIANT, filename);
+	else {
+		print_row(filename, size, "stream", "first", first_times, runs, allocs, peak);
+		print_row(filename, size, "stream", "total", times, runs, allocs, peak);
+	}
+	free(data);
+	return ret;
+}
+
+// Runs the script with its final stack printed and hands back what got
+// printed, or NULL if it failed. With chunk set it gets streamed that
+// many bytes at a time, otherwise it goes through silk_run_file.
+static char* printed_run(const char* filename, const char* data, size_t size, Mode mode, size_t chunk) {
+	FILE* out = tmpfile();
+	if(!out)
+		return NULL;
+	fflush(stdout);
+	int saved = dup(STDOUT_FILENO);
+	if(saved == -1 || dup2(fileno(out), STDOUT_FILENO) == -1) {
+		if(saved != -1)
+			close(saved);
+		fclose(out);
+		return NULL;
+	}
+
+	Silk_Ctx ctx;
+	int failed = silk_ctx_init(&ctx);
+	ctx.print_stack_on_exit = 1;
+	ctx.lazy = mode == MODE_LAZY;
+	ctx.bytecode_cache = mode == MODE_CACHED;
+	if(failed)
+		;
+	else if(!chunk)
+		failed = silk_run_file(&ctx, filename);
+	else {
+		Silk_Stream* stream = silk_stream_open(&ctx);
+		failed = !stream;
+		for(size_t pos = 0; pos < size && !failed; pos += chunk)
+			failed = silk_stream_feed(stream, data + pos, size - pos < chunk ? size - pos : chunk);
+		if(stream && silk_stream_close(stream))
+			failed = 1;
+	}
+	silk_ctx_deinit(&ctx);
+	fflush(stdout);
+	dup2(saved, STDOUT_FILENO);
+	close(saved);
+
+	char* printed = NULL;
+	long len = fseek(out, 0, SEEK_END) ? -1 : ftell(out);
+	if(!failed && len >= 0 && (printed = malloc(len + 1))) {
+		rewind(out);
+		if(fread(printed, 1, len, out) != (size_t) len) {
+			free(printed);
+			printed = NULL;
+		}
+		else
+			printed[len] = '\0';
+	}
+	fclose(out);
+	return printed;
+}
+
+static int same_output(const char* filename, const char* run, const char* expected, char* printed) {
+	int ret = 0;
+	if(!printed) {
+		fprintf(stderr, "%-8s %-32s %s failed to run\n", BENCH_VARIANT, filename, run);
+		return 1;
+	}
+	if(strcmp(printed, expected)) {
+		fprintf(stderr, "%-8s %-32s %s result differs from run\n", BENCH_VARIANT, filename, run);
+		ret = 1;
+	}
+	free(printed);
+	return ret;
+}
+
+// Sizes that cut tokens apart at every offset, then ones that mostly don't
+static const size_t stream_chunks[] = { 1, 2, 3, 7, 64, 4096, BENCH_CHUNK };
+
+// Checks that lazy, cached and streamed runs end with the same stack as
+// a plain silk_run_file. The cached run is made twice, once writing the
+// cache and once running from it.
+static int check_outputs(const char* filename) {
+	size_t size;
+	char* data = read_file(filename, &size);
+	if(!data)
+		return 1;
+	char* expected = printed_run(filename, data, size, MODE_INST, 0);
+	if(!expected) {
+		fprintf(stderr, "%-8s %-32s failed to run\n", BENCH_VARIANT, filename);
+		free(data);
+		return 1;
+	}
+
+	int ret = same_output(filename, mode_names[MODE_LAZY], expected,
+		printed_run(filename, data, size, MODE_LAZY, 0));
+	for(int run = 0; run < 2; ++run)
+		ret |= same_output(filename, mode_names[MODE_CACHED], expected,
+			printed_run(filename, data, size, MODE_CACHED, 0));
+	char path[4096];
+	snprintf(path, sizeof(path), "%s" CACHE_SUFFIX, filename);
+	remove(path);
+	for(size_t i = 0; i < sizeof(stream_chunks) / sizeof(stream_chunks[0]); ++i) {
+		char run[32];
+		snprintf(run, sizeof(run), "stream/%zu", stream_chunks[i]);
+		ret |= same_output(filename, run, expected,
+			printed_run(filename, data, size, MODE_INST, stream_chunks[i]));
+	}
+
+	free(expected);
+	free(data);
+	return ret;
+}
+
+int main(int argc, char** argv) {
+	int runs = 20;
+	int lex_only = 0;
+	int requests = 0;
+	int scaling = 0;
+	int max_threads = sysconf(_SC_NPROCESSORS_ONLN);
+	int i;
+	for(i = 1; i < argc; ++i) {
+		if(!strcmp(argv[i], "-n") && i + 1 < argc)
+			runs = atoi(argv[++i]);
+		else if(!strcmp(argv[i], "-l"))
+			lex_only = 1;
+		else if(!strcmp(argv[i], "-r"))
+			requests = 1;
+		else if(!strcmp(argv[i], "-t"))
+			scaling = 1;
+		else if(!strcmp(argv[i], "-j") && i + 1 < argc)
+			max_threads = atoi(argv[++i]);
+		else
+			break;
+	}
+	if((i >= argc && !requests) || runs < 1 || max_threads < 1) {
+		printf("Usage: %s [-n runs] [-l] <file.js>...\n"
+			"       %s [-n runs] -r\n"
+			"       %s [-n runs] [-j max threads] -t <file.js>...\n", argv[0], argv[0], argv[0]);
+		return 1;
+	}
+
+	double* times[N_PHASES];
+	for(Phase phase = 0; phase < N_PHASES; ++phase) {
+		times[phase] = malloc(sizeof(double) * runs);
+		if(!times[phase])
+			return 1;
+	}
+	if(requests) {
+		int ret = request_bench(runs, times[0]);
+		for(Phase phase = 0; phase < N_PHASES; ++phase)
+			free(times[phase]);
+		return ret;
+	}
+
+	int ret = 0;
+	if(scaling) {
+		puts("variant,file,threads,batch,median_ms,runs_per_s,speedup");
+		for(; i < argc; ++i)
+			if(scaling_file(argv[i], runs, times[0], max_threads))
+				ret = 1;
+		for(Phase phase = 0; phase < N_PHASES; ++phase)
+			free(times[phase]);
+		return ret;
+	}
+
+	puts("variant,file,mode,phase,runs,median_ms,p99_ms,min_ms,mb_per_s,allocs,peak_kb");
+	if(!lex_only && check_overflow())
+		ret = 1;
+	for(; i < argc; ++i) {
+		if(lex_only) {
+			if(lex_file(argv[i], runs, times[0]))
+				ret = 1;
+			continue;
+		}
+		if(inspect_file(argv[i]))
+			ret = 1;
+		if(check_outputs(argv[i]))
+			ret = 1;
+		if(phase_file(argv[i], runs, times))
+			ret = 1;
+		if(direct_file(argv[i], runs, times[0]))
+			ret = 1;
+		for(Mode mode = MODE_INST; mode <= MODE_CACHED; ++mode)
+			if(bench_file(argv[i], runs, times[0], mode))
+				ret = 1;
+		if(program_file(argv[i], runs, times[0]))
+			ret = 1;
+		if(stream_file(argv[i], runs, times[0], times[1]))
+			ret = 1;
+	}
+
+	for(Phase phase = 0; phase < N_PHASES; ++phase)
+		free(times[phase]);
+	return ret;
+}
@@ -0,0 +1,69 @@
+function f0(a) {
+	return a + 1;
+}
+
+function f1(a) {
+	return f0(a) + f0(a);
+}
+
+function f2(a) {
+	return f1(a) + f1(a);
+}
+
+function f3(a) {
+	return f2(a) + f2(a);
+}
+
+function f4(a) {
+	return f3(a) + f3(a);
+}
+
+function f5(a) {
+	return f4(a) + f4(a);
+}
+
+function f6(a) {
+	return f5(a) + f5(a);
+}
+
+function f7(a) {
+	return f6(a) + f6(a);
+}
+
+function f8(a) {
+	return f7(a) + f7(a);
+}
+
+function f9(a) {
+	return f8(a) + f8(a);
+}
+
+function f10(a) {
+	return f9(a) + f9(a);
+}
+
+function f11(a) {
+	return f10(a) + f10(a);
+}
+
+function f12(a) {
+	return f11(a) + f11(a);
+}
+
+function f13(a) {
+	return f12(a) + f12(a);
+}
+
+function f14(a) {
+	return f13(a) + f13(a);
+}
+
+function f15(a) {
+	return f14(a) + f14(a);
+}
+
+function f16(a) {
+	return f15(a) + f15(a);
+}
+
+f16(1);
@@ -0,0 +1,91 @@
+#!/bin/sh
+# Writes the generated benchmark workloads into the directory given as $1.
+# They are too large to keep in the tree.
+set -e
+out=${1:-build/bench-data}
+mkdir -p "$out"
+
+# Deep recursion: a 4000-function chain of tail calls, entered a few
+# times. Every frame is reused, so the depth isn't bounded by the VM stack.
+awk 'BEGIN {
+	n = 4000
+	print "function d0(n) { return n * 2; }"
+	for(i = 1; i < n; ++i)
+		printf "function d%d(n) { var m = n + %d; return d%d(m); }\n", i, i % 7, i - 1
+	for(i = 0; i < 16; ++i)
+		printf "d%d(%d);\n", n - 1, i
+}' > "$out/deep.js"
+
+# Call-heavy arithmetic: a binary call tree 18 levels deep, about 500k
+# calls doing a little arithmetic each.
+awk 'BEGIN {
+	n = 18
+	print "function a0(x) { var y = x * 3; return y - x / 2; }"
+	for(i = 1; i <= n; ++i)
+		printf "function a%d(x) { var l = a%d(x + 1); var r = a%d(x - 1); return l - r / %d; }\n", i, i - 1, i - 1, i + 1
+	printf "a%d(7);\na%d(0 - 7);\n", n, n
+}' > "$out/arith.js"
+
+# Large top-level script: 256 globals and 120k statements reassigning
+# them and calling a couple of small helpers.
+awk 'BEGIN {
+	g = 256
+	n = 120000
+	print "function h0(a, b) { return a * b - 1; }"
+	print "function h1(a) { var t = a / 3; return t + a; }"
+	for(i = 0; i < g; ++i)
+		printf "var g%d = %d;\n", i, i * 7 + 1
+	for(i = 0; i < n; ++i) {
+		a = i % g
+		b = (i * 31 + 7) % g
+		if(i % 5 == 0)
+			printf "g%d = h0(g%d, %d);\n", a, b, i % 100
+		else if(i % 5 == 1)
+			printf "g%d = h1(g%d);\n", a, b
+		else if(i % 5 == 2)
+			printf "g%d = g%d + g%d;\n", a, a, b
+		else if(i % 5 == 3)
+			printf "g%d = g%d * %d;\n", a, b, i % 13
+		else
+			printf "g%d = g%d - g%d / 3;\n", a, b, a
+	}
+}' > "$out/script.js"
+
+# Many-variable functions: 40 functions with 400 locals each, all chained
+# from the top level.
+awk 'BEGIN {
+	f = 40
+	v = 400
+	for(i = 0; i < f; ++i) {
+		printf "function m%d(a, b) {\n", i
+		printf "\tvar v0 = a + b;\n"
+		for(j = 1; j < v; ++j)
+			printf "\tvar v%d = v%d %s %d;\n", j, j - 1, (j % 3 == 0) ? "*" : ((j % 3 == 1) ? "+" : "-"), j % 11 + 1
+		if(i)
+			printf "\treturn m%d(v%d, v%d);\n", i - 1, v - 1, v / 2
+		else
+			printf "\treturn v%d - v%d;\n", v - 1, v / 2
+		print "}"
+	}
+	for(i = 0; i < 8; ++i)
+		printf "m%d(%d, %d);\n", f - 1, i, i * 3
+}' > "$out/locals.js"
+
+# Many small functions: 50k of them, each reading a few of 1000 globals
+# and calling its predecessor in runs of 16, so name resolution dominates
+# compile time rather than the size of any one body.
+awk 'BEGIN {
+	f = 50000
+	g = 1000
+	for(i = 0; i < g; ++i)
+		printf "var k%d = %d;\n", i, i % 17
+	for(i = 0; i < f; ++i) {
+		printf "function f%d(a, b) { var s = a + k%d; var t = s * b - k%d; ", i, i % g, (i * 7) % g
+		if(i % 16)
+			printf "return f%d(t, s) + 1; }\n", i - 1
+		else
+			printf "return t / 2; }\n"
+	}
+	for(i = 15; i < f; i += 1024)
+		printf "f%d(%d, 3);\n", i, i % 100
+}' > "$out/funcs.js"
@@ -0,0 +1,39 @@
+var big = 4000000000 * 3;
+var neg = 0 - 7;
+var counter = 1;
+
+function scale(a, b) {
+	var t = a * 1000000007;
+	var u = t / b;
+	return u - a * 3;
+}
+
+function mix(a, b, c) {
+	var x = a + b;
+	var y = x * c;
+	x = y - 9;
+	counter = counter + x;
+	return x / 2;
+}
+
+function chain(n) {
+	return mix(n, n + 1, neg);
+}
+
+function tail(n) {
+	return chain(n - 1);
+}
+
+function many(a) {
+	var v0 = a; var v1 = v0 + 1; var v2 = v1 * 2; var v3 = v2 - 3; var v4 = v3 / 2;
+	var v5 = v4 + v0; var v6 = v5 * v1; var v7 = v6 - v2; var v8 = v7 / 3; var v9 = v8 + v3;
+	var w0 = v9 * v4; var w1 = w0 - v5; var w2 = w1 / 5; var w3 = w2 + v6; var w4 = w3 * 2;
+	return w4 - v7 + v8 - v9;
+}
+
+scale(big, 13);
+scale(neg, 0 - 3);
+tail(counter);
+many(tail(12));
+counter;
+big / neg;
@@ -0,0 +1,3 @@
+function a(x) { var y = x; }
+function b() { var p = 1; var q = 2; var r = 3; return p + q + r; }
+a(1);
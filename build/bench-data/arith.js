@@ -0,0 +1,21 @@
+function a0(x) { var y = x * 3; return y - x / 2; }
+function a1(x) { var l = a0(x + 1); var r = a0(x - 1); return l - r / 2; }
+function a2(x) { var l = a1(x + 1); var r = a1(x - 1); return l - r / 3; }
+function a3(x) { var l = a2(x + 1); var r = a2(x - 1); return l - r / 4; }
+function a4(x) { var l = a3(x + 1); var r = a3(x - 1); return l - r / 5; }
+function a5(x) { var l = a4(x + 1); var r = a4(x - 1); return l - r / 6; }
+function a6(x) { var l = a5(x + 1); var r = a5(x - 1); return l - r / 7; }
+function a7(x) { var l = a6(x + 1); var r = a6(x - 1); return l - r / 8; }
+function a8(x) { var l = a7(x + 1); var r = a7(x - 1); return l - r / 9; }
+function a9(x) { var l = a8(x + 1); var r = a8(x - 1); return l - r / 10; }
+function a10(x) { var l = a9(x + 1); var r = a9(x - 1); return l - r / 11; }
+function a11(x) { var l = a10(x + 1); var r = a10(x - 1); return l - r / 12; }
+function a12(x) { var l = a11(x + 1); var r = a11(x - 1); return l - r / 13; }
+function a13(x) { var l = a12(x + 1); var r = a12(x - 1); return l - r / 14; }
+function a14(x) { var l = a13(x + 1); var r = a13(x - 1); return l - r / 15; }
+function a15(x) { var l = a14(x + 1); var r = a14(x - 1); return l - r / 16; }
+function a16(x) { var l = a15(x + 1); var r = a15(x - 1); return l - r / 17; }
+function a17(x) { var l = a16(x + 1); var r = a16(x - 1); return l - r / 18; }
+function a18(x) { var l = a17(x + 1); var r = a17(x - 1); return l - r / 19; }
+a18(7);
+a18(0 - 7);
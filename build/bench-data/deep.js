@@ -0,0 +1,4016 @@
+function d0(n) { return n * 2; }
+function d1(n) { var m = n + 1; return d0(m); }
+function d2(n) { var m = n + 2; return d1(m); }
+function d3(n) { var m = n + 3; return d2(m); }
+function d4(n) { var m = n + 4; return d3(m); }
+function d5(n) { var m = n + 5; return d4(m); }
+function d6(n) { var m = n + 6; return d5(m); }
+function d7(n) { var m = n + 0; return d6(m); }
+function d8(n) { var m = n + 1; return d7(m); }
+function d9(n) { var m = n + 2; return d8(m); }
+function d10(n) { var m = n + 3; return d9(m); }
+function d11(n) { var m = n + 4; return d10(m); }
+function d12(n) { var m = n + 5; return d11(m); }
+function d13(n) { var m = n + 6; return d12(m); }
+function d14(n) { var m = n + 0; return d13(m); }
+function d15(n) { var m = n + 1; return d14(m); }
+function d16(n) { var m = n + 2; return d15(m); }
+function d17(n) { var m = n + 3; return d16(m); }
+function d18(n) { var m = n + 4; return d17(m); }
+function d19(n) { var m = n + 5; return d18(m); }
+function d20(n) { var m = n + 6; return d19(m); }
+function d21(n) { var m = n + 0; return d20(m); }
+function d22(n) { var m = n + 1; return d21(m); }
+function d23(n) { var m = n + 2; return d22(m); }
+function d24(n) { var m = n + 3; return d23(m); }
+function d25(n) { var m = n + 4; return d24(m); }
+function d26(n) { var m = n + 5; return d25(m); }
+function d27(n) { var m = n + 6; return d26(m); }
+function d28(n) { var m = n + 0; return d27(m); }
+function d29(n) { var m = n + 1; return d28(m); }
+function d30(n) { var m = n + 2; return d29(m); }
+function d31(n) { var m = n + 3; return d30(m); }
+function d32(n) { var m = n + 4; return d31(m); }
+function d33(n) { var m = n + 5; return d32(m); }
+function d34(n) { var m = n + 6; return d33(m); }
+function d35(n) { var m = n + 0; return d34(m); }
+function d36(n) { var m = n + 1; return d35(m); }
+function d37(n) { var m = n + 2; return d36(m); }
+function d38(n) { var m = n + 3; return d37(m); }
+function d39(n) { var m = n + 4; return d38(m); }
+function d40(n) { var m = n + 5; return d39(m); }
+function d41(n) { var m = n + 6; return d40(m); }
+function d42(n) { var m = n + 0; return d41(m); }
+function d43(n) { var m = n + 1; return d42(m); }
+function d44(n) { var m = n + 2; return d43(m); }
+function d45(n) { var m = n + 3; return d44(m); }
+function d46(n) { var m = n + 4; return d45(m); }
+function d47(n) { var m = n + 5; return d46(m); }
+function d48(n) { var m = n + 6; return d47(m); }
+function d49(n) { var m = n + 0; return d48(m); }
+function d50(n) { var m = n + 1; return d49(m); }
+function d51(n) { var m = n + 2; return d50(m); }
+function d52(n) { var m = n + 3; return d51(m); }
+function d53(n) { var m = n + 4; return d52(m); }
+function d54(n) { var m = n + 5; return d53(m); }
+function d55(n) { var m = n + 6; return d54(m); }
+function d56(n) { var m = n + 0; return d55(m); }
+function d57(n) { var m = n + 1; return d56(m); }
+function d58(n) { var m = n + 2; return d57(m); }
+function d59(n) { var m = n + 3; return d58(m); }
+function d60(n) { var m = n + 4; return d59(m); }
+function d61(n) { var m = n + 5; return d60(m); }
+function d62(n) { var m = n + 6; return d61(m); }
+function d63(n) { var m = n + 0; return d62(m); }
+function d64(n) { var m = n + 1; return d63(m); }
+function d65(n) { var m = n + 2; return d64(m); }
+function d66(n) { var m = n + 3; return d65(m); }
+function d67(n) { var m = n + 4; return d66(m); }
+function d68(n) { var m = n + 5; return d67(m); }
+function d69(n) { var m = n + 6; return d68(m); }
+function d70(n) { var m = n + 0; return d69(m); }
+function d71(n) { var m = n + 1; return d70(m); }
+function d72(n) { var m = n + 2; return d71(m); }
+function d73(n) { var m = n + 3; return d72(m); }
+function d74(n) { var m = n + 4; return d73(m); }
+function d75(n) { var m = n + 5; return d74(m); }
+function d76(n) { var m = n + 6; return d75(m); }
+function d77(n) { var m = n + 0; return d76(m); }
+function d78(n) { var m = n + 1; return d77(m); }
+function d79(n) { var m = n + 2; return d78(m); }
+function d80(n) { var m = n + 3; return d79(m); }
+function d81(n) { var m = n + 4; return d80(m); }
+function d82(n) { var m = n + 5; return d81(m); }
+function d83(n) { var m = n + 6; return d82(m); }
+function d84(n) { var m = n + 0; return d83(m); }
+function d85(n) { var m = n + 1; return d84(m); }
+function d86(n) { var m = n + 2; return d85(m); }
+function d87(n) { var m = n + 3; return d86(m); }
+function d88(n) { var m = n + 4; return d87(m); }
+function d89(n) { var m = n + 5; return d88(m); }
+function d90(n) { var m = n + 6; return d89(m); }
+function d91(n) { var m = n + 0; return d90(m); }
+function d92(n) { var m = n + 1; return d91(m); }
+function d93(n) { var m = n + 2; return d92(m); }
+function d94(n) { var m = n + 3; return d93(m); }
+function d95(n) { var m = n + 4; return d94(m); }
+function d96(n) { var m = n + 5; return d95(m); }
+function d97(n) { var m = n + 6; return d96(m); }
+function d98(n) { var m = n + 0; return d97(m); }
+function d99(n) { var m = n + 1; return d98(m); }
+function d100(n) { var m = n + 2; return d99(m); }
+function d101(n) { var m = n + 3; return d100(m); }
+function d102(n) { var m = n + 4; return d101(m); }
+function d103(n) { var m = n + 5; return d102(m); }
+function d104(n) { var m = n + 6; return d103(m); }
+function d105(n) { var m = n + 0; return d104(m); }
+function d106(n) { var m = n + 1; return d105(m); }
+function d107(n) { var m = n + 2; return d106(m); }
+function d108(n) { var m = n + 3; return d107(m); }
+function d109(n) { var m = n + 4; return d108(m); }
+function d110(n) { var m = n + 5; return d109(m); }
+function d111(n) { var m = n + 6; return d110(m); }
+function d112(n) { var m = n + 0; return d111(m); }
+function d113(n) { var m = n + 1; return d112(m); }
+function d114(n) { var m = n + 2; return d113(m); }
+function d115(n) { var m = n + 3; return d114(m); }
+function d116(n) { var m = n + 4; return d115(m); }
+function d117(n) { var m = n + 5; return d116(m); }
+function d118(n) { var m = n + 6; return d117(m); }
+function d119(n) { var m = n + 0; return d118(m); }
+function d120(n) { var m = n + 1; return d119(m); }
+function d121(n) { var m = n + 2; return d120(m); }
+function d122(n) { var m = n + 3; return d121(m); }
+function d123(n) { var m = n + 4; return d122(m); }
+function d124(n) { var m = n + 5; return d123(m); }
+function d125(n) { var m = n + 6; return d124(m); }
+function d126(n) { var m = n + 0; return d125(m); }
+function d127(n) { var m = n + 1; return d126(m); }
+function d128(n) { var m = n + 2; return d127(m); }
+function d129(n) { var m = n + 3; return d128(m); }
+function d130(n) { var m = n + 4; return d129(m); }
+function d131(n) { var m = n + 5; return d130(m); }
+function d132(n) { var m = n + 6; return d131(m); }
+function d133(n) { var m = n + 0; return d132(m); }
+function d134(n) { var m = n + 1; return d133(m); }
+function d135(n) { var m = n + 2; return d134(m); }
+function d136(n) { var m = n + 3; return d135(m); }
+function d137(n) { var m = n + 4; return d136(m); }
+function d138(n) { var m = n + 5; return d137(m); }
+function d139(n) { var m = n + 6; return d138(m); }
+function d140(n) { var m = n + 0; return d139(m); }
+function d141(n) { var m = n + 1; return d140(m); }
+function d142(n) { var m = n + 2; return d141(m); }
+function d143(n) { var m = n + 3; return d142(m); }
+function d144(n) { var m = n + 4; return d143(m); }
+function d145(n) { var m = n + 5; return d144(m); }
+function d146(n) { var m = n + 6; return d145(m); }
+function d147(n) { var m = n + 0; return d146(m); }
+function d148(n) { var m = n + 1; return d147(m); }
+function d149(n) { var m = n + 2; return d148(m); }
+function d150(n) { var m = n + 3; return d149(m); }
+function d151(n) { var m = n + 4; return d150(m); }
+function d152(n) { var m = n + 5; return d151(m); }
+function d153(n) { var m = n + 6; return d152(m); }
+function d154(n) { var m = n + 0; return d153(m); }
+function d155(n) { var m = n + 1; return d154(m); }
+function d156(n) { var m = n + 2; return d155(m); }
+function d157(n) { var m = n + 3; return d156(m); }
+function d158(n) { var m = n + 4; return d157(m); }
+function d159(n) { var m = n + 5; return d158(m); }
+function d160(n) { var m = n + 6; return d159(m); }
+function d161(n) { var m = n + 0; return d160(m); }
+function d162(n) { var m = n + 1; return d161(m); }
+function d163(n) { var m = n + 2; return d162(m); }
+function d164(n) { var m = n + 3; return d163(m); }
+function d165(n) { var m = n + 4; return d164(m); }
+function d166(n) { var m = n + 5; return d165(m); }
+function d167(n) { var m = n + 6; return d166(m); }
+function d168(n) { var m = n + 0; return d167(m); }
+function d169(n) { var m = n + 1; return d168(m); }
+function d170(n) { var m = n + 2; return d169(m); }
+function d171(n) { var m = n + 3; return d170(m); }
+function d172(n) { var m = n + 4; return d171(m); }
+function d173(n) { var m = n + 5; return d172(m); }
+function d174(n) { var m = n + 6; return d173(m); }
+function d175(n) { var m = n + 0; return d174(m); }
+function d176(n) { var m = n + 1; return d175(m); }
+function d177(n) { var m = n + 2; return d176(m); }
+function d178(n) { var m = n + 3; return d177(m); }
+function d179(n) { var m = n + 4; return d178(m); }
+function d180(n) { var m = n + 5; return d179(m); }
+function d181(n) { var m = n + 6; return d180(m); }
+function d182(n) { var m = n + 0; return d181(m); }
+function d183(n) { var m = n + 1; return d182(m); }
+function d184(n) { var m = n + 2; return d183(m); }
+function d185(n) { var m = n + 3; return d184(m); }
+function d186(n) { var m = n + 4; return d185(m); }
+function d187(n) { var m = n + 5; return d186(m); }
+function d188(n) { var m = n + 6; return d187(m); }
+function d189(n) { var m = n + 0; return d188(m); }
+function d190(n) { var m = n + 1; return d189(m); }
+function d191(n) { var m = n + 2; return d190(m); }
+function d192(n) { var m = n + 3; return d191(m); }
+function d193(n) { var m = n + 4; return d192(m); }
+function d194(n) { var m = n + 5; return d193(m); }
+function d195(n) { var m = n + 6; return d194(m); }
+function d196(n) { var m = n + 0; return d195(m); }
+function d197(n) { var m = n + 1; return d196(m); }
+function d198(n) { var m = n + 2; return d197(m); }
+function d199(n) { var m = n + 3; return d198(m); }
+function d200(n) { var m = n + 4; return d199(m); }
+function d201(n) { var m = n + 5; return d200(m); }
+function d202(n) { var m = n + 6; return d201(m); }
+function d203(n) { var m = n + 0; return d202(m); }
+function d204(n) { var m = n + 1; return d203(m); }
+function d205(n) { var m = n + 2; return d204(m); }
+function d206(n) { var m = n + 3; return d205(m); }
+function d207(n) { var m = n + 4; return d206(m); }
+function d208(n) { var m = n + 5; return d207(m); }
+function d209(n) { var m = n + 6; return d208(m); }
+function d210(n) { var m = n + 0; return d209(m); }
+function d211(n) { var m = n + 1; return d210(m); }
+function d212(n) { var m = n + 2; return d211(m); }
+function d213(n) { var m = n + 3; return d212(m); }
+function d214(n) { var m = n + 4; return d213(m); }
+function d215(n) { var m = n + 5; return d214(m); }
+function d216(n) { var m = n + 6; return d215(m); }
+function d217(n) { var m = n + 0; return d216(m); }
+function d218(n) { var m = n + 1; return d217(m); }
+function d219(n) { var m = n + 2; return d218(m); }
+function d220(n) { var m = n + 3; return d219(m); }
+function d221(n) { var m = n + 4; return d220(m); }
+function d222(n) { var m = n + 5; return d221(m); }
+function d223(n) { var m = n + 6; return d222(m); }
+function d224(n) { var m = n + 0; return d223(m); }
+function d225(n) { var m = n + 1; return d224(m); }
+function d226(n) { var m = n + 2; return d225(m); }
+function d227(n) { var m = n + 3; return d226(m); }
+function d228(n) { var m = n + 4; return d227(m); }
+function d229(n) { var m = n + 5; return d228(m); }
+function d230(n) { var m = n + 6; return d229(m); }
+function d231(n) { var m = n + 0; return d230(m); }
+function d232(n) { var m = n + 1; return d231(m); }
+function d233(n) { var m = n + 2; return d232(m); }
+function d234(n) { var m = n + 3; return d233(m); }
+function d235(n) { var m = n + 4; return d234(m); }
+function d236(n) { var m = n + 5; return d235(m); }
+function d237(n) { var m = n + 6; return d236(m); }
+function d238(n) { var m = n + 0; return d237(m); }
+function d239(n) { var m = n + 1; return d238(m); }
+function d240(n) { var m = n + 2; return d239(m); }
+function d241(n) { var m = n + 3; return d240(m); }
+function d242(n) { var m = n + 4; return d241(m); }
+function d243(n) { var m = n + 5; return d242(m); }
+function d244(n) { var m = n + 6; return d243(m); }
+function d245(n) { var m = n + 0; return d244(m); }
+function d246(n) { var m = n + 1; return d245(m); }
+function d247(n) { var m = n + 2; return d246(m); }
+function d248(n) { var m = n + 3; return d247(m); }
+function d249(n) { var m = n + 4; return d248(m); }
+function d250(n) { var m = n + 5; return d249(m); }
+function d251(n) { var m = n + 6; return d250(m); }
+function d252(n) { var m = n + 0; return d251(m); }
+function d253(n) { var m = n + 1; return d252(m); }
+function d254(n) { var m = n + 2; return d253(m); }
+function d255(n) { var m = n + 3; return d254(m); }
+function d256(n) { var m = n + 4; return d255(m); }
+function d257(n) { var m = n + 5; return d256(m); }
+function d258(n) { var m = n + 6; return d257(m); }
+function d259(n) { var m = n + 0; return d258(m); }
+function d260(n) { var m = n + 1; return d259(m); }
+function d261(n) { var m = n + 2; return d260(m); }
+function d262(n) { var m = n + 3; return d261(m); }
+function d263(n) { var m = n + 4; return d262(m); }
+function d264(n) { var m = n + 5; return d263(m); }
+function d265(n) { var m = n + 6; return d264(m); }
+function d266(n) { var m = n + 0; return d265(m); }
+function d267(n) { var m = n + 1; return d266(m); }
+function d268(n) { var m = n + 2; return d267(m); }
+function d269(n) { var m = n + 3; return d268(m); }
+function d270(n) { var m = n + 4; return d269(m); }
+function d271(n) { var m = n + 5; return d270(m); }
+function d272(n) { var m = n + 6; return d271(m); }
+function d273(n) { var m = n + 0; return d272(m); }
+function d274(n) { var m = n + 1; return d273(m); }
+function d275(n) { var m = n + 2; return d274(m); }
+function d276(n) { var m = n + 3; return d275(m); }
+function d277(n) { var m = n + 4; return d276(m); }
+function d278(n) { var m = n + 5; return d277(m); }
+function d279(n) { var m = n + 6; return d278(m); }
+function d280(n) { var m = n + 0; return d279(m); }
+function d281(n) { var m = n + 1; return d280(m); }
+function d282(n) { var m = n + 2; return d281(m); }
+function d283(n) { var m = n + 3; return d282(m); }
+function d284(n) { var m = n + 4; return d283(m); }
+function d285(n) { var m = n + 5; return d284(m); }
+function d286(n) { var m = n + 6; return d285(m); }
+function d287(n) { var m = n + 0; return d286(m); }
+function d288(n) { var m = n + 1; return d287(m); }
+function d289(n) { var m = n + 2; return d288(m); }
+function d290(n) { var m = n + 3; return d289(m); }
+function d291(n) { var m = n + 4; return d290(m); }
+function d292(n) { var m = n + 5; return d291(m); }
+function d293(n) { var m = n + 6; return d292(m); }
+function d294(n) { var m = n + 0; return d293(m); }
+function d295(n) { var m = n + 1; return d294(m); }
+function d296(n) { var m = n + 2; return d295(m); }
+function d297(n) { var m = n + 3; return d296(m); }
+function d298(n) { var m = n + 4; return d297(m); }
+function d299(n) { var m = n + 5; return d298(m); }
+function d300(n) { var m = n + 6; return d299(m); }
+function d301(n) { var m = n + 0; return d300(m); }
+function d302(n) { var m = n + 1; return d301(m); }
+function d303(n) { var m = n + 2; return d302(m); }
+function d304(n) { var m = n + 3; return d303(m); }
+function d305(n) { var m = n + 4; return d304(m); }
+function d306(n) { var m = n + 5; return d305(m); }
+function d307(n) { var m = n + 6; return d306(m); }
+function d308(n) { var m = n + 0; return d307(m); }
+function d309(n) { var m = n + 1; return d308(m); }
+function d310(n) { var m = n + 2; return d309(m); }
+function d311(n) { var m = n + 3; return d310(m); }
+function d312(n) { var m = n + 4; return d311(m); }
+function d313(n) { var m = n + 5; return d312(m); }
+function d314(n) { var m = n + 6; return d313(m); }
+function d315(n) { var m = n + 0; return d314(m); }
+function d316(n) { var m = n + 1; return d315(m); }
+function d317(n) { var m = n + 2; return d316(m); }
+function d318(n) { var m = n + 3; return d317(m); }
+function d319(n) { var m = n + 4; return d318(m); }
+function d320(n) { var m = n + 5; return d319(m); }
+function d321(n) { var m = n + 6; return d320(m); }
+function d322(n) { var m = n + 0; return d321(m); }
+function d323(n) { var m = n + 1; return d322(m); }
+function d324(n) { var m = n + 2; return d323(m); }
+function d325(n) { var m = n + 3; return d324(m); }
+function d326(n) { var m = n + 4; return d325(m); }
+function d327(n) { var m = n + 5; return d326(m); }
+function d328(n) { var m = n + 6; return d327(m); }
+function d329(n) { var m = n + 0; return d328(m); }
+function d330(n) { var m = n + 1; return d329(m); }
+function d331(n) { var m = n + 2; return d330(m); }
+function d332(n) { var m = n + 3; return d331(m); }
+function d333(n) { var m = n + 4; return d332(m); }
+function d334(n) { var m = n + 5; return d333(m); }
+function d335(n) { var m = n + 6; return d334(m); }
+function d336(n) { var m = n + 0; return d335(m); }
+function d337(n) { var m = n + 1; return d336(m); }
+function d338(n) { var m = n + 2; return d337(m); }
+function d339(n) { var m = n + 3; return d338(m); }
+function d340(n) { var m = n + 4; return d339(m); }
+function d341(n) { var m = n + 5; return d340(m); }
+function d342(n) { var m = n + 6; return d341(m); }
+function d343(n) { var m = n + 0; return d342(m); }
+function d344(n) { var m = n + 1; return d343(m); }
+function d345(n) { var m = n + 2; return d344(m); }
+function d346(n) { var m = n + 3; return d345(m); }
+function d347(n) { var m = n + 4; return d346(m); }
+function d348(n) { var m = n + 5; return d347(m); }
+function d349(n) { var m = n + 6; return d348(m); }
+function d350(n) { var m = n + 0; return d349(m); }
+function d351(n) { var m = n + 1; return d350(m); }
+function d352(n) { var m = n + 2; return d351(m); }
+function d353(n) { var m = n + 3; return d352(m); }
+function d354(n) { var m = n + 4; return d353(m); }
+function d355(n) { var m = n + 5; return d354(m); }
+function d356(n) { var m = n + 6; return d355(m); }
+function d357(n) { var m = n + 0; return d356(m); }
+function d358(n) { var m = n + 1; return d357(m); }
+function d359(n) { var m = n + 2; return d358(m); }
+function d360(n) { var m = n + 3; return d359(m); }
+function d361(n) { var m = n + 4; return d360(m); }
+function d362(n) { var m = n + 5; return d361(m); }
+function d363(n) { var m = n + 6; return d362(m); }
+function d364(n) { var m = n + 0; return d363(m); }
+function d365(n) { var m = n + 1; return d364(m); }
+function d366(n) { var m = n + 2; return d365(m); }
+function d367(n) { var m = n + 3; return d366(m); }
+function d368(n) { var m = n + 4; return d367(m); }
+function d369(n) { var m = n + 5; return d368(m); }
+function d370(n) { var m = n + 6; return d369(m); }
+function d371(n) { var m = n + 0; return d370(m); }
+function d372(n) { var m = n + 1; return d371(m); }
+function d373(n) { var m = n + 2; return d372(m); }
+function d374(n) { var m = n + 3; return d373(m); }
+function d375(n) { var m = n + 4; return d374(m); }
+function d376(n) { var m = n + 5; return d375(m); }
+function d377(n) { var m = n + 6; return d376(m); }
+function d378(n) { var m = n + 0; return d377(m); }
+function d379(n) { var m = n + 1; return d378(m); }
+function d380(n) { var m = n + 2; return d379(m); }
+function d381(n) { var m = n + 3; return d380(m); }
+function d382(n) { var m = n + 4; return d381(m); }
+function d383(n) { var m = n + 5; return d382(m); }
+function d384(n) { var m = n + 6; return d383(m); }
+function d385(n) { var m = n + 0; return d384(m); }
+function d386(n) { var m = n + 1; return d385(m); }
+function d387(n) { var m = n + 2; return d386(m); }
+function d388(n) { var m = n + 3; return d387(m); }
+function d389(n) { var m = n + 4; return d388(m); }
+function d390(n) { var m = n + 5; return d389(m); }
+function d391(n) { var m = n + 6; return d390(m); }
+function d392(n) { var m = n + 0; return d391(m); }
+function d393(n) { var m = n + 1; return d392(m); }
+function d394(n) { var m = n + 2; return d393(m); }
+function d395(n) { var m = n + 3; return d394(m); }
+function d396(n) { var m = n + 4; return d395(m); }
+function d397(n) { var m = n + 5; return d396(m); }
+function d398(n) { var m = n + 6; return d397(m); }
+function d399(n) { var m = n + 0; return d398(m); }
+function d400(n) { var m = n + 1; return d399(m); }
+function d401(n) { var m = n + 2; return d400(m); }
+function d402(n) { var m = n + 3; return d401(m); }
+function d403(n) { var m = n + 4; return d402(m); }
+function d404(n) { var m = n + 5; return d403(m); }
+function d405(n) { var m = n + 6; return d404(m); }
+function d406(n) { var m = n + 0; return d405(m); }
+function d407(n) { var m = n + 1; return d406(m); }
+function d408(n) { var m = n + 2; return d407(m); }
+function d409(n) { var m = n + 3; return d408(m); }
+function d410(n) { var m = n + 4; return d409(m); }
+function d411(n) { var m = n + 5; return d410(m); }
+function d412(n) { var m = n + 6; return d411(m); }
+function d413(n) { var m = n + 0; return d412(m); }
+function d414(n) { var m = n + 1; return d413(m); }
+function d415(n) { var m = n + 2; return d414(m); }
+function d416(n) { var m = n + 3; return d415(m); }
+function d417(n) { var m = n + 4; return d416(m); }
+function d418(n) { var m = n + 5; return d417(m); }
+function d419(n) { var m = n + 6; return d418(m); }
+function d420(n) { var m = n + 0; return d419(m); }
+function d421(n) { var m = n + 1; return d420(m); }
+function d422(n) { var m = n + 2; return d421(m); }
+function d423(n) { var m = n + 3; return d422(m); }
+function d424(n) { var m = n + 4; return d423(m); }
+function d425(n) { var m = n + 5; return d424(m); }
+function d426(n) { var m = n + 6; return d425(m); }
+function d427(n) { var m = n + 0; return d426(m); }
+function d428(n) { var m = n + 1; return d427(m); }
+function d429(n) { var m = n + 2; return d428(m); }
+function d430(n) { var m = n + 3; return d429(m); }
+function d431(n) { var m = n + 4; return d430(m); }
+function d432(n) { var m = n + 5; return d431(m); }
+function d433(n) { var m = n + 6; return d432(m); }
+function d434(n) { var m = n + 0; return d433(m); }
+function d435(n) { var m = n + 1; return d434(m); }
+function d436(n) { var m = n + 2; return d435(m); }
+function d437(n) { var m = n + 3; return d436(m); }
+function d438(n) { var m = n + 4; return d437(m); }
+function d439(n) { var m = n + 5; return d438(m); }
+function d440(n) { var m = n + 6; return d439(m); }
+function d441(n) { var m = n + 0; return d440(m); }
+function d442(n) { var m = n + 1; return d441(m); }
+function d443(n) { var m = n + 2; return d442(m); }
+function d444(n) { var m = n + 3; return d443(m); }
+function d445(n) { var m = n + 4; return d444(m); }
+function d446(n) { var m = n + 5; return d445(m); }
+function d447(n) { var m = n + 6; return d446(m); }
+function d448(n) { var m = n + 0; return d447(m); }
+function d449(n) { var m = n + 1; return d448(m); }
+function d450(n) { var m = n + 2; return d449(m); }
+function d451(n) { var m = n + 3; return d450(m); }
+function d452(n) { var m = n + 4; return d451(m); }
+function d453(n) { var m = n + 5; return d452(m); }
+function d454(n) { var m = n + 6; return d453(m); }
+function d455(n) { var m = n + 0; return d454(m); }
+function d456(n) { var m = n + 1; return d455(m); }
+function d457(n) { var m = n + 2; return d456(m); }
+function d458(n) { var m = n + 3; return d457(m); }
+function d459(n) { var m = n + 4; return d458(m); }
+function d460(n) { var m = n + 5; return d459(m); }
+function d461(n) { var m = n + 6; return d460(m); }
+function d462(n) { var m = n + 0; return d461(m); }
+function d463(n) { var m = n + 1; return d462(m); }
+function d464(n) { var m = n + 2; return d463(m); }
+function d465(n) { var m = n + 3; return d464(m); }
+function d466(n) { var m = n + 4; return d465(m); }
+function d467(n) { var m = n + 5; return d466(m); }
+function d468(n) { var m = n + 6; return d467(m); }
+function d469(n) { var m = n + 0; return d468(m); }
+function d470(n) { var m = n + 1; return d469(m); }
+function d471(n) { var m = n + 2; return d470(m); }
+function d472(n) { var m = n + 3; return d471(m); }
+function d473(n) { var m = n + 4; return d472(m); }
+function d474(n) { var m = n + 5; return d473(m); }
+function d475(n) { var m = n + 6; return d474(m); }
+function d476(n) { var m = n + 0; return d475(m); }
+function d477(n) { var m = n + 1; return d476(m); }
+function d478(n) { var m = n + 2; return d477(m); }
+function d479(n) { var m = n + 3; return d478(m); }
+function d480(n) { var m = n + 4; return d479(m); }
+function d481(n) { var m = n + 5; return d480(m); }
+function d482(n) { var m = n + 6; return d481(m); }
+function d483(n) { var m = n + 0; return d482(m); }
+function d484(n) { var m = n + 1; return d483(m); }
+function d485(n) { var m = n + 2; return d484(m); }
+function d486(n) { var m = n + 3; return d485(m); }
+function d487(n) { var m = n + 4; return d486(m); }
+function d488(n) { var m = n + 5; return d487(m); }
+function d489(n) { var m = n + 6; return d488(m); }
+function d490(n) { var m = n + 0; return d489(m); }
+function d491(n) { var m = n + 1; return d490(m); }
+function d492(n) { var m = n + 2; return d491(m); }
+function d493(n) { var m = n + 3; return d492(m); }
+function d494(n) { var m = n + 4; return d493(m); }
+function d495(n) { var m = n + 5; return d494(m); }
+function d496(n) { var m = n + 6; return d495(m); }
+function d497(n) { var m = n + 0; return d496(m); }
+function d498(n) { var m = n + 1; return d497(m); }
+function d499(n) { var m = n + 2; return d498(m); }
+function d500(n) { var m = n + 3; return d499(m); }
+function d501(n) { var m = n + 4; return d500(m); }
+function d502(n) { var m = n + 5; return d501(m); }
+function d503(n) { var m = n + 6; return d502(m); }
+function d504(n) { var m = n + 0; return d503(m); }
+function d505(n) { var m = n + 1; return d504(m); }
+function d506(n) { var m = n + 2; return d505(m); }
+function d507(n) { var m = n + 3; return d506(m); }
+function d508(n) { var m = n + 4; return d507(m); }
+function d509(n) { var m = n + 5; return d508(m); }
+function d510(n) { var m = n + 6; return d509(m); }
+function d511(n) { var m = n + 0; return d510(m); }
+function d512(n) { var m = n + 1; return d511(m); }
+function d513(n) { var m = n + 2; return d512(m); }
+function d514(n) { var m = n + 3; return d513(m); }
+function d515(n) { var m = n + 4; return d514(m); }
+function d516(n) { var m = n + 5; return d515(m); }
+function d517(n) { var m = n + 6; return d516(m); }
+function d518(n) { var m = n + 0; return d517(m); }
+function d519(n) { var m = n + 1; return d518(m); }
+function d520(n) { var m = n + 2; return d519(m); }
+function d521(n) { var m = n + 3; return d520(m); }
+function d522(n) { var m = n + 4; return d521(m); }
+function d523(n) { var m = n + 5; return d522(m); }
+function d524(n) { var m = n + 6; return d523(m); }
+function d525(n) { var m = n + 0; return d524(m); }
+function d526(n) { var m = n + 1; return d525(m); }
+function d527(n) { var m = n + 2; return d526(m); }
+function d528(n) { var m = n + 3; return d527(m); }
+function d529(n) { var m = n + 4; return d528(m); }
+function d530(n) { var m = n + 5; return d529(m); }
+function d531(n) { var m = n + 6; return d530(m); }
+function d532(n) { var m = n + 0; return d531(m); }
+function d533(n) { var m = n + 1; return d532(m); }
+function d534(n) { var m = n + 2; return d533(m); }
+function d535(n) { var m = n + 3; return d534(m); }
+function d536(n) { var m = n + 4; return d535(m); }
+function d537(n) { var m = n + 5; return d536(m); }
+function d538(n) { var m = n + 6; return d537(m); }
+function d539(n) { var m = n + 0; return d538(m); }
+function d540(n) { var m = n + 1; return d539(m); }
+function d541(n) { var m = n + 2; return d540(m); }
+function d542(n) { var m = n + 3; return d541(m); }
+function d543(n) { var m = n + 4; return d542(m); }
+function d544(n) { var m = n + 5; return d543(m); }
+function d545(n) { var m = n + 6; return d544(m); }
+function d546(n) { var m = n + 0; return d545(m); }
+function d547(n) { var m = n + 1; return d546(m); }
+function d548(n) { var m = n + 2; return d547(m); }
+function d549(n) { var m = n + 3; return d548(m); }
+function d550(n) { var m = n + 4; return d549(m); }
+function d551(n) { var m = n + 5; return d550(m); }
+function d552(n) { var m = n + 6; return d551(m); }
+function d553(n) { var m = n + 0; return d552(m); }
+function d554(n) { var m = n + 1; return d553(m); }
+function d555(n) { var m = n + 2; return d554(m); }
+function d556(n) { var m = n + 3; return d555(m); }
+function d557(n) { var m = n + 4; return d556(m); }
+function d558(n) { var m = n + 5; return d557(m); }
+function d559(n) { var m = n + 6; return d558(m); }
+function d560(n) { var m = n + 0; return d559(m); }
+function d561(n) { var m = n + 1; return d560(m); }
+function d562(n) { var m = n + 2; return d561(m); }
+function d563(n) { var m = n + 3; return d562(m); }
+function d564(n) { var m = n + 4; return d563(m); }
+function d565(n) { var m = n + 5; return d564(m); }
+function d566(n) { var m = n + 6; return d565(m); }
+function d567(n) { var m = n + 0; return d566(m); }
+function d568(n) { var m = n + 1; return d567(m); }
+function d569(n) { var m = n + 2; return d568(m); }
+function d570(n) { var m = n + 3; return d569(m); }
+function d571(n) { var m = n + 4; return d570(m); }
+function d572(n) { var m = n + 5; return d571(m); }
+function d573(n) { var m = n + 6; return d572(m); }
+function d574(n) { var m = n + 0; return d573(m); }
+function d575(n) { var m = n + 1; return d574(m); }
+function d576(n) { var m = n + 2; return d575(m); }
+function d577(n) { var m = n + 3; return d576(m); }
+function d578(n) { var m = n + 4; return d577(m); }
+function d579(n) { var m = n + 5; return d578(m); }
+function d580(n) { var m = n + 6; return d579(m); }
+function d581(n) { var m = n + 0; return d580(m); }
+function d582(n) { var m = n + 1; return d581(m); }
+function d583(n) { var m = n + 2; return d582(m); }
+function d584(n) { var m = n + 3; return d583(m); }
+function d585(n) { var m = n + 4; return d584(m); }
+function d586(n) { var m = n + 5; return d585(m); }
+function d587(n) { var m = n + 6; return d586(m); }
+function d588(n) { var m = n + 0; return d587(m); }
+function d589(n) { var m = n + 1; return d588(m); }
+function d590(n) { var m = n + 2; return d589(m); }
+function d591(n) { var m = n + 3; return d590(m); }
+function d592(n) { var m = n + 4; return d591(m); }
+function d593(n) { var m = n + 5; return d592(m); }
+function d594(n) { var m = n + 6; return d593(m); }
+function d595(n) { var m = n + 0; return d594(m); }
+function d596(n) { var m = n + 1; return d595(m); }
+function d597(n) { var m = n + 2; return d596(m); }
+function d598(n) { var m = n + 3; return d597(m); }
+function d599(n) { var m = n + 4; return d598(m); }
+function d600(n) { var m = n + 5; return d599(m); }
+function d601(n) { var m = n + 6; return d600(m); }
+function d602(n) { var m = n + 0; return d601(m); }
+function d603(n) { var m = n + 1; return d602(m); }
+function d604(n) { var m = n + 2; return d603(m); }
+function d605(n) { var m = n + 3; return d604(m); }
+function d606(n) { var m = n + 4; return d605(m); }
+function d607(n) { var m = n + 5; return d606(m); }
+function d608(n) { var m = n + 6; return d607(m); }
+function d609(n) { var m = n + 0; return d608(m); }
+function d610(n) { var m = n + 1; return d609(m); }
+function d611(n) { var m = n + 2; return d610(m); }
+function d612(n) { var m = n + 3; return d611(m); }
+function d613(n) { var m = n + 4; return d612(m); }
+function d614(n) { var m = n + 5; return d613(m); }
+function d615(n) { var m = n + 6; return d614(m); }
+function d616(n) { var m = n + 0; return d615(m); }
+function d617(n) { var m = n + 1; return d616(m); }
+function d618(n) { var m = n + 2; return d617(m); }
+function d619(n) { var m = n + 3; return d618(m); }
+function d620(n) { var m = n + 4; return d619(m); }
+function d621(n) { var m = n + 5; return d620(m); }
+function d622(n) { var m = n + 6; return d621(m); }
+function d623(n) { var m = n + 0; return d622(m); }
+function d624(n) { var m = n + 1; return d623(m); }
+function d625(n) { var m = n + 2; return d624(m); }
+function d626(n) { var m = n + 3; return d625(m); }
+function d627(n) { var m = n + 4; return d626(m); }
+function d628(n) { var m = n + 5; return d627(m); }
+function d629(n) { var m = n + 6; return d628(m); }
+function d630(n) { var m = n + 0; return d629(m); }
+function d631(n) { var m = n + 1; return d630(m); }
+function d632(n) { var m = n + 2; return d631(m); }
+function d633(n) { var m = n + 3; return d632(m); }
+function d634(n) { var m = n + 4; return d633(m); }
+function d635(n) { var m = n + 5; return d634(m); }
+function d636(n) { var m = n + 6; return d635(m); }
+function d637(n) { var m = n + 0; return d636(m); }
+function d638(n) { var m = n + 1; return d637(m); }
+function d639(n) { var m = n + 2; return d638(m); }
+function d640(n) { var m = n + 3; return d639(m); }
+function d641(n) { var m = n + 4; return d640(m); }
+function d642(n) { var m = n + 5; return d641(m); }
+function d643(n) { var m = n + 6; return d642(m); }
+function d644(n) { var m = n + 0; return d643(m); }
+function d645(n) { var m = n + 1; return d644(m); }
+function d646(n) { var m = n + 2; return d645(m); }
+function d647(n) { var m = n + 3; return d646(m); }
+function d648(n) { var m = n + 4; return d647(m); }
+function d649(n) { var m = n + 5; return d648(m); }
+function d650(n) { var m = n + 6; return d649(m); }
+function d651(n) { var m = n + 0; return d650(m); }
+function d652(n) { var m = n + 1; return d651(m); }
+function d653(n) { var m = n + 2; return d652(m); }
+function d654(n) { var m = n + 3; return d653(m); }
+function d655(n) { var m = n + 4; return d654(m); }
+function d656(n) { var m = n + 5; return d655(m); }
+function d657(n) { var m = n + 6; return d656(m); }
+function d658(n) { var m = n + 0; return d657(m); }
+function d659(n) { var m = n + 1; return d658(m); }
+function d660(n) { var m = n + 2; return d659(m); }
+function d661(n) { var m = n + 3; return d660(m); }
+function d662(n) { var m = n + 4; return d661(m); }
+function d663(n) { var m = n + 5; return d662(m); }
+function d664(n) { var m = n + 6; return d663(m); }
+function d665(n) { var m = n + 0; return d664(m); }
+function d666(n) { var m = n + 1; return d665(m); }
+function d667(n) { var m = n + 2; return d666(m); }
+function d668(n) { var m = n + 3; return d667(m); }
+function d669(n) { var m = n + 4; return d668(m); }
+function d670(n) { var m = n + 5; return d669(m); }
+function d671(n) { var m = n + 6; return d670(m); }
+function d672(n) { var m = n + 0; return d671(m); }
+function d673(n) { var m = n + 1; return d672(m); }
+function d674(n) { var m = n + 2; return d673(m); }
+function d675(n) { var m = n + 3; return d674(m); }
+function d676(n) { var m = n + 4; return d675(m); }
+function d677(n) { var m = n + 5; return d676(m); }
+function d678(n) { var m = n + 6; return d677(m); }
+function d679(n) { var m = n + 0; return d678(m); }
+function d680(n) { var m = n + 1; return d679(m); }
+function d681(n) { var m = n + 2; return d680(m); }
+function d682(n) { var m = n + 3; return d681(m); }
+function d683(n) { var m = n + 4; return d682(m); }
+function d684(n) { var m = n + 5; return d683(m); }
+function d685(n) { var m = n + 6; return d684(m); }
+function d686(n) { var m = n + 0; return d685(m); }
+function d687(n) { var m = n + 1; return d686(m); }
+function d688(n) { var m = n + 2; return d687(m); }
+function d689(n) { var m = n + 3; return d688(m); }
+function d690(n) { var m = n + 4; return d689(m); }
+function d691(n) { var m = n + 5; return d690(m); }
+function d692(n) { var m = n + 6; return d691(m); }
+function d693(n) { var m = n + 0; return d692(m); }
+function d694(n) { var m = n + 1; return d693(m); }
+function d695(n) { var m = n + 2; return d694(m); }
+function d696(n) { var m = n + 3; return d695(m); }
+function d697(n) { var m = n + 4; return d696(m); }
+function d698(n) { var m = n + 5; return d697(m); }
+function d699(n) { var m = n + 6; return d698(m); }
+function d700(n) { var m = n + 0; return d699(m); }
+function d701(n) { var m = n + 1; return d700(m); }
+function d702(n) { var m = n + 2; return d701(m); }
+function d703(n) { var m = n + 3; return d702(m); }
+function d704(n) { var m = n + 4; return d703(m); }
+function d705(n) { var m = n + 5; return d704(m); }
+function d706(n) { var m = n + 6; return d705(m); }
+function d707(n) { var m = n + 0; return d706(m); }
+function d708(n) { var m = n + 1; return d707(m); }
+function d709(n) { var m = n + 2; return d708(m); }
+function d710(n) { var m = n + 3; return d709(m); }
+function d711(n) { var m = n + 4; return d710(m); }
+function d712(n) { var m = n + 5; return d711(m); }
+function d713(n) { var m = n + 6; return d712(m); }
+function d714(n) { var m = n + 0; return d713(m); }
+function d715(n) { var m = n + 1; return d714(m); }
+function d716(n) { var m = n + 2; return d715(m); }
+function d717(n) { var m = n + 3; return d716(m); }
+function d718(n) { var m = n + 4; return d717(m); }
+function d719(n) { var m = n + 5; return d718(m); }
+function d720(n) { var m = n + 6; return d719(m); }
+function d721(n) { var m = n + 0; return d720(m); }
+function d722(n) { var m = n + 1; return d721(m); }
+function d723(n) { var m = n + 2; return d722(m); }
+function d724(n) { var m = n + 3; return d723(m); }
+function d725(n) { var m = n + 4; return d724(m); }
+function d726(n) { var m = n + 5; return d725(m); }
+function d727(n) { var m = n + 6; return d726(m); }
+function d728(n) { var m = n + 0; return d727(m); }
+function d729(n) { var m = n + 1; return d728(m); }
+function d730(n) { var m = n + 2; return d729(m); }
+function d731(n) { var m = n + 3; return d730(m); }
+function d732(n) { var m = n + 4; return d731(m); }
+function d733(n) { var m = n + 5; return d732(m); }
+function d734(n) { var m = n + 6; return d733(m); }
+function d735(n) { var m = n + 0; return d734(m); }
+function d736(n) { var m = n + 1; return d735(m); }
+function d737(n) { var m = n + 2; return d736(m); }
+function d738(n) { var m = n + 3; return d737(m); }
+function d739(n) { var m = n + 4; return d738(m); }
+function d740(n) { var m = n + 5; return d739(m); }
+function d741(n) { var m = n + 6; return d740(m); }
+function d742(n) { var m = n + 0; return d741(m); }
+function d743(n) { var m = n + 1; return d742(m); }
+function d744(n) { var m = n + 2; return d743(m); }
+function d745(n) { var m = n + 3; return d744(m); }
+function d746(n) { var m = n + 4; return d745(m); }
+function d747(n) { var m = n + 5; return d746(m); }
+function d748(n) { var m = n + 6; return d747(m); }
+function d749(n) { var m = n + 0; return d748(m); }
+function d750(n) { var m = n + 1; return d749(m); }
+function d751(n) { var m = n + 2; return d750(m); }
+function d752(n) { var m = n + 3; return d751(m); }
+function d753(n) { var m = n + 4; return d752(m); }
+function d754(n) { var m = n + 5; return d753(m); }
+function d755(n) { var m = n + 6; return d754(m); }
+function d756(n) { var m = n + 0; return d755(m); }
+function d757(n) { var m = n + 1; return d756(m); }
+function d758(n) { var m = n + 2; return d757(m); }
+function d759(n) { var m = n + 3; return d758(m); }
+function d760(n) { var m = n + 4; return d759(m); }
+function d761(n) { var m = n + 5; return d760(m); }
+function d762(n) { var m = n + 6; return d761(m); }
+function d763(n) { var m = n + 0; return d762(m); }
+function d764(n) { var m = n + 1; return d763(m); }
+function d765(n) { var m = n + 2; return d764(m); }
+function d766(n) { var m = n + 3; return d765(m); }
+function d767(n) { var m = n + 4; return d766(m); }
+function d768(n) { var m = n + 5; return d767(m); }
+function d769(n) { var m = n + 6; return d768(m); }
+function d770(n) { var m = n + 0; return d769(m); }
+function d771(n) { var m = n + 1; return d770(m); }
+function d772(n) { var m = n + 2; return d771(m); }
+function d773(n) { var m = n + 3; return d772(m); }
+function d774(n) { var m = n + 4; return d773(m); }
+function d775(n) { var m = n + 5; return d774(m); }
+function d776(n) { var m = n + 6; return d775(m); }
+function d777(n) { var m = n + 0; return d776(m); }
+function d778(n) { var m = n + 1; return d777(m); }
+function d779(n) { var m = n + 2; return d778(m); }
+function d780(n) { var m = n + 3; return d779(m); }
+function d781(n) { var m = n + 4; return d780(m); }
+function d782(n) { var m = n + 5; return d781(m); }
+function d783(n) { var m = n + 6; return d782(m); }
+function d784(n) { var m = n + 0; return d783(m); }
+function d785(n) { var m = n + 1; return d784(m); }
+function d786(n) { var m = n + 2; return d785(m); }
+function d787(n) { var m = n + 3; return d786(m); }
+function d788(n) { var m = n + 4; return d787(m); }
+function d789(n) { var m = n + 5; return d788(m); }
+function d790(n) { var m = n + 6; return d789(m); }
+function d791(n) { var m = n + 0; return d790(m); }
+function d792(n) { var m = n + 1; return d791(m); }
+function d793(n) { var m = n + 2; return d792(m); }
+function d794(n) { var m = n + 3; return d793(m); }
+function d795(n) { var m = n + 4; return d794(m); }
+function d796(n) { var m = n + 5; return d795(m); }
+function d797(n) { var m = n + 6; return d796(m); }
+function d798(n) { var m = n + 0; return d797(m); }
+function d799(n) { var m = n + 1; return d798(m); }
+function d800(n) { var m = n + 2; return d799(m); }
+function d801(n) { var m = n + 3; return d800(m); }
+function d802(n) { var m = n + 4; return d801(m); }
+function d803(n) { var m = n + 5; return d802(m); }
+function d804(n) { var m = n + 6; return d803(m); }
+function d805(n) { var m = n + 0; return d804(m); }
+function d806(n) { var m = n + 1; return d805(m); }
+function d807(n) { var m = n + 2; return d806(m); }
+function d808(n) { var m = n + 3; return d807(m); }
+function d809(n) { var m = n + 4; return d808(m); }
+function d810(n) { var m = n + 5; return d809(m); }
+function d811(n) { var m = n + 6; return d810(m); }
+function d812(n) { var m = n + 0; return d811(m); }
+function d813(n) { var m = n + 1; return d812(m); }
+function d814(n) { var m = n + 2; return d813(m); }
+function d815(n) { var m = n + 3; return d814(m); }
+function d816(n) { var m = n + 4; return d815(m); }
+function d817(n) { var m = n + 5; return d816(m); }
+function d818(n) { var m = n + 6; return d817(m); }
+function d819(n) { var m = n + 0; return d818(m); }
+function d820(n) { var m = n + 1; return d819(m); }
+function d821(n) { var m = n + 2; return d820(m); }
+function d822(n) { var m = n + 3; return d821(m); }
+function d823(n) { var m = n + 4; return d822(m); }
+function d824(n) { var m = n + 5; return d823(m); }
+function d825(n) { var m = n + 6; return d824(m); }
+function d826(n) { var m = n + 0; return d825(m); }
+function d827(n) { var m = n + 1; return d826(m); }
+function d828(n) { var m = n + 2; return d827(m); }
+function d829(n) { var m = n + 3; return d828(m); }
+function d830(n) { var m = n + 4; return d829(m); }
+function d831(n) { var m = n + 5; return d830(m); }
+function d832(n) { var m = n + 6; return d831(m); }
+function d833(n) { var m = n + 0; return d832(m); }
+function d834(n) { var m = n + 1; return d833(m); }
+function d835(n) { var m = n + 2; return d834(m); }
+function d836(n) { var m = n + 3; return d835(m); }
+function d837(n) { var m = n + 4; return d836(m); }
+function d838(n) { var m = n + 5; return d837(m); }
+function d839(n) { var m = n + 6; return d838(m); }
+function d840(n) { var m = n + 0; return d839(m); }
+function d841(n) { var m = n + 1; return d840(m); }
+function d842(n) { var m = n + 2; return d841(m); }
+function d843(n) { var m = n + 3; return d842(m); }
+function d844(n) { var m = n + 4; return d843(m); }
+function d845(n) { var m = n + 5; return d844(m); }
+function d846(n) { var m = n + 6; return d845(m); }
+function d847(n) { var m = n + 0; return d846(m); }
+function d848(n) { var m = n + 1; return d847(m); }
+function d849(n) { var m = n + 2; return d848(m); }
+function d850(n) { var m = n + 3; return d849(m); }
+function d851(n) { var m = n + 4; return d850(m); }
+function d852(n) { var m = n + 5; return d851(m); }
+function d853(n) { var m = n + 6; return d852(m); }
+function d854(n) { var m = n + 0; return d853(m); }
+function d855(n) { var m = n + 1; return d854(m); }
+function d856(n) { var m = n + 2; return d855(m); }
+function d857(n) { var m = n + 3; return d856(m); }
+function d858(n) { var m = n + 4; return d857(m); }
+function d859(n) { var m = n + 5; return d858(m); }
+function d860(n) { var m = n + 6; return d859(m); }
+function d861(n) { var m = n + 0; return d860(m); }
+function d862(n) { var m = n + 1; return d861(m); }
+function d863(n) { var m = n + 2; return d862(m); }
+function d864(n) { var m = n + 3; return d863(m); }
+function d865(n) { var m = n + 4; return d864(m); }
+function d866(n) { var m = n + 5; return d865(m); }
+function d867(n) { var m = n + 6; return d866(m); }
+function d868(n) { var m = n + 0; return d867(m); }
+function d869(n) { var m = n + 1; return d868(m); }
+function d870(n) { var m = n + 2; return d869(m); }
+function d871(n) { var m = n + 3; return d870(m); }
+function d872(n) { var m = n + 4; return d871(m); }
+function d873(n) { var m = n + 5; return d872(m); }
+function d874(n) { var m = n + 6; return d873(m); }
+function d875(n) { var m = n + 0; return d874(m); }
+function d876(n) { var m = n + 1; return d875(m); }
+function d877(n) { var m = n + 2; return d876(m); }
+function d878(n) { var m = n + 3; return d877(m); }
+function d879(n) { var m = n + 4; return d878(m); }
+function d880(n) { var m = n + 5; return d879(m); }
+function d881(n) { var m = n + 6; return d880(m); }
+function d882(n) { var m = n + 0; return d881(m); }
+function d883(n) { var m = n + 1; return d882(m); }
+function d884(n) { var m = n + 2; return d883(m); }
+function d885(n) { var m = n + 3; return d884(m); }
+function d886(n) { var m = n + 4; return d885(m); }
+function d887(n) { var m = n + 5; return d886(m); }
+function d888(n) { var m = n + 6; return d887(m); }
+function d889(n) { var m = n + 0; return d888(m); }
+function d890(n) { var m = n + 1; return d889(m); }
+function d891(n) { var m = n + 2; return d890(m); }
+function d892(n) { var m = n + 3; return d891(m); }
+function d893(n) { var m = n + 4; return d892(m); }
+function d894(n) { var m = n + 5; return d893(m); }
+function d895(n) { var m = n + 6; return d894(m); }
+function d896(n) { var m = n + 0; return d895(m); }
+function d897(n) { var m = n + 1; return d896(m); }
+function d898(n) { var m = n + 2; return d897(m); }
+function d899(n) { var m = n + 3; return d898(m); }
+function d900(n) { var m = n + 4; return d899(m); }
+function d901(n) { var m = n + 5; return d900(m); }
+function d902(n) { var m = n + 6; return d901(m); }
+function d903(n) { var m = n + 0; return d902(m); }
+function d904(n) { var m = n + 1; return d903(m); }
+function d905(n) { var m = n + 2; return d904(m); }
+function d906(n) { var m = n + 3; return d905(m); }
+function d907(n) { var m = n + 4; return d906(m); }
+function d908(n) { var m = n + 5; return d907(m); }
+function d909(n) { var m = n + 6; return d908(m); }
+function d910(n) { var m = n + 0; return d909(m); }
+function d911(n) { var m = n + 1; return d910(m); }
+function d912(n) { var m = n + 2; return d911(m); }
+function d913(n) { var m = n + 3; return d912(m); }
+function d914(n) { var m = n + 4; return d913(m); }
+function d915(n) { var m = n + 5; return d914(m); }
+function d916(n) { var m = n + 6; return d915(m); }
+function d917(n) { var m = n + 0; return d916(m); }
+function d918(n) { var m = n + 1; return d917(m); }
+function d919(n) { var m = n + 2; return d918(m); }
+function d920(n) { var m = n + 3; return d919(m); }
+function d921(n) { var m = n + 4; return d920(m); }
+function d922(n) { var m = n + 5; return d921(m); }
+function d923(n) { var m = n + 6; return d922(m); }
+function d924(n) { var m = n + 0; return d923(m); }
+function d925(n) { var m = n + 1; return d924(m); }
+function d926(n) { var m = n + 2; return d925(m); }
+function d927(n) { var m = n + 3; return d926(m); }
+function d928(n) { var m = n + 4; return d927(m); }
+function d929(n) { var m = n + 5; return d928(m); }
+function d930(n) { var m = n + 6; return d929(m); }
+function d931(n) { var m = n + 0; return d930(m); }
+function d932(n) { var m = n + 1; return d931(m); }
+function d933(n) { var m = n + 2; return d932(m); }
+function d934(n) { var m = n + 3; return d933(m); }
+function d935(n) { var m = n + 4; return d934(m); }
+function d936(n) { var m = n + 5; return d935(m); }
+function d937(n) { var m = n + 6; return d936(m); }
+function d938(n) { var m = n + 0; return d937(m); }
+function d939(n) { var m = n + 1; return d938(m); }
+function d940(n) { var m = n + 2; return d939(m); }
+function d941(n) { var m = n + 3; return d940(m); }
+function d942(n) { var m = n + 4; return d941(m); }
+function d943(n) { var m = n + 5; return d942(m); }
+function d944(n) { var m = n + 6; return d943(m); }
+function d945(n) { var m = n + 0; return d944(m); }
+function d946(n) { var m = n + 1; return d945(m); }
+function d947(n) { var m = n + 2; return d946(m); }
+function d948(n) { var m = n + 3; return d947(m); }
+function d949(n) { var m = n + 4; return d948(m); }
+function d950(n) { var m = n + 5; return d949(m); }
+function d951(n) { var m = n + 6; return d950(m); }
+function d952(n) { var m = n + 0; return d951(m); }
+function d953(n) { var m = n + 1; return d952(m); }
+function d954(n) { var m = n + 2; return d953(m); }
+function d955(n) { var m = n + 3; return d954(m); }
+function d956(n) { var m = n + 4; return d955(m); }
+function d957(n) { var m = n + 5; return d956(m); }
+function d958(n) { var m = n + 6; return d957(m); }
+function d959(n) { var m = n + 0; return d958(m); }
+function d960(n) { var m = n + 1; return d959(m); }
+function d961(n) { var m = n + 2; return d960(m); }
+function d962(n) { var m = n + 3; return d961(m); }
+function d963(n) { var m = n + 4; return d962(m); }
+function d964(n) { var m = n + 5; return d963(m); }
+function d965(n) { var m = n + 6; return d964(m); }
+function d966(n) { var m = n + 0; return d965(m); }
+function d967(n) { var m = n + 1; return d966(m); }
+function d968(n) { var m = n + 2; return d967(m); }
+function d969(n) { var m = n + 3; return d968(m); }
+function d970(n) { var m = n + 4; return d969(m); }
+function d971(n) { var m = n + 5; return d970(m); }
+function d972(n) { var m = n + 6; return d971(m); }
+function d973(n) { var m = n + 0; return d972(m); }
+function d974(n) { var m = n + 1; return d973(m); }
+function d975(n) { var m = n + 2; return d974(m); }
+function d976(n) { var m = n + 3; return d975(m); }
+function d977(n) { var m = n + 4; return d976(m); }
+function d978(n) { var m = n + 5; return d977(m); }
+function d979(n) { var m = n + 6; return d978(m); }
+function d980(n) { var m = n + 0; return d979(m); }
+function d981(n) { var m = n + 1; return d980(m); }
+function d982(n) { var m = n + 2; return d981(m); }
+function d983(n) { var m = n + 3; return d982(m); }
+function d984(n) { var m = n + 4; return d983(m); }
+function d985(n) { var m = n + 5; return d984(m); }
+function d986(n) { var m = n + 6; return d985(m); }
+function d987(n) { var m = n + 0; return d986(m); }
+function d988(n) { var m = n + 1; return d987(m); }
+function d989(n) { var m = n + 2; return d988(m); }
+function d990(n) { var m = n + 3; return d989(m); }
+function d991(n) { var m = n + 4; return d990(m); }
+function d992(n) { var m = n + 5; return d991(m); }
+function d993(n) { var m = n + 6; return d992(m); }
+function d994(n) { var m = n + 0; return d993(m); }
+function d995(n) { var m = n + 1; return d994(m); }
+function d996(n) { var m = n + 2; return d995(m); }
+function d997(n) { var m = n + 3; return d996(m); }
+function d998(n) { var m = n + 4; return d997(m); }
+function d999(n) { var m = n + 5; return d998(m); }
+function d1000(n) { var m = n + 6; return d999(m); }
+function d1001(n) { var m = n + 0; return d1000(m); }
+function d1002(n) { var m = n + 1; return d1001(m); }
+function d1003(n) { var m = n + 2; return d1002(m); }
+function d1004(n) { var m = n + 3; return d1003(m); }
+function d1005(n) { var m = n + 4; return d1004(m); }
+function d1006(n) { var m = n + 5; return d1005(m); }
+function d1007(n) { var m = n + 6; return d1006(m); }
+function d1008(n) { var m = n + 0; return d1007(m); }
+function d1009(n) { var m = n + 1; return d1008(m); }
+function d1010(n) { var m = n + 2; return d1009(m); }
+function d1011(n) { var m = n + 3; return d1010(m); }
+function d1012(n) { var m = n + 4; return d1011(m); }
+function d1013(n) { var m = n + 5; return d1012(m); }
+function d1014(n) { var m = n + 6; return d1013(m); }
+function d1015(n) { var m = n + 0; return d1014(m); }
+function d1016(n) { var m = n + 1; return d1015(m); }
+function d1017(n) { var m = n + 2; return d1016(m); }
+function d1018(n) { var m = n + 3; return d1017(m); }
+function d1019(n) { var m = n + 4; return d1018(m); }
+function d1020(n) { var m = n + 5; return d1019(m); }
+function d1021(n) { var m = n + 6; return d1020(m); }
+function d1022(n) { var m = n + 0; return d1021(m); }
+function d1023(n) { var m = n + 1; return d1022(m); }
+function d1024(n) { var m = n + 2; return d1023(m); }
+function d1025(n) { var m = n + 3; return d1024(m); }
+function d1026(n) { var m = n + 4; return d1025(m); }
+function d1027(n) { var m = n + 5; return d1026(m); }
+function d1028(n) { var m = n + 6; return d1027(m); }
+function d1029(n) { var m = n + 0; return d1028(m); }
+function d1030(n) { var m = n + 1; return d1029(m); }
+function d1031(n) { var m = n + 2; return d1030(m); }
+function d1032(n) { var m = n + 3; return d1031(m); }
+function d1033(n) { var m = n + 4; return d1032(m); }
+function d1034(n) { var m = n + 5; return d1033(m); }
+function d1035(n) { var m = n + 6; return d1034(m); }
+function d1036(n) { var m = n + 0; return d1035(m); }
+function d1037(n) { var m = n + 1; return d1036(m); }
+function d1038(n) { var m = n + 2; return d1037(m); }
+function d1039(n) { var m = n + 3; return d1038(m); }
+function d1040(n) { var m = n + 4; return d1039(m); }
+function d1041(n) { var m = n + 5; return d1040(m); }
+function d1042(n) { var m = n + 6; return d1041(m); }
+function d1043(n) { var m = n + 0; return d1042(m); }
+function d1044(n) { var m = n + 1; return d1043(m); }
+function d1045(n) { var m = n + 2; return d1044(m); }
+function d1046(n) { var m = n + 3; return d1045(m); }
+function d1047(n) { var m = n + 4; return d1046(m); }
+function d1048(n) { var m = n + 5; return d1047(m); }
+function d1049(n) { var m = n + 6; return d1048(m); }
+function d1050(n) { var m = n + 0; return d1049(m); }
+function d1051(n) { var m = n + 1; return d1050(m); }
+function d1052(n) { var m = n + 2; return d1051(m); }
+function d1053(n) { var m = n + 3; return d1052(m); }
+function d1054(n) { var m = n + 4; return d1053(m); }
+function d1055(n) { var m = n + 5; return d1054(m); }
+function d1056(n) { var m = n + 6; return d1055(m); }
+function d1057(n) { var m = n + 0; return d1056(m); }
+function d1058(n) { var m = n + 1; return d1057(m); }
+function d1059(n) { var m = n + 2; return d1058(m); }
+function d1060(n) { var m = n + 3; return d1059(m); }
+function d1061(n) { var m = n + 4; return d1060(m); }
+function d1062(n) { var m = n + 5; return d1061(m); }
+function d1063(n) { var m = n + 6; return d1062(m); }
+function d1064(n) { var m = n + 0; return d1063(m); }
+function d1065(n) { var m = n + 1; return d1064(m); }
+function d1066(n) { var m = n + 2; return d1065(m); }
+function d1067(n) { var m = n + 3; return d1066(m); }
+function d1068(n) { var m = n + 4; return d1067(m); }
+function d1069(n) { var m = n + 5; return d1068(m); }
+function d1070(n) { var m = n + 6; return d1069(m); }
+function d1071(n) { var m = n + 0; return d1070(m); }
+function d1072(n) { var m = n + 1; return d1071(m); }
+function d1073(n) { var m = n + 2; return d1072(m); }
+function d1074(n) { var m = n + 3; return d1073(m); }
+function d1075(n) { var m = n + 4; return d1074(m); }
+function d1076(n) { var m = n + 5; return d1075(m); }
+function d1077(n) { var m = n + 6; return d1076(m); }
+function d1078(n) { var m = n + 0; return d1077(m); }
+function d1079(n) { var m = n + 1; return d1078(m); }
+function d1080(n) { var m = n + 2; return d1079(m); }
+function d1081(n) { var m = n + 3; return d1080(m); }
+function d1082(n) { var m = n + 4; return d1081(m); }
+function d1083(n) { var m = n + 5; return d1082(m); }
+function d1084(n) { var m = n + 6; return d1083(m); }
+function d1085(n) { var m = n + 0; return d1084(m); }
+function d1086(n) { var m = n + 1; return d1085(m); }
+function d1087(n) { var m = n + 2; return d1086(m); }
+function d1088(n) { var m = n + 3; return d1087(m); }
+function d1089(n) { var m = n + 4; return d1088(m); }
+function d1090(n) { var m = n + 5; return d1089(m); }
+function d1091(n) { var m = n + 6; return d1090(m); }
+function d1092(n) { var m = n + 0; return d1091(m); }
+function d1093(n) { var m = n + 1; return d1092(m); }
+function d1094(n) { var m = n + 2; return d1093(m); }
+function d1095(n) { var m = n + 3; return d1094(m); }
+function d1096(n) { var m = n + 4; return d1095(m); }
+function d1097(n) { var m = n + 5; return d1096(m); }
+function d1098(n) { var m = n + 6; return d1097(m); }
+function d1099(n) { var m = n + 0; return d1098(m); }
+function d1100(n) { var m = n + 1; return d1099(m); }
+function d1101(n) { var m = n + 2; return d1100(m); }
+function d1102(n) { var m = n + 3; return d1101(m); }
+function d1103(n) { var m = n + 4; return d1102(m); }
+function d1104(n) { var m = n + 5; return d1103(m); }
+function d1105(n) { var m = n + 6; return d1104(m); }
+function d1106(n) { var m = n + 0; return d1105(m); }
+function d1107(n) { var m = n + 1; return d1106(m); }
+function d1108(n) { var m = n + 2; return d1107(m); }
+function d1109(n) { var m = n + 3; return d1108(m); }
+function d1110(n) { var m = n + 4; return d1109(m); }
+function d1111(n) { var m = n + 5; return d1110(m); }
+function d1112(n) { var m = n + 6; return d1111(m); }
+function d1113(n) { var m = n + 0; return d1112(m); }
+function d1114(n) { var m = n + 1; return d1113(m); }
+function d1115(n) { var m = n + 2; return d1114(m); }
+function d1116(n) { var m = n + 3; return d1115(m); }
+function d1117(n) { var m = n + 4; return d1116(m); }
+function d1118(n) { var m = n + 5; return d1117(m); }
+function d1119(n) { var m = n + 6; return d1118(m); }
+function d1120(n) { var m = n + 0; return d1119(m); }
+function d1121(n) { var m = n + 1; return d1120(m); }
+function d1122(n) { var m = n + 2; return d1121(m); }
+function d1123(n) { var m = n + 3; return d1122(m); }
+function d1124(n) { var m = n + 4; return d1123(m); }
+function d1125(n) { var m = n + 5; return d1124(m); }
+function d1126(n) { var m = n + 6; return d1125(m); }
+function d1127(n) { var m = n + 0; return d1126(m); }
+function d1128(n) { var m = n + 1; return d1127(m); }
+function d1129(n) { var m = n + 2; return d1128(m); }
+function d1130(n) { var m = n + 3; return d1129(m); }
+function d1131(n) { var m = n + 4; return d1130(m); }
+function d1132(n) { var m = n + 5; return d1131(m); }
+function d1133(n) { var m = n + 6; return d1132(m); }
+function d1134(n) { var m = n + 0; return d1133(m); }
+function d1135(n) { var m = n + 1; return d1134(m); }
+function d1136(n) { var m = n + 2; return d1135(m); }
+function d1137(n) { var m = n + 3; return d1136(m); }
+function d1138(n) { var m = n + 4; return d1137(m); }
+function d1139(n) { var m = n + 5; return d1138(m); }
+function d1140(n) { var m = n + 6; return d1139(m); }
+function d1141(n) { var m = n + 0; return d1140(m); }
+function d1142(n) { var m = n + 1; return d1141(m); }
+function d1143(n) { var m = n + 2; return d1142(m); }
+function d1144(n) { var m = n + 3; return d1143(m); }
+function d1145(n) { var m = n + 4; return d1144(m); }
+function d1146(n) { var m = n + 5; return d1145(m); }
+function d1147(n) { var m = n + 6; return d1146(m); }
+function d1148(n) { var m = n + 0; return d1147(m); }
+function d1149(n) { var m = n + 1; return d1148(m); }
+function d1150(n) { var m = n + 2; return d1149(m); }
+function d1151(n) { var m = n + 3; return d1150(m); }
+function d1152(n) { var m = n + 4; return d1151(m); }
+function d1153(n) { var m = n + 5; return d1152(m); }
+function d1154(n) { var m = n + 6; return d1153(m); }
+function d1155(n) { var m = n + 0; return d1154(m); }
+function d1156(n) { var m = n + 1; return d1155(m); }
+function d1157(n) { var m = n + 2; return d1156(m); }
+function d1158(n) { var m = n + 3; return d1157(m); }
+function d1159(n) { var m = n + 4; return d1158(m); }
+function d1160(n) { var m = n + 5; return d1159(m); }
+function d1161(n) { var m = n + 6; return d1160(m); }
+function d1162(n) { var m = n + 0; return d1161(m); }
+function d1163(n) { var m = n + 1; return d1162(m); }
+function d1164(n) { var m = n + 2; return d1163(m); }
+function d1165(n) { var m = n + 3; return d1164(m); }
+function d1166(n) { var m = n + 4; return d1165(m); }
+function d1167(n) { var m = n + 5; return d1166(m); }
+function d1168(n) { var m = n + 6; return d1167(m); }
+function d1169(n) { var m = n + 0; return d1168(m); }
+function d1170(n) { var m = n + 1; return d1169(m); }
+function d1171(n) { var m = n + 2; return d1170(m); }
+function d1172(n) { var m = n + 3; return d1171(m); }
+function d1173(n) { var m = n + 4; return d1172(m); }
+function d1174(n) { var m = n + 5; return d1173(m); }
+function d1175(n) { var m = n + 6; return d1174(m); }
+function d1176(n) { var m = n + 0; return d1175(m); }
+function d1177(n) { var m = n + 1; return d1176(m); }
+function d1178(n) { var m = n + 2; return d1177(m); }
+function d1179(n) { var m = n + 3; return d1178(m); }
+function d1180(n) { var m = n + 4; return d1179(m); }
+function d1181(n) { var m = n + 5; return d1180(m); }
+function d1182(n) { var m = n + 6; return d1181(m); }
+function d1183(n) { var m = n + 0; return d1182(m); }
+function d1184(n) { var m = n + 1; return d1183(m); }
+function d1185(n) { var m = n + 2; return d1184(m); }
+function d1186(n) { var m = n + 3; return d1185(m); }
+function d1187(n) { var m = n + 4; return d1186(m); }
+function d1188(n) { var m = n + 5; return d1187(m); }
+function d1189(n) { var m = n + 6; return d1188(m); }
+function d1190(n) { var m = n + 0; return d1189(m); }
+function d1191(n) { var m = n + 1; return d1190(m); }
+function d1192(n) { var m = n + 2; return d1191(m); }
+function d1193(n) { var m = n + 3; return d1192(m); }
+function d1194(n) { var m = n + 4; return d1193(m); }
+function d1195(n) { var m = n + 5; return d1194(m); }
+function d1196(n) { var m = n + 6; return d1195(m); }
+function d1197(n) { var m = n + 0; return d1196(m); }
+function d1198(n) { var m = n + 1; return d1197(m); }
+function d1199(n) { var m = n + 2; return d1198(m); }
+function d1200(n) { var m = n + 3; return d1199(m); }
+function d1201(n) { var m = n + 4; return d1200(m); }
+function d1202(n) { var m = n + 5; return d1201(m); }
+function d1203(n) { var m = n + 6; return d1202(m); }
+function d1204(n) { var m = n + 0; return d1203(m); }
+function d1205(n) { var m = n + 1; return d1204(m); }
+function d1206(n) { var m = n + 2; return d1205(m); }
+function d1207(n) { var m = n + 3; return d1206(m); }
+function d1208(n) { var m = n + 4; return d1207(m); }
+function d1209(n) { var m = n + 5; return d1208(m); }
+function d1210(n) { var m = n + 6; return d1209(m); }
+function d1211(n) { var m = n + 0; return d1210(m); }
+function d1212(n) { var m = n + 1; return d1211(m); }
+function d1213(n) { var m = n + 2; return d1212(m); }
+function d1214(n) { var m = n + 3; return d1213(m); }
+function d1215(n) { var m = n + 4; return d1214(m); }
+function d1216(n) { var m = n + 5; return d1215(m); }
+function d1217(n) { var m = n + 6; return d1216(m); }
+function d1218(n) { var m = n + 0; return d1217(m); }
+function d1219(n) { var m = n + 1; return d1218(m); }
+function d1220(n) { var m = n + 2; return d1219(m); }
+function d1221(n) { var m = n + 3; return d1220(m); }
+function d1222(n) { var m = n + 4; return d1221(m); }
+function d1223(n) { var m = n + 5; return d1222(m); }
+function d1224(n) { var m = n + 6; return d1223(m); }
+function d1225(n) { var m = n + 0; return d1224(m); }
+function d1226(n) { var m = n + 1; return d1225(m); }
+function d1227(n) { var m = n + 2; return d1226(m); }
+function d1228(n) { var m = n + 3; return d1227(m); }
+function d1229(n) { var m = n + 4; return d1228(m); }
+function d1230(n) { var m = n + 5; return d1229(m); }
+function d1231(n) { var m = n + 6; return d1230(m); }
+function d1232(n) { var m = n + 0; return d1231(m); }
+function d1233(n) { var m = n + 1; return d1232(m); }
+function d1234(n) { var m = n + 2; return d1233(m); }
+function d1235(n) { var m = n + 3; return d1234(m); }
+function d1236(n) { var m = n + 4; return d1235(m); }
+function d1237(n) { var m = n + 5; return d1236(m); }
+function d1238(n) { var m = n + 6; return d1237(m); }
+function d1239(n) { var m = n + 0; return d1238(m); }
+function d1240(n) { var m = n + 1; return d1239(m); }
+function d1241(n) { var m = n + 2; return d1240(m); }
+function d1242(n) { var m = n + 3; return d1241(m); }
+function d1243(n) { var m = n + 4; return d1242(m); }
+function d1244(n) { var m = n + 5; return d1243(m); }
+function d1245(n) { var m = n + 6; return d1244(m); }
+function d1246(n) { var m = n + 0; return d1245(m); }
+function d1247(n) { var m = n + 1; return d1246(m); }
+function d1248(n) { var m = n + 2; return d1247(m); }
+function d1249(n) { var m = n + 3; return d1248(m); }
+function d1250(n) { var m = n + 4; return d1249(m); }
+function d1251(n) { var m = n + 5; return d1250(m); }
+function d1252(n) { var m = n + 6; return d1251(m); }
+function d1253(n) { var m = n + 0; return d1252(m); }
+function d1254(n) { var m = n + 1; return d1253(m); }
+function d1255(n) { var m = n + 2; return d1254(m); }
+function d1256(n) { var m = n + 3; return d1255(m); }
+function d1257(n) { var m = n + 4; return d1256(m); }
+function d1258(n) { var m = n + 5; return d1257(m); }
+function d1259(n) { var m = n + 6; return d1258(m); }
+function d1260(n) { var m = n + 0; return d1259(m); }
+function d1261(n) { var m = n + 1; return d1260(m); }
+function d1262(n) { var m = n + 2; return d1261(m); }
+function d1263(n) { var m = n + 3; return d1262(m); }
+function d1264(n) { var m = n + 4; return d1263(m); }
+function d1265(n) { var m = n + 5; return d1264(m); }
+function d1266(n) { var m = n + 6; return d1265(m); }
+function d1267(n) { var m = n + 0; return d1266(m); }
+function d1268(n) { var m = n + 1; return d1267(m); }
+function d1269(n) { var m = n + 2; return d1268(m); }
+function d1270(n) { var m = n + 3; return d1269(m); }
+function d1271(n) { var m = n + 4; return d1270(m); }
+function d1272(n) { var m = n + 5; return d1271(m); }
+function d1273(n) { var m = n + 6; return d1272(m); }
+function d1274(n) { var m = n + 0; return d1273(m); }
+function d1275(n) { var m = n + 1; return d1274(m); }
+function d1276(n) { var m = n + 2; return d1275(m); }
+function d1277(n) { var m = n + 3; return d1276(m); }
+function d1278(n) { var m = n + 4; return d1277(m); }
+function d1279(n) { var m = n + 5; return d1278(m); }
+function d1280(n) { var m = n + 6; return d1279(m); }
+function d1281(n) { var m = n + 0; return d1280(m); }
+function d1282(n) { var m = n + 1; return d1281(m); }
+function d1283(n) { var m = n + 2; return d1282(m); }
+function d1284(n) { var m = n + 3; return d1283(m); }
+function d1285(n) { var m = n + 4; return d1284(m); }
+function d1286(n) { var m = n + 5; return d1285(m); }
+function d1287(n) { var m = n + 6; return d1286(m); }
+function d1288(n) { var m = n + 0; return d1287(m); }
+function d1289(n) { var m = n + 1; return d1288(m); }
+function d1290(n) { var m = n + 2; return d1289(m); }
+function d1291(n) { var m = n + 3; return d1290(m); }
+function d1292(n) { var m = n + 4; return d1291(m); }
+function d1293(n) { var m = n + 5; return d1292(m); }
+function d1294(n) { var m = n + 6; return d1293(m); }
+function d1295(n) { var m = n + 0; return d1294(m); }
+function d1296(n) { var m = n + 1; return d1295(m); }
+function d1297(n) { var m = n + 2; return d1296(m); }
+function d1298(n) { var m = n + 3; return d1297(m); }
+function d1299(n) { var m = n + 4; return d1298(m); }
+function d1300(n) { var m = n + 5; return d1299(m); }
+function d1301(n) { var m = n + 6; return d1300(m); }
+function d1302(n) { var m = n + 0; return d1301(m); }
+function d1303(n) { var m = n + 1; return d1302(m); }
+function d1304(n) { var m = n + 2; return d1303(m); }
+function d1305(n) { var m = n + 3; return d1304(m); }
+function d1306(n) { var m = n + 4; return d1305(m); }
+function d1307(n) { var m = n + 5; return d1306(m); }
+function d1308(n) { var m = n + 6; return d1307(m); }
+function d1309(n) { var m = n + 0; return d1308(m); }
+function d1310(n) { var m = n + 1; return d1309(m); }
+function d1311(n) { var m = n + 2; return d1310(m); }
+function d1312(n) { var m = n + 3; return d1311(m); }
+function d1313(n) { var m = n + 4; return d1312(m); }
+function d1314(n) { var m = n + 5; return d1313(m); }
+function d1315(n) { var m = n + 6; return d1314(m); }
+function d1316(n) { var m = n + 0; return d1315(m); }
+function d1317(n) { var m = n + 1; return d1316(m); }
+function d1318(n) { var m = n + 2; return d1317(m); }
+function d1319(n) { var m = n + 3; return d1318(m); }
+function d1320(n) { var m = n + 4; return d1319(m); }
+function d1321(n) { var m = n + 5; return d1320(m); }
+function d1322(n) { var m = n + 6; return d1321(m); }
+function d1323(n) { var m = n + 0; return d1322(m); }
+function d1324(n) { var m = n + 1; return d1323(m); }
+function d1325(n) { var m = n + 2; return d1324(m); }
+function d1326(n) { var m = n + 3; return d1325(m); }
+function d1327(n) { var m = n + 4; return d1326(m); }
+function d1328(n) { var m = n + 5; return d1327(m); }
+function d1329(n) { var m = n + 6; return d1328(m); }
+function d1330(n) { var m = n + 0; return d1329(m); }
+function d1331(n) { var m = n + 1; return d1330(m); }
+function d1332(n) { var m = n + 2; return d1331(m); }
+function d1333(n) { var m = n + 3; return d1332(m); }
+function d1334(n) { var m = n + 4; return d1333(m); }
+function d1335(n) { var m = n + 5; return d1334(m); }
+function d1336(n) { var m = n + 6; return d1335(m); }
+function d1337(n) { var m = n + 0; return d1336(m); }
+function d1338(n) { var m = n + 1; return d1337(m); }
+function d1339(n) { var m = n + 2; return d1338(m); }
+function d1340(n) { var m = n + 3; return d1339(m); }
+function d1341(n) { var m = n + 4; return d1340(m); }
+function d1342(n) { var m = n + 5; return d1341(m); }
+function d1343(n) { var m = n + 6; return d1342(m); }
+function d1344(n) { var m = n + 0; return d1343(m); }
+function d1345(n) { var m = n + 1; return d1344(m); }
+function d1346(n) { var m = n + 2; return d1345(m); }
+function d1347(n) { var m = n + 3; return d1346(m); }
+function d1348(n) { var m = n + 4; return d1347(m); }
+function d1349(n) { var m = n + 5; return d1348(m); }
+function d1350(n) { var m = n + 6; return d1349(m); }
+function d1351(n) { var m = n + 0; return d1350(m); }
+function d1352(n) { var m = n + 1; return d1351(m); }
+function d1353(n) { var m = n + 2; return d1352(m); }
+function d1354(n) { var m = n + 3; return d1353(m); }
+function d1355(n) { var m = n + 4; return d1354(m); }
+function d1356(n) { var m = n + 5; return d1355(m); }
+function d1357(n) { var m = n + 6; return d1356(m); }
+function d1358(n) { var m = n + 0; return d1357(m); }
+function d1359(n) { var m = n + 1; return d1358(m); }
+function d1360(n) { var m = n + 2; return d1359(m); }
+function d1361(n) { var m = n + 3; return d1360(m); }
+function d1362(n) { var m = n + 4; return d1361(m); }
+function d1363(n) { var m = n + 5; return d1362(m); }
+function d1364(n) { var m = n + 6; return d1363(m); }
+function d1365(n) { var m = n + 0; return d1364(m); }
+function d1366(n) { var m = n + 1; return d1365(m); }
+function d1367(n) { var m = n + 2; return d1366(m); }
+function d1368(n) { var m = n + 3; return d1367(m); }
+function d1369(n) { var m = n + 4; return d1368(m); }
+function d1370(n) { var m = n + 5; return d1369(m); }
+function d1371(n) { var m = n + 6; return d1370(m); }
+function d1372(n) { var m = n + 0; return d1371(m); }
+function d1373(n) { var m = n + 1; return d1372(m); }
+function d1374(n) { var m = n + 2; return d1373(m); }
+function d1375(n) { var m = n + 3; return d1374(m); }
+function d1376(n) { var m = n + 4; return d1375(m); }
+function d1377(n) { var m = n + 5; return d1376(m); }
+function d1378(n) { var m = n + 6; return d1377(m); }
+function d1379(n) { var m = n + 0; return d1378(m); }
+function d1380(n) { var m = n + 1; return d1379(m); }
+function d1381(n) { var m = n + 2; return d1380(m); }
+function d1382(n) { var m = n + 3; return d1381(m); }
+function d1383(n) { var m = n + 4; return d1382(m); }
+function d1384(n) { var m = n + 5; return d1383(m); }
+function d1385(n) { var m = n + 6; return d1384(m); }
+function d1386(n) { var m = n + 0; return d1385(m); }
+function d1387(n) { var m = n + 1; return d1386(m); }
+function d1388(n) { var m = n + 2; return d1387(m); }
+function d1389(n) { var m = n + 3; return d1388(m); }
+function d1390(n) { var m = n + 4; return d1389(m); }
+function d1391(n) { var m = n + 5; return d1390(m); }
+function d1392(n) { var m = n + 6; return d1391(m); }
+function d1393(n) { var m = n + 0; return d1392(m); }
+function d1394(n) { var m = n + 1; return d1393(m); }
+function d1395(n) { var m = n + 2; return d1394(m); }
+function d1396(n) { var m = n + 3; return d1395(m); }
+function d1397(n) { var m = n + 4; return d1396(m); }
+function d1398(n) { var m = n + 5; return d1397(m); }
+function d1399(n) { var m = n + 6; return d1398(m); }
+function d1400(n) { var m = n + 0; return d1399(m); }
+function d1401(n) { var m = n + 1; return d1400(m); }
+function d1402(n) { var m = n + 2; return d1401(m); }
+function d1403(n) { var m = n + 3; return d1402(m); }
+function d1404(n) { var m = n + 4; return d1403(m); }
+function d1405(n) { var m = n + 5; return d1404(m); }
+function d1406(n) { var m = n + 6; return d1405(m); }
+function d1407(n) { var m = n + 0; return d1406(m); }
+function d1408(n) { var m = n + 1; return d1407(m); }
+function d1409(n) { var m = n + 2; return d1408(m); }
+function d1410(n) { var m = n + 3; return d1409(m); }
+function d1411(n) { var m = n + 4; return d1410(m); }
+function d1412(n) { var m = n + 5; return d1411(m); }
+function d1413(n) { var m = n + 6; return d1412(m); }
+function d1414(n) { var m = n + 0; return d1413(m); }
+function d1415(n) { var m = n + 1; return d1414(m); }
+function d1416(n) { var m = n + 2; return d1415(m); }
+function d1417(n) { var m = n + 3; return d1416(m); }
+function d1418(n) { var m = n + 4; return d1417(m); }
+function d1419(n) { var m = n + 5; return d1418(m); }
+function d1420(n) { var m = n + 6; return d1419(m); }
+function d1421(n) { var m = n + 0; return d1420(m); }
+function d1422(n) { var m = n + 1; return d1421(m); }
+function d1423(n) { var m = n + 2; return d1422(m); }
+function d1424(n) { var m = n + 3; return d1423(m); }
+function d1425(n) { var m = n + 4; return d1424(m); }
+function d1426(n) { var m = n + 5; return d1425(m); }
+function d1427(n) { var m = n + 6; return d1426(m); }
+function d1428(n) { var m = n + 0; return d1427(m); }
+function d1429(n) { var m = n + 1; return d1428(m); }
+function d1430(n) { var m = n + 2; return d1429(m); }
+function d1431(n) { var m = n + 3; return d1430(m); }
+function d1432(n) { var m = n + 4; return d1431(m); }
+function d1433(n) { var m = n + 5; return d1432(m); }
+function d1434(n) { var m = n + 6; return d1433(m); }
+function d1435(n) { var m = n + 0; return d1434(m); }
+function d1436(n) { var m = n + 1; return d1435(m); }
+function d1437(n) { var m = n + 2; return d1436(m); }
+function d1438(n) { var m = n + 3; return d1437(m); }
+function d1439(n) { var m = n + 4; return d1438(m); }
+function d1440(n) { var m = n + 5; return d1439(m); }
+function d1441(n) { var m = n + 6; return d1440(m); }
+function d1442(n) { var m = n + 0; return d1441(m); }
+function d1443(n) { var m = n + 1; return d1442(m); }
+function d1444(n) { var m = n + 2; return d1443(m); }
+function d1445(n) { var m = n + 3; return d1444(m); }
+function d1446(n) { var m = n + 4; return d1445(m); }
+function d1447(n) { var m = n + 5; return d1446(m); }
+function d1448(n) { var m = n + 6; return d1447(m); }
+function d1449(n) { var m = n + 0; return d1448(m); }
+function d1450(n) { var m = n + 1; return d1449(m); }
+function d1451(n) { var m = n + 2; return d1450(m); }
+function d1452(n) { var m = n + 3; return d1451(m); }
+function d1453(n) { var m = n + 4; return d1452(m); }
+function d1454(n) { var m = n + 5; return d1453(m); }
+function d1455(n) { var m = n + 6; return d1454(m); }
+function d1456(n) { var m = n + 0; return d1455(m); }
+function d1457(n) { var m = n + 1; return d1456(m); }
+function d1458(n) { var m = n + 2; return d1457(m); }
+function d1459(n) { var m = n + 3; return d1458(m); }
+function d1460(n) { var m = n + 4; return d1459(m); }
+function d1461(n) { var m = n + 5; return d1460(m); }
+function d1462(n) { var m = n + 6; return d1461(m); }
+function d1463(n) { var m = n + 0; return d1462(m); }
+function d1464(n) { var m = n + 1; return d1463(m); }
+function d1465(n) { var m = n + 2; return d1464(m); }
+function d1466(n) { var m = n + 3; return d1465(m); }
+function d1467(n) { var m = n + 4; return d1466(m); }
+function d1468(n) { var m = n + 5; return d1467(m); }
+function d1469(n) { var m = n + 6; return d1468(m); }
+function d1470(n) { var m = n + 0; return d1469(m); }
+function d1471(n) { var m = n + 1; return d1470(m); }
+function d1472(n) { var m = n + 2; return d1471(m); }
+function d1473(n) { var m = n + 3; return d1472(m); }
+function d1474(n) { var m = n + 4; return d1473(m); }
+function d1475(n) { var m = n + 5; return d1474(m); }
+function d1476(n) { var m = n + 6; return d1475(m); }
+function d1477(n) { var m = n + 0; return d1476(m); }
+function d1478(n) { var m = n + 1; return d1477(m); }
+function d1479(n) { var m = n + 2; return d1478(m); }
+function d1480(n) { var m = n + 3; return d1479(m); }
+function d1481(n) { var m = n + 4; return d1480(m); }
+function d1482(n) { var m = n + 5; return d1481(m); }
+function d1483(n) { var m = n + 6; return d1482(m); }
+function d1484(n) { var m = n + 0; return d1483(m); }
+function d1485(n) { var m = n + 1; return d1484(m); }
+function d1486(n) { var m = n + 2; return d1485(m); }
+function d1487(n) { var m = n + 3; return d1486(m); }
+function d1488(n) { var m = n + 4; return d1487(m); }
+function d1489(n) { var m = n + 5; return d1488(m); }
+function d1490(n) { var m = n + 6; return d1489(m); }
+function d1491(n) { var m = n + 0; return d1490(m); }
+function d1492(n) { var m = n + 1; return d1491(m); }
+function d1493(n) { var m = n + 2; return d1492(m); }
+function d1494(n) { var m = n + 3; return d1493(m); }
+function d1495(n) { var m = n + 4; return d1494(m); }
+function d1496(n) { var m = n + 5; return d1495(m); }
+function d1497(n) { var m = n + 6; return d1496(m); }
+function d1498(n) { var m = n + 0; return d1497(m); }
+function d1499(n) { var m = n + 1; return d1498(m); }
+function d1500(n) { var m = n + 2; return d1499(m); }
+function d1501(n) { var m = n + 3; return d1500(m); }
+function d1502(n) { var m = n + 4; return d1501(m); }
+function d1503(n) { var m = n + 5; return d1502(m); }
+function d1504(n) { var m = n + 6; return d1503(m); }
+function d1505(n) { var m = n + 0; return d1504(m); }
+function d1506(n) { var m = n + 1; return d1505(m); }
+function d1507(n) { var m = n + 2; return d1506(m); }
+function d1508(n) { var m = n + 3; return d1507(m); }
+function d1509(n) { var m = n + 4; return d1508(m); }
+function d1510(n) { var m = n + 5; return d1509(m); }
+function d1511(n) { var m = n + 6; return d1510(m); }
+function d1512(n) { var m = n + 0; return d1511(m); }
+function d1513(n) { var m = n + 1; return d1512(m); }
+function d1514(n) { var m = n + 2; return d1513(m); }
+function d1515(n) { var m = n + 3; return d1514(m); }
+function d1516(n) { var m = n + 4; return d1515(m); }
+function d1517(n) { var m = n + 5; return d1516(m); }
+function d1518(n) { var m = n + 6; return d1517(m); }
+function d1519(n) { var m = n + 0; return d1518(m); }
+function d1520(n) { var m = n + 1; return d1519(m); }
+function d1521(n) { var m = n + 2; return d1520(m); }
+function d1522(n) { var m = n + 3; return d1521(m); }
+function d1523(n) { var m = n + 4; return d1522(m); }
+function d1524(n) { var m = n + 5; return d1523(m); }
+function d1525(n) { var m = n + 6; return d1524(m); }
+function d1526(n) { var m = n + 0; return d1525(m); }
+function d1527(n) { var m = n + 1; return d1526(m); }
+function d1528(n) { var m = n + 2; return d1527(m); }
+function d1529(n) { var m = n + 3; return d1528(m); }
+function d1530(n) { var m = n + 4; return d1529(m); }
+function d1531(n) { var m = n + 5; return d1530(m); }
+function d1532(n) { var m = n + 6; return d1531(m); }
+function d1533(n) { var m = n + 0; return d1532(m); }
+function d1534(n) { var m = n + 1; return d1533(m); }
+function d1535(n) { var m = n + 2; return d1534(m); }
+function d1536(n) { var m = n + 3; return d1535(m); }
+function d1537(n) { var m = n + 4; return d1536(m); }
+function d1538(n) { var m = n + 5; return d1537(m); }
+function d1539(n) { var m = n + 6; return d1538(m); }
+function d1540(n) { var m = n + 0; return d1539(m); }
+function d1541(n) { var m = n + 1; return d1540(m); }
+function d1542(n) { var m = n + 2; return d1541(m); }
+function d1543(n) { var m = n + 3; return d1542(m); }
+function d1544(n) { var m = n + 4; return d1543(m); }
+function d1545(n) { var m = n + 5; return d1544(m); }
+function d1546(n) { var m = n + 6; return d1545(m); }
+function d1547(n) { var m = n + 0; return d1546(m); }
+function d1548(n) { var m = n + 1; return d1547(m); }
+function d1549(n) { var m = n + 2; return d1548(m); }
+function d1550(n) { var m = n + 3; return d1549(m); }
+function d1551(n) { var m = n + 4; return d1550(m); }
+function d1552(n) { var m = n + 5; return d1551(m); }
+function d1553(n) { var m = n + 6; return d1552(m); }
+function d1554(n) { var m = n + 0; return d1553(m); }
+function d1555(n) { var m = n + 1; return d1554(m); }
+function d1556(n) { var m = n + 2; return d1555(m); }
+function d1557(n) { var m = n + 3; return d1556(m); }
+function d1558(n) { var m = n + 4; return d1557(m); }
+function d1559(n) { var m = n + 5; return d1558(m); }
+function d1560(n) { var m = n + 6; return d1559(m); }
+function d1561(n) { var m = n + 0; return d1560(m); }
+function d1562(n) { var m = n + 1; return d1561(m); }
+function d1563(n) { var m = n + 2; return d1562(m); }
+function d1564(n) { var m = n + 3; return d1563(m); }
+function d1565(n) { var m = n + 4; return d1564(m); }
+function d1566(n) { var m = n + 5; return d1565(m); }
+function d1567(n) { var m = n + 6; return d1566(m); }
+function d1568(n) { var m = n + 0; return d1567(m); }
+function d1569(n) { var m = n + 1; return d1568(m); }
+function d1570(n) { var m = n + 2; return d1569(m); }
+function d1571(n) { var m = n + 3; return d1570(m); }
+function d1572(n) { var m = n + 4; return d1571(m); }
+function d1573(n) { var m = n + 5; return d1572(m); }
+function d1574(n) { var m = n + 6; return d1573(m); }
+function d1575(n) { var m = n + 0; return d1574(m); }
+function d1576(n) { var m = n + 1; return d1575(m); }
+function d1577(n) { var m = n + 2; return d1576(m); }
+function d1578(n) { var m = n + 3; return d1577(m); }
+function d1579(n) { var m = n + 4; return d1578(m); }
+function d1580(n) { var m = n + 5; return d1579(m); }
+function d1581(n) { var m = n + 6; return d1580(m); }
+function d1582(n) { var m = n + 0; return d1581(m); }
+function d1583(n) { var m = n + 1; return d1582(m); }
+function d1584(n) { var m = n + 2; return d1583(m); }
+function d1585(n) { var m = n + 3; return d1584(m); }
+function d1586(n) { var m = n + 4; return d1585(m); }
+function d1587(n) { var m = n + 5; return d1586(m); }
+function d1588(n) { var m = n + 6; return d1587(m); }
+function d1589(n) { var m = n + 0; return d1588(m); }
+function d1590(n) { var m = n + 1; return d1589(m); }
+function d1591(n) { var m = n + 2; return d1590(m); }
+function d1592(n) { var m = n + 3; return d1591(m); }
+function d1593(n) { var m = n + 4; return d1592(m); }
+function d1594(n) { var m = n + 5; return d1593(m); }
+function d1595(n) { var m = n + 6; return d1594(m); }
+function d1596(n) { var m = n + 0; return d1595(m); }
+function d1597(n) { var m = n + 1; return d1596(m); }
+function d1598(n) { var m = n + 2; return d1597(m); }
+function d1599(n) { var m = n + 3; return d1598(m); }
+function d1600(n) { var m = n + 4; return d1599(m); }
+function d1601(n) { var m = n + 5; return d1600(m); }
+function d1602(n) { var m = n + 6; return d1601(m); }
+function d1603(n) { var m = n + 0; return d1602(m); }
+function d1604(n) { var m = n + 1; return d1603(m); }
+function d1605(n) { var m = n + 2; return d1604(m); }
+function d1606(n) { var m = n + 3; return d1605(m); }
+function d1607(n) { var m = n + 4; return d1606(m); }
+function d1608(n) { var m = n + 5; return d1607(m); }
+function d1609(n) { var m = n + 6; return d1608(m); }
+function d1610(n) { var m = n + 0; return d1609(m); }
+function d1611(n) { var m = n + 1; return d1610(m); }
+function d1612(n) { var m = n + 2; return d1611(m); }
+function d1613(n) { var m = n + 3; return d1612(m); }
+function d1614(n) { var m = n + 4; return d1613(m); }
+function d1615(n) { var m = n + 5; return d1614(m); }
+function d1616(n) { var m = n + 6; return d1615(m); }
+function d1617(n) { var m = n + 0; return d1616(m); }
+function d1618(n) { var m = n + 1; return d1617(m); }
+function d1619(n) { var m = n + 2; return d1618(m); }
+function d1620(n) { var m = n + 3; return d1619(m); }
+function d1621(n) { var m = n + 4; return d1620(m); }
+function d1622(n) { var m = n + 5; return d1621(m); }
+function d1623(n) { var m = n + 6; return d1622(m); }
+function d1624(n) { var m = n + 0; return d1623(m); }
+function d1625(n) { var m = n + 1; return d1624(m); }
+function d1626(n) { var m = n + 2; return d1625(m); }
+function d1627(n) { var m = n + 3; return d1626(m); }
+function d1628(n) { var m = n + 4; return d1627(m); }
+function d1629(n) { var m = n + 5; return d1628(m); }
+function d1630(n) { var m = n + 6; return d1629(m); }
+function d1631(n) { var m = n + 0; return d1630(m); }
+function d1632(n) { var m = n + 1; return d1631(m); }
+function d1633(n) { var m = n + 2; return d1632(m); }
+function d1634(n) { var m = n + 3; return d1633(m); }
+function d1635(n) { var m = n + 4; return d1634(m); }
+function d1636(n) { var m = n + 5; return d1635(m); }
+function d1637(n) { var m = n + 6; return d1636(m); }
+function d1638(n) { var m = n + 0; return d1637(m); }
+function d1639(n) { var m = n + 1; return d1638(m); }
+function d1640(n) { var m = n + 2; return d1639(m); }
+function d1641(n) { var m = n + 3; return d1640(m); }
+function d1642(n) { var m = n + 4; return d1641(m); }
+function d1643(n) { var m = n + 5; return d1642(m); }
+function d1644(n) { var m = n + 6; return d1643(m); }
+function d1645(n) { var m = n + 0; return d1644(m); }
+function d1646(n) { var m = n + 1; return d1645(m); }
+function d1647(n) { var m = n + 2; return d1646(m); }
+function d1648(n) { var m = n + 3; return d1647(m); }
+function d1649(n) { var m = n + 4; return d1648(m); }
+function d1650(n) { var m = n + 5; return d1649(m); }
+function d1651(n) { var m = n + 6; return d1650(m); }
+function d1652(n) { var m = n + 0; return d1651(m); }
+function d1653(n) { var m = n + 1; return d1652(m); }
+function d1654(n) { var m = n + 2; return d1653(m); }
+function d1655(n) { var m = n + 3; return d1654(m); }
+function d1656(n) { var m = n + 4; return d1655(m); }
+function d1657(n) { var m = n + 5; return d1656(m); }
+function d1658(n) { var m = n + 6; return d1657(m); }
+function d1659(n) { var m = n + 0; return d1658(m); }
+function d1660(n) { var m = n + 1; return d1659(m); }
+function d1661(n) { var m = n + 2; return d1660(m); }
+function d1662(n) { var m = n + 3; return d1661(m); }
+function d1663(n) { var m = n + 4; return d1662(m); }
+function d1664(n) { var m = n + 5; return d1663(m); }
+function d1665(n) { var m = n + 6; return d1664(m); }
+function d1666(n) { var m = n + 0; return d1665(m); }
+function d1667(n) { var m = n + 1; return d1666(m); }
+function d1668(n) { var m = n + 2; return d1667(m); }
+function d1669(n) { var m = n + 3; return d1668(m); }
+function d1670(n) { var m = n + 4; return d1669(m); }
+function d1671(n) { var m = n + 5; return d1670(m); }
+function d1672(n) { var m = n + 6; return d1671(m); }
+function d1673(n) { var m = n + 0; return d1672(m); }
+function d1674(n) { var m = n + 1; return d1673(m); }
+function d1675(n) { var m = n + 2; return d1674(m); }
+function d1676(n) { var m = n + 3; return d1675(m); }
+function d1677(n) { var m = n + 4; return d1676(m); }
+function d1678(n) { var m = n + 5; return d1677(m); }
+function d1679(n) { var m = n + 6; return d1678(m); }
+function d1680(n) { var m = n + 0; return d1679(m); }
+function d1681(n) { var m = n + 1; return d1680(m); }
+function d1682(n) { var m = n + 2; return d1681(m); }
+function d1683(n) { var m = n + 3; return d1682(m); }
+function d1684(n) { var m = n + 4; return d1683(m); }
+function d1685(n) { var m = n + 5; return d1684(m); }
+function d1686(n) { var m = n + 6; return d1685(m); }
+function d1687(n) { var m = n + 0; return d1686(m); }
+function d1688(n) { var m = n + 1; return d1687(m); }
+function d1689(n) { var m = n + 2; return d1688(m); }
+function d1690(n) { var m = n + 3; return d1689(m); }
+function d1691(n) { var m = n + 4; return d1690(m); }
+function d1692(n) { var m = n + 5; return d1691(m); }
+function d1693(n) { var m = n + 6; return d1692(m); }
+function d1694(n) { var m = n + 0; return d1693(m); }
+function d1695(n) { var m = n + 1; return d1694(m); }
+function d1696(n) { var m = n + 2; return d1695(m); }
+function d1697(n) { var m = n + 3; return d1696(m); }
+function d1698(n) { var m = n + 4; return d1697(m); }
+function d1699(n) { var m = n + 5; return d1698(m); }
+function d1700(n) { var m = n + 6; return d1699(m); }
+function d1701(n) { var m = n + 0; return d1700(m); }
+function d1702(n) { var m = n + 1; return d1701(m); }
+function d1703(n) { var m = n + 2; return d1702(m); }
+function d1704(n) { var m = n + 3; return d1703(m); }
+function d1705(n) { var m = n + 4; return d1704(m); }
+function d1706(n) { var m = n + 5; return d1705(m); }
+function d1707(n) { var m = n + 6; return d1706(m); }
+function d1708(n) { var m = n + 0; return d1707(m); }
+function d1709(n) { var m = n + 1; return d1708(m); }
+function d1710(n) { var m = n + 2; return d1709(m); }
+function d1711(n) { var m = n + 3; return d1710(m); }
+function d1712(n) { var m = n + 4; return d1711(m); }
+function d1713(n) { var m = n + 5; return d1712(m); }
+function d1714(n) { var m = n + 6; return d1713(m); }
+function d1715(n) { var m = n + 0; return d1714(m); }
+function d1716(n) { var m = n + 1; return d1715(m); }
+function d1717(n) { var m = n + 2; return d1716(m); }
+function d1718(n) { var m = n + 3; return d1717(m); }
+function d1719(n) { var m = n + 4; return d1718(m); }
+function d1720(n) { var m = n + 5; return d1719(m); }
+function d1721(n) { var m = n + 6; return d1720(m); }
+function d1722(n) { var m = n + 0; return d1721(m); }
+function d1723(n) { var m = n + 1; return d1722(m); }
+function d1724(n) { var m = n + 2; return d1723(m); }
+function d1725(n) { var m = n + 3; return d1724(m); }
+function d1726(n) { var m = n + 4; return d1725(m); }
+function d1727(n) { var m = n + 5; return d1726(m); }
+function d1728(n) { var m = n + 6; return d1727(m); }
+function d1729(n) { var m = n + 0; return d1728(m); }
+function d1730(n) { var m = n + 1; return d1729(m); }
+function d1731(n) { var m = n + 2; return d1730(m); }
+function d1732(n) { var m = n + 3; return d1731(m); }
+function d1733(n) { var m = n + 4; return d1732(m); }
+function d1734(n) { var m = n + 5; return d1733(m); }
+function d1735(n) { var m = n + 6; return d1734(m); }
+function d1736(n) { var m = n + 0; return d1735(m); }
+function d1737(n) { var m = n + 1; return d1736(m); }
+function d1738(n) { var m = n + 2; return d1737(m); }
+function d1739(n) { var m = n + 3; return d1738(m); }
+function d1740(n) { var m = n + 4; return d1739(m); }
+function d1741(n) { var m = n + 5; return d1740(m); }
+function d1742(n) { var m = n + 6; return d1741(m); }
+function d1743(n) { var m = n + 0; return d1742(m); }
+function d1744(n) { var m = n + 1; return d1743(m); }
+function d1745(n) { var m = n + 2; return d1744(m); }
+function d1746(n) { var m = n + 3; return d1745(m); }
+function d1747(n) { var m = n + 4; return d1746(m); }
+function d1748(n) { var m = n + 5; return d1747(m); }
+function d1749(n) { var m = n + 6; return d1748(m); }
+function d1750(n) { var m = n + 0; return d1749(m); }
+function d1751(n) { var m = n + 1; return d1750(m); }
+function d1752(n) { var m = n + 2; return d1751(m); }
+function d1753(n) { var m = n + 3; return d1752(m); }
+function d1754(n) { var m = n + 4; return d1753(m); }
+function d1755(n) { var m = n + 5; return d1754(m); }
+function d1756(n) { var m = n + 6; return d1755(m); }
+function d1757(n) { var m = n + 0; return d1756(m); }
+function d1758(n) { var m = n + 1; return d1757(m); }
+function d1759(n) { var m = n + 2; return d1758(m); }
+function d1760(n) { var m = n + 3; return d1759(m); }
+function d1761(n) { var m = n + 4; return d1760(m); }
+function d1762(n) { var m = n + 5; return d1761(m); }
+function d1763(n) { var m = n + 6; return d1762(m); }
+function d1764(n) { var m = n + 0; return d1763(m); }
+function d1765(n) { var m = n + 1; return d1764(m); }
+function d1766(n) { var m = n + 2; return d1765(m); }
+function d1767(n) { var m = n + 3; return d1766(m); }
+function d1768(n) { var m = n + 4; return d1767(m); }
+function d1769(n) { var m = n + 5; return d1768(m); }
+function d1770(n) { var m = n + 6; return d1769(m); }
+function d1771(n) { var m = n + 0; return d1770(m); }
+function d1772(n) { var m = n + 1; return d1771(m); }
+function d1773(n) { var m = n + 2; return d1772(m); }
+function d1774(n) { var m = n + 3; return d1773(m); }
+function d1775(n) { var m = n + 4; return d1774(m); }
+function d1776(n) { var m = n + 5; return d1775(m); }
+function d1777(n) { var m = n + 6; return d1776(m); }
+function d1778(n) { var m = n + 0; return d1777(m); }
+function d1779(n) { var m = n + 1; return d1778(m); }
+function d1780(n) { var m = n + 2; return d1779(m); }
+function d1781(n) { var m = n + 3; return d1780(m); }
+function d1782(n) { var m = n + 4; return d1781(m); }
+function d1783(n) { var m = n + 5; return d1782(m); }
+function d1784(n) { var m = n + 6; return d1783(m); }
+function d1785(n) { var m = n + 0; return d1784(m); }
+function d1786(n) { var m = n + 1; return d1785(m); }
+function d1787(n) { var m = n + 2; return d1786(m); }
+function d1788(n) { var m = n + 3; return d1787(m); }
+function d1789(n) { var m = n + 4; return d1788(m); }
+function d1790(n) { var m = n + 5; return d1789(m); }
+function d1791(n) { var m = n + 6; return d1790(m); }
+function d1792(n) { var m = n + 0; return d1791(m); }
+function d1793(n) { var m = n + 1; return d1792(m); }
+function d1794(n) { var m = n + 2; return d1793(m); }
+function d1795(n) { var m = n + 3; return d1794(m); }
+function d1796(n) { var m = n + 4; return d1795(m); }
+function d1797(n) { var m = n + 5; return d1796(m); }
+function d1798(n) { var m = n + 6; return d1797(m); }
+function d1799(n) { var m = n + 0; return d1798(m); }
+function d1800(n) { var m = n + 1; return d1799(m); }
+function d1801(n) { var m = n + 2; return d1800(m); }
+function d1802(n) { var m = n + 3; return d1801(m); }
+function d1803(n) { var m = n + 4; return d1802(m); }
+function d1804(n) { var m = n + 5; return d1803(m); }
+function d1805(n) { var m = n + 6; return d1804(m); }
+function d1806(n) { var m = n + 0; return d1805(m); }
+function d1807(n) { var m = n + 1; return d1806(m); }
+function d1808(n) { var m = n + 2; return d1807(m); }
+function d1809(n) { var m = n + 3; return d1808(m); }
+function d1810(n) { var m = n + 4; return d1809(m); }
+function d1811(n) { var m = n + 5; return d1810(m); }
+function d1812(n) { var m = n + 6; return d1811(m); }
+function d1813(n) { var m = n + 0; return d1812(m); }
+function d1814(n) { var m = n + 1; return d1813(m); }
+function d1815(n) { var m = n + 2; return d1814(m); }
+function d1816(n) { var m = n + 3; return d1815(m); }
+function d1817(n) { var m = n + 4; return d1816(m); }
+function d1818(n) { var m = n + 5; return d1817(m); }
+function d1819(n) { var m = n + 6; return d1818(m); }
+function d1820(n) { var m = n + 0; return d1819(m); }
+function d1821(n) { var m = n + 1; return d1820(m); }
+function d1822(n) { var m = n + 2; return d1821(m); }
+function d1823(n) { var m = n + 3; return d1822(m); }
+function d1824(n) { var m = n + 4; return d1823(m); }
+function d1825(n) { var m = n + 5; return d1824(m); }
+function d1826(n) { var m = n + 6; return d1825(m); }
+function d1827(n) { var m = n + 0; return d1826(m); }
+function d1828(n) { var m = n + 1; return d1827(m); }
+function d1829(n) { var m = n + 2; return d1828(m); }
+function d1830(n) { var m = n + 3; return d1829(m); }
+function d1831(n) { var m = n + 4; return d1830(m); }
+function d1832(n) { var m = n + 5; return d1831(m); }
+function d1833(n) { var m = n + 6; return d1832(m); }
+function d1834(n) { var m = n + 0; return d1833(m); }
+function d1835(n) { var m = n + 1; return d1834(m); }
+function d1836(n) { var m = n + 2; return d1835(m); }
+function d1837(n) { var m = n + 3; return d1836(m); }
+function d1838(n) { var m = n + 4; return d1837(m); }
+function d1839(n) { var m = n + 5; return d1838(m); }
+function d1840(n) { var m = n + 6; return d1839(m); }
+function d1841(n) { var m = n + 0; return d1840(m); }
+function d1842(n) { var m = n + 1; return d1841(m); }
+function d1843(n) { var m = n + 2; return d1842(m); }
+function d1844(n) { var m = n + 3; return d1843(m); }
+function d1845(n) { var m = n + 4; return d1844(m); }
+function d1846(n) { var m = n + 5; return d1845(m); }
+function d1847(n) { var m = n + 6; return d1846(m); }
+function d1848(n) { var m = n + 0; return d1847(m); }
+function d1849(n) { var m = n + 1; return d1848(m); }
+function d1850(n) { var m = n + 2; return d1849(m); }
+function d1851(n) { var m = n + 3; return d1850(m); }
+function d1852(n) { var m = n + 4; return d1851(m); }
+function d1853(n) { var m = n + 5; return d1852(m); }
+function d1854(n) { var m = n + 6; return d1853(m); }
+function d1855(n) { var m = n + 0; return d1854(m); }
+function d1856(n) { var m = n + 1; return d1855(m); }
+function d1857(n) { var m = n + 2; return d1856(m); }
+function d1858(n) { var m = n + 3; return d1857(m); }
+function d1859(n) { var m = n + 4; return d1858(m); }
+function d1860(n) { var m = n + 5; return d1859(m); }
+function d1861(n) { var m = n + 6; return d1860(m); }
+function d1862(n) { var m = n + 0; return d1861(m); }
+function d1863(n) { var m = n + 1; return d1862(m); }
+function d1864(n) { var m = n + 2; return d1863(m); }
+function d1865(n) { var m = n + 3; return d1864(m); }
+function d1866(n) { var m = n + 4; return d1865(m); }
+function d1867(n) { var m = n + 5; return d1866(m); }
+function d1868(n) { var m = n + 6; return d1867(m); }
+function d1869(n) { var m = n + 0; return d1868(m); }
+function d1870(n) { var m = n + 1; return d1869(m); }
+function d1871(n) { var m = n + 2; return d1870(m); }
+function d1872(n) { var m = n + 3; return d1871(m); }
+function d1873(n) { var m = n + 4; return d1872(m); }
+function d1874(n) { var m = n + 5; return d1873(m); }
+function d1875(n) { var m = n + 6; return d1874(m); }
+function d1876(n) { var m = n + 0; return d1875(m); }
+function d1877(n) { var m = n + 1; return d1876(m); }
+function d1878(n) { var m = n + 2; return d1877(m); }
+function d1879(n) { var m = n + 3; return d1878(m); }
+function d1880(n) { var m = n + 4; return d1879(m); }
+function d1881(n) { var m = n + 5; return d1880(m); }
+function d1882(n) { var m = n + 6; return d1881(m); }
+function d1883(n) { var m = n + 0; return d1882(m); }
+function d1884(n) { var m = n + 1; return d1883(m); }
+function d1885(n) { var m = n + 2; return d1884(m); }
+function d1886(n) { var m = n + 3; return d1885(m); }
+function d1887(n) { var m = n + 4; return d1886(m); }
+function d1888(n) { var m = n + 5; return d1887(m); }
+function d1889(n) { var m = n + 6; return d1888(m); }
+function d1890(n) { var m = n + 0; return d1889(m); }
+function d1891(n) { var m = n + 1; return d1890(m); }
+function d1892(n) { var m = n + 2; return d1891(m); }
+function d1893(n) { var m = n + 3; return d1892(m); }
+function d1894(n) { var m = n + 4; return d1893(m); }
+function d1895(n) { var m = n + 5; return d1894(m); }
+function d1896(n) { var m = n + 6; return d1895(m); }
+function d1897(n) { var m = n + 0; return d1896(m); }
+function d1898(n) { var m = n + 1; return d1897(m); }
+function d1899(n) { var m = n + 2; return d1898(m); }
+function d1900(n) { var m = n + 3; return d1899(m); }
+function d1901(n) { var m = n + 4; return d1900(m); }
+function d1902(n) { var m = n + 5; return d1901(m); }
+function d1903(n) { var m = n + 6; return d1902(m); }
+function d1904(n) { var m = n + 0; return d1903(m); }
+function d1905(n) { var m = n + 1; return d1904(m); }
+function d1906(n) { var m = n + 2; return d1905(m); }
+function d1907(n) { var m = n + 3; return d1906(m); }
+function d1908(n) { var m = n + 4; return d1907(m); }
+function d1909(n) { var m = n + 5; return d1908(m); }
+function d1910(n) { var m = n + 6; return d1909(m); }
+function d1911(n) { var m = n + 0; return d1910(m); }
+function d1912(n) { var m = n + 1; return d1911(m); }
+function d1913(n) { var m = n + 2; return d1912(m); }
+function d1914(n) { var m = n + 3; return d1913(m); }
+function d1915(n) { var m = n + 4; return d1914(m); }
+function d1916(n) { var m = n + 5; return d1915(m); }
+function d1917(n) { var m = n + 6; return d1916(m); }
+function d1918(n) { var m = n + 0; return d1917(m); }
+function d1919(n) { var m = n + 1; return d1918(m); }
+function d1920(n) { var m = n + 2; return d1919(m); }
+function d1921(n) { var m = n + 3; return d1920(m); }
+function d1922(n) { var m = n + 4; return d1921(m); }
+function d1923(n) { var m = n + 5; return d1922(m); }
+function d1924(n) { var m = n + 6; return d1923(m); }
+function d1925(n) { var m = n + 0; return d1924(m); }
+function d1926(n) { var m = n + 1; return d1925(m); }
+function d1927(n) { var m = n + 2; return d1926(m); }
+function d1928(n) { var m = n + 3; return d1927(m); }
+function d1929(n) { var m = n + 4; return d1928(m); }
+function d1930(n) { var m = n + 5; return d1929(m); }
+function d1931(n) { var m = n + 6; return d1930(m); }
+function d1932(n) { var m = n + 0; return d1931(m); }
+function d1933(n) { var m = n + 1; return d1932(m); }
+function d1934(n) { var m = n + 2; return d1933(m); }
+function d1935(n) { var m = n + 3; return d1934(m); }
+function d1936(n) { var m = n + 4; return d1935(m); }
+function d1937(n) { var m = n + 5; return d1936(m); }
+function d1938(n) { var m = n + 6; return d1937(m); }
+function d1939(n) { var m = n + 0; return d1938(m); }
+function d1940(n) { var m = n + 1; return d1939(m); }
+function d1941(n) { var m = n + 2; return d1940(m); }
+function d1942(n) { var m = n + 3; return d1941(m); }
+function d1943(n) { var m = n + 4; return d1942(m); }
+function d1944(n) { var m = n + 5; return d1943(m); }
+function d1945(n) { var m = n + 6; return d1944(m); }
+function d1946(n) { var m = n + 0; return d1945(m); }
+function d1947(n) { var m = n + 1; return d1946(m); }
+function d1948(n) { var m = n + 2; return d1947(m); }
+function d1949(n) { var m = n + 3; return d1948(m); }
+function d1950(n) { var m = n + 4; return d1949(m); }
+function d1951(n) { var m = n + 5; return d1950(m); }
+function d1952(n) { var m = n + 6; return d1951(m); }
+function d1953(n) { var m = n + 0; return d1952(m); }
+function d1954(n) { var m = n + 1; return d1953(m); }
+function d1955(n) { var m = n + 2; return d1954(m); }
+function d1956(n) { var m = n + 3; return d1955(m); }
+function d1957(n) { var m = n + 4; return d1956(m); }
+function d1958(n) { var m = n + 5; return d1957(m); }
+function d1959(n) { var m = n + 6; return d1958(m); }
+function d1960(n) { var m = n + 0; return d1959(m); }
+function d1961(n) { var m = n + 1; return d1960(m); }
+function d1962(n) { var m = n + 2; return d1961(m); }
+function d1963(n) { var m = n + 3; return d1962(m); }
+function d1964(n) { var m = n + 4; return d1963(m); }
+function d1965(n) { var m = n + 5; return d1964(m); }
+function d1966(n) { var m = n + 6; return d1965(m); }
+function d1967(n) { var m = n + 0; return d1966(m); }
+function d1968(n) { var m = n + 1; return d1967(m); }
+function d1969(n) { var m = n + 2; return d1968(m); }
+function d1970(n) { var m = n + 3; return d1969(m); }
+function d1971(n) { var m = n + 4; return d1970(m); }
+function d1972(n) { var m = n + 5; return d1971(m); }
+function d1973(n) { var m = n + 6; return d1972(m); }
+function d1974(n) { var m = n + 0; return d1973(m); }
+function d1975(n) { var m = n + 1; return d1974(m); }
+function d1976(n) { var m = n + 2; return d1975(m); }
+function d1977(n) { var m = n + 3; return d1976(m); }
+function d1978(n) { var m = n + 4; return d1977(m); }
+function d1979(n) { var m = n + 5; return d1978(m); }
+function d1980(n) { var m = n + 6; return d1979(m); }
+function d1981(n) { var m = n + 0; return d1980(m); }
+function d1982(n) { var m = n + 1; return d1981(m); }
+function d1983(n) { var m = n + 2; return d1982(m); }
+function d1984(n) { var m = n + 3; return d1983(m); }
+function d1985(n) { var m = n + 4; return d1984(m); }
+function d1986(n) { var m = n + 5; return d1985(m); }
+function d1987(n) { var m = n + 6; return d1986(m); }
+function d1988(n) { var m = n + 0; return d1987(m); }
+function d1989(n) { var m = n + 1; return d1988(m); }
+function d1990(n) { var m = n + 2; return d1989(m); }
+function d1991(n) { var m = n + 3; return d1990(m); }
+function d1992(n) { var m = n + 4; return d1991(m); }
+function d1993(n) { var m = n + 5; return d1992(m); }
+function d1994(n) { var m = n + 6; return d1993(m); }
+function d1995(n) { var m = n + 0; return d1994(m); }
+function d1996(n) { var m = n + 1; return d1995(m); }
+function d1997(n) { var m = n + 2; return d1996(m); }
+function d1998(n) { var m = n + 3; return d1997(m); }
+function d1999(n) { var m = n + 4; return d1998(m); }
+function d2000(n) { var m = n + 5; return d1999(m); }
+function d2001(n) { var m = n + 6; return d2000(m); }
+function d2002(n) { var m = n + 0; return d2001(m); }
+function d2003(n) { var m = n + 1; return d2002(m); }
+function d2004(n) { var m = n + 2; return d2003(m); }
+function d2005(n) { var m = n + 3; return d2004(m); }
+function d2006(n) { var m = n + 4; return d2005(m); }
+function d2007(n) { var m = n + 5; return d2006(m); }
+function d2008(n) { var m = n + 6; return d2007(m); }
+function d2009(n) { var m = n + 0; return d2008(m); }
+function d2010(n) { var m = n + 1; return d2009(m); }
+function d2011(n) { var m = n + 2; return d2010(m); }
+function d2012(n) { var m = n + 3; return d2011(m); }
+function d2013(n) { var m = n + 4; return d2012(m); }
+function d2014(n) { var m = n + 5; return d2013(m); }
+function d2015(n) { var m = n + 6; return d2014(m); }
+function d2016(n) { var m = n + 0; return d2015(m); }
+function d2017(n) { var m = n + 1; return d2016(m); }
+function d2018(n) { var m = n + 2; return d2017(m); }
+function d2019(n) { var m = n + 3; return d2018(m); }
+function d2020(n) { var m = n + 4; return d2019(m); }
+function d2021(n) { var m = n + 5; return d2020(m); }
+function d2022(n) { var m = n + 6; return d2021(m); }
+function d2023(n) { var m = n + 0; return d2022(m); }
+function d2024(n) { var m = n + 1; return d2023(m); }
+function d2025(n) { var m = n + 2; return d2024(m); }
+function d2026(n) { var m = n + 3; return d2025(m); }
+function d2027(n) { var m = n + 4; return d2026(m); }
+function d2028(n) { var m = n + 5; return d2027(m); }
+function d2029(n) { var m = n + 6; return d2028(m); }
+function d2030(n) { var m = n + 0; return d2029(m); }
+function d2031(n) { var m = n + 1; return d2030(m); }
+function d2032(n) { var m = n + 2; return d2031(m); }
+function d2033(n) { var m = n + 3; return d2032(m); }
+function d2034(n) { var m = n + 4; return d2033(m); }
+function d2035(n) { var m = n + 5; return d2034(m); }
+function d2036(n) { var m = n + 6; return d2035(m); }
+function d2037(n) { var m = n + 0; return d2036(m); }
+function d2038(n) { var m = n + 1; return d2037(m); }
+function d2039(n) { var m = n + 2; return d2038(m); }
+function d2040(n) { var m = n + 3; return d2039(m); }
+function d2041(n) { var m = n + 4; return d2040(m); }
+function d2042(n) { var m = n + 5; return d2041(m); }
+function d2043(n) { var m = n + 6; return d2042(m); }
+function d2044(n) { var m = n + 0; return d2043(m); }
+function d2045(n) { var m = n + 1; return d2044(m); }
+function d2046(n) { var m = n + 2; return d2045(m); }
+function d2047(n) { var m = n + 3; return d2046(m); }
+function d2048(n) { var m = n + 4; return d2047(m); }
+function d2049(n) { var m = n + 5; return d2048(m); }
+function d2050(n) { var m = n + 6; return d2049(m); }
+function d2051(n) { var m = n + 0; return d2050(m); }
+function d2052(n) { var m = n + 1; return d2051(m); }
+function d2053(n) { var m = n + 2; return d2052(m); }
+function d2054(n) { var m = n + 3; return d2053(m); }
+function d2055(n) { var m = n + 4; return d2054(m); }
+function d2056(n) { var m = n + 5; return d2055(m); }
+function d2057(n) { var m = n + 6; return d2056(m); }
+function d2058(n) { var m = n + 0; return d2057(m); }
+function d2059(n) { var m = n + 1; return d2058(m); }
+function d2060(n) { var m = n + 2; return d2059(m); }
+function d2061(n) { var m = n + 3; return d2060(m); }
+function d2062(n) { var m = n + 4; return d2061(m); }
+function d2063(n) { var m = n + 5; return d2062(m); }
+function d2064(n) { var m = n + 6; return d2063(m); }
+function d2065(n) { var m = n + 0; return d2064(m); }
+function d2066(n) { var m = n + 1; return d2065(m); }
+function d2067(n) { var m = n + 2; return d2066(m); }
+function d2068(n) { var m = n + 3; return d2067(m); }
+function d2069(n) { var m = n + 4; return d2068(m); }
+function d2070(n) { var m = n + 5; return d2069(m); }
+function d2071(n) { var m = n + 6; return d2070(m); }
+function d2072(n) { var m = n + 0; return d2071(m); }
+function d2073(n) { var m = n + 1; return d2072(m); }
+function d2074(n) { var m = n + 2; return d2073(m); }
+function d2075(n) { var m = n + 3; return d2074(m); }
+function d2076(n) { var m = n + 4; return d2075(m); }
+function d2077(n) { var m = n + 5; return d2076(m); }
+function d2078(n) { var m = n + 6; return d2077(m); }
+function d2079(n) { var m = n + 0; return d2078(m); }
+function d2080(n) { var m = n + 1; return d2079(m); }
+function d2081(n) { var m = n + 2; return d2080(m); }
+function d2082(n) { var m = n + 3; return d2081(m); }
+function d2083(n) { var m = n + 4; return d2082(m); }
+function d2084(n) { var m = n + 5; return d2083(m); }
+function d2085(n) { var m = n + 6; return d2084(m); }
+function d2086(n) { var m = n + 0; return d2085(m); }
+function d2087(n) { var m = n + 1; return d2086(m); }
+function d2088(n) { var m = n + 2; return d2087(m); }
+function d2089(n) { var m = n + 3; return d2088(m); }
+function d2090(n) { var m = n + 4; return d2089(m); }
+function d2091(n) { var m = n + 5; return d2090(m); }
+function d2092(n) { var m = n + 6; return d2091(m); }
+function d2093(n) { var m = n + 0; return d2092(m); }
+function d2094(n) { var m = n + 1; return d2093(m); }
+function d2095(n) { var m = n + 2; return d2094(m); }
+function d2096(n) { var m = n + 3; return d2095(m); }
+function d2097(n) { var m = n + 4; return d2096(m); }
+function d2098(n) { var m = n + 5; return d2097(m); }
+function d2099(n) { var m = n + 6; return d2098(m); }
+function d2100(n) { var m = n + 0; return d2099(m); }
+function d2101(n) { var m = n + 1; return d2100(m); }
+function d2102(n) { var m = n + 2; return d2101(m); }
+function d2103(n) { var m = n + 3; return d2102(m); }
+function d2104(n) { var m = n + 4; return d2103(m); }
+function d2105(n) { var m = n + 5; return d2104(m); }
+function d2106(n) { var m = n + 6; return d2105(m); }
+function d2107(n) { var m = n + 0; return d2106(m); }
+function d2108(n) { var m = n + 1; return d2107(m); }
+function d2109(n) { var m = n + 2; return d2108(m); }
+function d2110(n) { var m = n + 3; return d2109(m); }
+function d2111(n) { var m = n + 4; return d2110(m); }
+function d2112(n) { var m = n + 5; return d2111(m); }
+function d2113(n) { var m = n + 6; return d2112(m); }
+function d2114(n) { var m = n + 0; return d2113(m); }
+function d2115(n) { var m = n + 1; return d2114(m); }
+function d2116(n) { var m = n + 2; return d2115(m); }
+function d2117(n) { var m = n + 3; return d2116(m); }
+function d2118(n) { var m = n + 4; return d2117(m); }
+function d2119(n) { var m = n + 5; return d2118(m); }
+function d2120(n) { var m = n + 6; return d2119(m); }
+function d2121(n) { var m = n + 0; return d2120(m); }
+function d2122(n) { var m = n + 1; return d2121(m); }
+function d2123(n) { var m = n + 2; return d2122(m); }
+function d2124(n) { var m = n + 3; return d2123(m); }
+function d2125(n) { var m = n + 4; return d2124(m); }
+function d2126(n) { var m = n + 5; return d2125(m); }
+function d2127(n) { var m = n + 6; return d2126(m); }
+function d2128(n) { var m = n + 0; return d2127(m); }
+function d2129(n) { var m = n + 1; return d2128(m); }
+function d2130(n) { var m = n + 2; return d2129(m); }
+function d2131(n) { var m = n + 3; return d2130(m); }
+function d2132(n) { var m = n + 4; return d2131(m); }
+function d2133(n) { var m = n + 5; return d2132(m); }
+function d2134(n) { var m = n + 6; return d2133(m); }
+function d2135(n) { var m = n + 0; return d2134(m); }
+function d2136(n) { var m = n + 1; return d2135(m); }
+function d2137(n) { var m = n + 2; return d2136(m); }
+function d2138(n) { var m = n + 3; return d2137(m); }
+function d2139(n) { var m = n + 4; return d2138(m); }
+function d2140(n) { var m = n + 5; return d2139(m); }
+function d2141(n) { var m = n + 6; return d2140(m); }
+function d2142(n) { var m = n + 0; return d2141(m); }
+function d2143(n) { var m = n + 1; return d2142(m); }
+function d2144(n) { var m = n + 2; return d2143(m); }
+function d2145(n) { var m = n + 3; return d2144(m); }
+function d2146(n) { var m = n + 4; return d2145(m); }
+function d2147(n) { var m = n + 5; return d2146(m); }
+function d2148(n) { var m = n + 6; return d2147(m); }
+function d2149(n) { var m = n + 0; return d2148(m); }
+function d2150(n) { var m = n + 1; return d2149(m); }
+function d2151(n) { var m = n + 2; return d2150(m); }
+function d2152(n) { var m = n + 3; return d2151(m); }
+function d2153(n) { var m = n + 4; return d2152(m); }
+function d2154(n) { var m = n + 5; return d2153(m); }
+function d2155(n) { var m = n + 6; return d2154(m); }
+function d2156(n) { var m = n + 0; return d2155(m); }
+function d2157(n) { var m = n + 1; return d2156(m); }
+function d2158(n) { var m = n + 2; return d2157(m); }
+function d2159(n) { var m = n + 3; return d2158(m); }
+function d2160(n) { var m = n + 4; return d2159(m); }
+function d2161(n) { var m = n + 5; return d2160(m); }
+function d2162(n) { var m = n + 6; return d2161(m); }
+function d2163(n) { var m = n + 0; return d2162(m); }
+function d2164(n) { var m = n + 1; return d2163(m); }
+function d2165(n) { var m = n + 2; return d2164(m); }
+function d2166(n) { var m = n + 3; return d2165(m); }
+function d2167(n) { var m = n + 4; return d2166(m); }
+function d2168(n) { var m = n + 5; return d2167(m); }
+function d2169(n) { var m = n + 6; return d2168(m); }
+function d2170(n) { var m = n + 0; return d2169(m); }
+function d2171(n) { var m = n + 1; return d2170(m); }
+function d2172(n) { var m = n + 2; return d2171(m); }
+function d2173(n) { var m = n + 3; return d2172(m); }
+function d2174(n) { var m = n + 4; return d2173(m); }
+function d2175(n) { var m = n + 5; return d2174(m); }
+function d2176(n) { var m = n + 6; return d2175(m); }
+function d2177(n) { var m = n + 0; return d2176(m); }
+function d2178(n) { var m = n + 1; return d2177(m); }
+function d2179(n) { var m = n + 2; return d2178(m); }
+function d2180(n) { var m = n + 3; return d2179(m); }
+function d2181(n) { var m = n + 4; return d2180(m); }
+function d2182(n) { var m = n + 5; return d2181(m); }
+function d2183(n) { var m = n + 6; return d2182(m); }
+function d2184(n) { var m = n + 0; return d2183(m); }
+function d2185(n) { var m = n + 1; return d2184(m); }
+function d2186(n) { var m = n + 2; return d2185(m); }
+function d2187(n) { var m = n + 3; return d2186(m); }
+function d2188(n) { var m = n + 4; return d2187(m); }
+function d2189(n) { var m = n + 5; return d2188(m); }
+function d2190(n) { var m = n + 6; return d2189(m); }
+function d2191(n) { var m = n + 0; return d2190(m); }
+function d2192(n) { var m = n + 1; return d2191(m); }
+function d2193(n) { var m = n + 2; return d2192(m); }
+function d2194(n) { var m = n + 3; return d2193(m); }
+function d2195(n) { var m = n + 4; return d2194(m); }
+function d2196(n) { var m = n + 5; return d2195(m); }
+function d2197(n) { var m = n + 6; return d2196(m); }
+function d2198(n) { var m = n + 0; return d2197(m); }
+function d2199(n) { var m = n + 1; return d2198(m); }
+function d2200(n) { var m = n + 2; return d2199(m); }
+function d2201(n) { var m = n + 3; return d2200(m); }
+function d2202(n) { var m = n + 4; return d2201(m); }
+function d2203(n) { var m = n + 5; return d2202(m); }
+function d2204(n) { var m = n + 6; return d2203(m); }
+function d2205(n) { var m = n + 0; return d2204(m); }
+function d2206(n) { var m = n + 1; return d2205(m); }
+function d2207(n) { var m = n + 2; return d2206(m); }
+function d2208(n) { var m = n + 3; return d2207(m); }
+function d2209(n) { var m = n + 4; return d2208(m); }
+function d2210(n) { var m = n + 5; return d2209(m); }
+function d2211(n) { var m = n + 6; return d2210(m); }
+function d2212(n) { var m = n + 0; return d2211(m); }
+function d2213(n) { var m = n + 1; return d2212(m); }
+function d2214(n) { var m = n + 2; return d2213(m); }
+function d2215(n) { var m = n + 3; return d2214(m); }
+function d2216(n) { var m = n + 4; return d2215(m); }
+function d2217(n) { var m = n + 5; return d2216(m); }
+function d2218(n) { var m = n + 6; return d2217(m); }
+function d2219(n) { var m = n + 0; return d2218(m); }
+function d2220(n) { var m = n + 1; return d2219(m); }
+function d2221(n) { var m = n + 2; return d2220(m); }
+function d2222(n) { var m = n + 3; return d2221(m); }
+function d2223(n) { var m = n + 4; return d2222(m); }
+function d2224(n) { var m = n + 5; return d2223(m); }
+function d2225(n) { var m = n + 6; return d2224(m); }
+function d2226(n) { var m = n + 0; return d2225(m); }
+function d2227(n) { var m = n + 1; return d2226(m); }
+function d2228(n) { var m = n + 2; return d2227(m); }
+function d2229(n) { var m = n + 3; return d2228(m); }
+function d2230(n) { var m = n + 4; return d2229(m); }
+function d2231(n) { var m = n + 5; return d2230(m); }
+function d2232(n) { var m = n + 6; return d2231(m); }
+function d2233(n) { var m = n + 0; return d2232(m); }
+function d2234(n) { var m = n + 1; return d2233(m); }
+function d2235(n) { var m = n + 2; return d2234(m); }
+function d2236(n) { var m = n + 3; return d2235(m); }
+function d2237(n) { var m = n + 4; return d2236(m); }
+function d2238(n) { var m = n + 5; return d2237(m); }
+function d2239(n) { var m = n + 6; return d2238(m); }
+function d2240(n) { var m = n + 0; return d2239(m); }
+function d2241(n) { var m = n + 1; return d2240(m); }
+function d2242(n) { var m = n + 2; return d2241(m); }
+function d2243(n) { var m = n + 3; return d2242(m); }
+function d2244(n) { var m = n + 4; return d2243(m); }
+function d2245(n) { var m = n + 5; return d2244(m); }
+function d2246(n) { var m = n + 6; return d2245(m); }
+function d2247(n) { var m = n + 0; return d2246(m); }
+function d2248(n) { var m = n + 1; return d2247(m); }
+function d2249(n) { var m = n + 2; return d2248(m); }
+function d2250(n) { var m = n + 3; return d2249(m); }
+function d2251(n) { var m = n + 4; return d2250(m); }
+function d2252(n) { var m = n + 5; return d2251(m); }
+function d2253(n) { var m = n + 6; return d2252(m); }
+function d2254(n) { var m = n + 0; return d2253(m); }
+function d2255(n) { var m = n + 1; return d2254(m); }
+function d2256(n) { var m = n + 2; return d2255(m); }
+function d2257(n) { var m = n + 3; return d2256(m); }
+function d2258(n) { var m = n + 4; return d2257(m); }
+function d2259(n) { var m = n + 5; return d2258(m); }
+function d2260(n) { var m = n + 6; return d2259(m); }
+function d2261(n) { var m = n + 0; return d2260(m); }
+function d2262(n) { var m = n + 1; return d2261(m); }
+function d2263(n) { var m = n + 2; return d2262(m); }
+function d2264(n) { var m = n + 3; return d2263(m); }
+function d2265(n) { var m = n + 4; return d2264(m); }
+function d2266(n) { var m = n + 5; return d2265(m); }
+function d2267(n) { var m = n + 6; return d2266(m); }
+function d2268(n) { var m = n + 0; return d2267(m); }
+function d2269(n) { var m = n + 1; return d2268(m); }
+function d2270(n) { var m = n + 2; return d2269(m); }
+function d2271(n) { var m = n + 3; return d2270(m); }
+function d2272(n) { var m = n + 4; return d2271(m); }
+function d2273(n) { var m = n + 5; return d2272(m); }
+function d2274(n) { var m = n + 6; return d2273(m); }
+function d2275(n) { var m = n + 0; return d2274(m); }
+function d2276(n) { var m = n + 1; return d2275(m); }
+function d2277(n) { var m = n + 2; return d2276(m); }
+function d2278(n) { var m = n + 3; return d2277(m); }
+function d2279(n) { var m = n + 4; return d2278(m); }
+function d2280(n) { var m = n + 5; return d2279(m); }
+function d2281(n) { var m = n + 6; return d2280(m); }
+function d2282(n) { var m = n + 0; return d2281(m); }
+function d2283(n) { var m = n + 1; return d2282(m); }
+function d2284(n) { var m = n + 2; return d2283(m); }
+function d2285(n) { var m = n + 3; return d2284(m); }
+function d2286(n) { var m = n + 4; return d2285(m); }
+function d2287(n) { var m = n + 5; return d2286(m); }
+function d2288(n) { var m = n + 6; return d2287(m); }
+function d2289(n) { var m = n + 0; return d2288(m); }
+function d2290(n) { var m = n + 1; return d2289(m); }
+function d2291(n) { var m = n + 2; return d2290(m); }
+function d2292(n) { var m = n + 3; return d2291(m); }
+function d2293(n) { var m = n + 4; return d2292(m); }
+function d2294(n) { var m = n + 5; return d2293(m); }
+function d2295(n) { var m = n + 6; return d2294(m); }
+function d2296(n) { var m = n + 0; return d2295(m); }
+function d2297(n) { var m = n + 1; return d2296(m); }
+function d2298(n) { var m = n + 2; return d2297(m); }
+function d2299(n) { var m = n + 3; return d2298(m); }
+function d2300(n) { var m = n + 4; return d2299(m); }
+function d2301(n) { var m = n + 5; return d2300(m); }
+function d2302(n) { var m = n + 6; return d2301(m); }
+function d2303(n) { var m = n + 0; return d2302(m); }
+function d2304(n) { var m = n + 1; return d2303(m); }
+function d2305(n) { var m = n + 2; return d2304(m); }
+function d2306(n) { var m = n + 3; return d2305(m); }
+function d2307(n) { var m = n + 4; return d2306(m); }
+function d2308(n) { var m = n + 5; return d2307(m); }
+function d2309(n) { var m = n + 6; return d2308(m); }
+function d2310(n) { var m = n + 0; return d2309(m); }
+function d2311(n) { var m = n + 1; return d2310(m); }
+function d2312(n) { var m = n + 2; return d2311(m); }
+function d2313(n) { var m = n + 3; return d2312(m); }
+function d2314(n) { var m = n + 4; return d2313(m); }
+function d2315(n) { var m = n + 5; return d2314(m); }
+function d2316(n) { var m = n + 6; return d2315(m); }
+function d2317(n) { var m = n + 0; return d2316(m); }
+function d2318(n) { var m = n + 1; return d2317(m); }
+function d2319(n) { var m = n + 2; return d2318(m); }
+function d2320(n) { var m = n + 3; return d2319(m); }
+function d2321(n) { var m = n + 4; return d2320(m); }
+function d2322(n) { var m = n + 5; return d2321(m); }
+function d2323(n) { var m = n + 6; return d2322(m); }
+function d2324(n) { var m = n + 0; return d2323(m); }
+function d2325(n) { var m = n + 1; return d2324(m); }
+function d2326(n) { var m = n + 2; return d2325(m); }
+function d2327(n) { var m = n + 3; return d2326(m); }
+function d2328(n) { var m = n + 4; return d2327(m); }
+function d2329(n) { var m = n + 5; return d2328(m); }
+function d2330(n) { var m = n + 6; return d2329(m); }
+function d2331(n) { var m = n + 0; return d2330(m); }
+function d2332(n) { var m = n + 1; return d2331(m); }
+function d2333(n) { var m = n + 2; return d2332(m); }
+function d2334(n) { var m = n + 3; return d2333(m); }
+function d2335(n) { var m = n + 4; return d2334(m); }
+function d2336(n) { var m = n + 5; return d2335(m); }
+function d2337(n) { var m = n + 6; return d2336(m); }
+function d2338(n) { var m = n + 0; return d2337(m); }
+function d2339(n) { var m = n + 1; return d2338(m); }
+function d2340(n) { var m = n + 2; return d2339(m); }
+function d2341(n) { var m = n + 3; return d2340(m); }
+function d2342(n) { var m = n + 4; return d2341(m); }
+function d2343(n) { var m = n + 5; return d2342(m); }
+function d2344(n) { var m = n + 6; return d2343(m); }
+function d2345(n) { var m = n + 0; return d2344(m); }
+function d2346(n) { var m = n + 1; return d2345(m); }
+function d2347(n) { var m = n + 2; return d2346(m); }
+function d2348(n) { var m = n + 3; return d2347(m); }
+function d2349(n) { var m = n + 4; return d2348(m); }
+function d2350(n) { var m = n + 5; return d2349(m); }
+function d2351(n) { var m = n + 6; return d2350(m); }
+function d2352(n) { var m = n + 0; return d2351(m); }
+function d2353(n) { var m = n + 1; return d2352(m); }
+function d2354(n) { var m = n + 2; return d2353(m); }
+function d2355(n) { var m = n + 3; return d2354(m); }
+function d2356(n) { var m = n + 4; return d2355(m); }
+function d2357(n) { var m = n + 5; return d2356(m); }
+function d2358(n) { var m = n + 6; return d2357(m); }
+function d2359(n) { var m = n + 0; return d2358(m); }
+function d2360(n) { var m = n + 1; return d2359(m); }
+function d2361(n) { var m = n + 2; return d2360(m); }
+function d2362(n) { var m = n + 3; return d2361(m); }
+function d2363(n) { var m = n + 4; return d2362(m); }
+function d2364(n) { var m = n + 5; return d2363(m); }
+function d2365(n) { var m = n + 6; return d2364(m); }
+function d2366(n) { var m = n + 0; return d2365(m); }
+function d2367(n) { var m = n + 1; return d2366(m); }
+function d2368(n) { var m = n + 2; return d2367(m); }
+function d2369(n) { var m = n + 3; return d2368(m); }
+function d2370(n) { var m = n + 4; return d2369(m); }
+function d2371(n) { var m = n + 5; return d2370(m); }
+function d2372(n) { var m = n + 6; return d2371(m); }
+function d2373(n) { var m = n + 0; return d2372(m); }
+function d2374(n) { var m = n + 1; return d2373(m); }
+function d2375(n) { var m = n + 2; return d2374(m); }
+function d2376(n) { var m = n + 3; return d2375(m); }
+function d2377(n) { var m = n + 4; return d2376(m); }
+function d2378(n) { var m = n + 5; return d2377(m); }
+function d2379(n) { var m = n + 6; return d2378(m); }
+function d2380(n) { var m = n + 0; return d2379(m); }
+function d2381(n) { var m = n + 1; return d2380(m); }
+function d2382(n) { var m = n + 2; return d2381(m); }
+function d2383(n) { var m = n + 3; return d2382(m); }
+function d2384(n) { var m = n + 4; return d2383(m); }
+function d2385(n) { var m = n + 5; return d2384(m); }
+function d2386(n) { var m = n + 6; return d2385(m); }
+function d2387(n) { var m = n + 0; return d2386(m); }
+function d2388(n) { var m = n + 1; return d2387(m); }
+function d2389(n) { var m = n + 2; return d2388(m); }
+function d2390(n) { var m = n + 3; return d2389(m); }
+function d2391(n) { var m = n + 4; return d2390(m); }
+function d2392(n) { var m = n + 5; return d2391(m); }
+function d2393(n) { var m = n + 6; return d2392(m); }
+function d2394(n) { var m = n + 0; return d2393(m); }
+function d2395(n) { var m = n + 1; return d2394(m); }
+function d2396(n) { var m = n + 2; return d2395(m); }
+function d2397(n) { var m = n + 3; return d2396(m); }
+function d2398(n) { var m = n + 4; return d2397(m); }
+function d2399(n) { var m = n + 5; return d2398(m); }
+function d2400(n) { var m = n + 6; return d2399(m); }
+function d2401(n) { var m = n + 0; return d2400(m); }
+function d2402(n) { var m = n + 1; return d2401(m); }
+function d2403(n) { var m = n + 2; return d2402(m); }
+function d2404(n) { var m = n + 3; return d2403(m); }
+function d2405(n) { var m = n + 4; return d2404(m); }
+function d2406(n) { var m = n + 5; return d2405(m); }
+function d2407(n) { var m = n + 6; return d2406(m); }
+function d2408(n) { var m = n + 0; return d2407(m); }
+function d2409(n) { var m = n + 1; return d2408(m); }
+function d2410(n) { var m = n + 2; return d2409(m); }
+function d2411(n) { var m = n + 3; return d2410(m); }
+function d2412(n) { var m = n + 4; return d2411(m); }
+function d2413(n) { var m = n + 5; return d2412(m); }
+function d2414(n) { var m = n + 6; return d2413(m); }
+function d2415(n) { var m = n + 0; return d2414(m); }
+function d2416(n) { var m = n + 1; return d2415(m); }
+function d2417(n) { var m = n + 2; return d2416(m); }
+function d2418(n) { var m = n + 3; return d2417(m); }
+function d2419(n) { var m = n + 4; return d2418(m); }
+function d2420(n) { var m = n + 5; return d2419(m); }
+function d2421(n) { var m = n + 6; return d2420(m); }
+function d2422(n) { var m = n + 0; return d2421(m); }
+function d2423(n) { var m = n + 1; return d2422(m); }
+function d2424(n) { var m = n + 2; return d2423(m); }
+function d2425(n) { var m = n + 3; return d2424(m); }
+function d2426(n) { var m = n + 4; return d2425(m); }
+function d2427(n) { var m = n + 5; return d2426(m); }
+function d2428(n) { var m = n + 6; return d2427(m); }
+function d2429(n) { var m = n + 0; return d2428(m); }
+function d2430(n) { var m = n + 1; return d2429(m); }
+function d2431(n) { var m = n + 2; return d2430(m); }
+function d2432(n) { var m = n + 3; return d2431(m); }
+function d2433(n) { var m = n + 4; return d2432(m); }
+function d2434(n) { var m = n + 5; return d2433(m); }
+function d2435(n) { var m = n + 6; return d2434(m); }
+function d2436(n) { var m = n + 0; return d2435(m); }
+function d2437(n) { var m = n + 1; return d2436(m); }
+function d2438(n) { var m = n + 2; return d2437(m); }
+function d2439(n) { var m = n + 3; return d2438(m); }
+function d2440(n) { var m = n + 4; return d2439(m); }
+function d2441(n) { var m = n + 5; return d2440(m); }
+function d2442(n) { var m = n + 6; return d2441(m); }
+function d2443(n) { var m = n + 0; return d2442(m); }
+function d2444(n) { var m = n + 1; return d2443(m); }
+function d2445(n) { var m = n + 2; return d2444(m); }
+function d2446(n) { var m = n + 3; return d2445(m); }
+function d2447(n) { var m = n + 4; return d2446(m); }
+function d2448(n) { var m = n + 5; return d2447(m); }
+function d2449(n) { var m = n + 6; return d2448(m); }
+function d2450(n) { var m = n + 0; return d2449(m); }
+function d2451(n) { var m = n + 1; return d2450(m); }
+function d2452(n) { var m = n + 2; return d2451(m); }
+function d2453(n) { var m = n + 3; return d2452(m); }
+function d2454(n) { var m = n + 4; return d2453(m); }
+function d2455(n) { var m = n + 5; return d2454(m); }
+function d2456(n) { var m = n + 6; return d2455(m); }
+function d2457(n) { var m = n + 0; return d2456(m); }
+function d2458(n) { var m = n + 1; return d2457(m); }
+function d2459(n) { var m = n + 2; return d2458(m); }
+function d2460(n) { var m = n + 3; return d2459(m); }
+function d2461(n) { var m = n + 4; return d2460(m); }
+function d2462(n) { var m = n + 5; return d2461(m); }
+function d2463(n) { var m = n + 6; return d2462(m); }
+function d2464(n) { var m = n + 0; return d2463(m); }
+function d2465(n) { var m = n + 1; return d2464(m); }
+function d2466(n) { var m = n + 2; return d2465(m); }
+function d2467(n) { var m = n + 3; return d2466(m); }
+function d2468(n) { var m = n + 4; return d2467(m); }
+function d2469(n) { var m = n + 5; return d2468(m); }
+function d2470(n) { var m = n + 6; return d2469(m); }
+function d2471(n) { var m = n + 0; return d2470(m); }
+function d2472(n) { var m = n + 1; return d2471(m); }
+function d2473(n) { var m = n + 2; return d2472(m); }
+function d2474(n) { var m = n + 3; return d2473(m); }
+function d2475(n) { var m = n + 4; return d2474(m); }
+function d2476(n) { var m = n + 5; return d2475(m); }
+function d2477(n) { var m = n + 6; return d2476(m); }
+function d2478(n) { var m = n + 0; return d2477(m); }
+function d2479(n) { var m = n + 1; return d2478(m); }
+function d2480(n) { var m = n + 2; return d2479(m); }
+function d2481(n) { var m = n + 3; return d2480(m); }
+function d2482(n) { var m = n + 4; return d2481(m); }
+function d2483(n) { var m = n + 5; return d2482(m); }
+function d2484(n) { var m = n + 6; return d2483(m); }
+function d2485(n) { var m = n + 0; return d2484(m); }
+function d2486(n) { var m = n + 1; return d2485(m); }
+function d2487(n) { var m = n + 2; return d2486(m); }
+function d2488(n) { var m = n + 3; return d2487(m); }
+function d2489(n) { var m = n + 4; return d2488(m); }
+function d2490(n) { var m = n + 5; return d2489(m); }
+function d2491(n) { var m = n + 6; return d2490(m); }
+function d2492(n) { var m = n + 0; return d2491(m); }
+function d2493(n) { var m = n + 1; return d2492(m); }
+function d2494(n) { var m = n + 2; return d2493(m); }
+function d2495(n) { var m = n + 3; return d2494(m); }
+function d2496(n) { var m = n + 4; return d2495(m); }
+function d2497(n) { var m = n + 5; return d2496(m); }
+function d2498(n) { var m = n + 6; return d2497(m); }
+function d2499(n) { var m = n + 0; return d2498(m); }
+function d2500(n) { var m = n + 1; return d2499(m); }
+function d2501(n) { var m = n + 2; return d2500(m); }
+function d2502(n) { var m = n + 3; return d2501(m); }
+function d2503(n) { var m = n + 4; return d2502(m); }
+function d2504(n) { var m = n + 5; return d2503(m); }
+function d2505(n) { var m = n + 6; return d2504(m); }
+function d2506(n) { var m = n + 0; return d2505(m); }
+function d2507(n) { var m = n + 1; return d2506(m); }
+function d2508(n) { var m = n + 2; return d2507(m); }
+function d2509(n) { var m = n + 3; return d2508(m); }
+function d2510(n) { var m = n + 4; return d2509(m); }
+function d2511(n) { var m = n + 5; return d2510(m); }
+function d2512(n) { var m = n + 6; return d2511(m); }
+function d2513(n) { var m = n + 0; return d2512(m); }
+function d2514(n) { var m = n + 1; return d2513(m); }
+function d2515(n) { var m = n + 2; return d2514(m); }
+function d2516(n) { var m = n + 3; return d2515(m); }
+function d2517(n) { var m = n + 4; return d2516(m); }
+function d2518(n) { var m = n + 5; return d2517(m); }
+function d2519(n) { var m = n + 6; return d2518(m); }
+function d2520(n) { var m = n + 0; return d2519(m); }
+function d2521(n) { var m = n + 1; return d2520(m); }
+function d2522(n) { var m = n + 2; return d2521(m); }
+function d2523(n) { var m = n + 3; return d2522(m); }
+function d2524(n) { var m = n + 4; return d2523(m); }
+function d2525(n) { var m = n + 5; return d2524(m); }
+function d2526(n) { var m = n + 6; return d2525(m); }
+function d2527(n) { var m = n + 0; return d2526(m); }
+function d2528(n) { var m = n + 1; return d2527(m); }
+function d2529(n) { var m = n + 2; return d2528(m); }
+function d2530(n) { var m = n + 3; return d2529(m); }
+function d2531(n) { var m = n + 4; return d2530(m); }
+function d2532(n) { var m = n + 5; return d2531(m); }
+function d2533(n) { var m = n + 6; return d2532(m); }
+function d2534(n) { var m = n + 0; return d2533(m); }
+function d2535(n) { var m = n + 1; return d2534(m); }
+function d2536(n) { var m = n + 2; return d2535(m); }
+function d2537(n) { var m = n + 3; return d2536(m); }
+function d2538(n) { var m = n + 4; return d2537(m); }
+function d2539(n) { var m = n + 5; return d2538(m); }
+function d2540(n) { var m = n + 6; return d2539(m); }
+function d2541(n) { var m = n + 0; return d2540(m); }
+function d2542(n) { var m = n + 1; return d2541(m); }
+function d2543(n) { var m = n + 2; return d2542(m); }
+function d2544(n) { var m = n + 3; return d2543(m); }
+function d2545(n) { var m = n + 4; return d2544(m); }
+function d2546(n) { var m = n + 5; return d2545(m); }
+function d2547(n) { var m = n + 6; return d2546(m); }
+function d2548(n) { var m = n + 0; return d2547(m); }
+function d2549(n) { var m = n + 1; return d2548(m); }
+function d2550(n) { var m = n + 2; return d2549(m); }
+function d2551(n) { var m = n + 3; return d2550(m); }
+function d2552(n) { var m = n + 4; return d2551(m); }
+function d2553(n) { var m = n + 5; return d2552(m); }
+function d2554(n) { var m = n + 6; return d2553(m); }
+function d2555(n) { var m = n + 0; return d2554(m); }
+function d2556(n) { var m = n + 1; return d2555(m); }
+function d2557(n) { var m = n + 2; return d2556(m); }
+function d2558(n) { var m = n + 3; return d2557(m); }
+function d2559(n) { var m = n + 4; return d2558(m); }
+function d2560(n) { var m = n + 5; return d2559(m); }
+function d2561(n) { var m = n + 6; return d2560(m); }
+function d2562(n) { var m = n + 0; return d2561(m); }
+function d2563(n) { var m = n + 1; return d2562(m); }
+function d2564(n) { var m = n + 2; return d2563(m); }
+function d2565(n) { var m = n + 3; return d2564(m); }
+function d2566(n) { var m = n + 4; return d2565(m); }
+function d2567(n) { var m = n + 5; return d2566(m); }
+function d2568(n) { var m = n + 6; return d2567(m); }
+function d2569(n) { var m = n + 0; return d2568(m); }
+function d2570(n) { var m = n + 1; return d2569(m); }
+function d2571(n) { var m = n + 2; return d2570(m); }
+function d2572(n) { var m = n + 3; return d2571(m); }
+function d2573(n) { var m = n + 4; return d2572(m); }
+function d2574(n) { var m = n + 5; return d2573(m); }
+function d2575(n) { var m = n + 6; return d2574(m); }
+function d2576(n) { var m = n + 0; return d2575(m); }
+function d2577(n) { var m = n + 1; return d2576(m); }
+function d2578(n) { var m = n + 2; return d2577(m); }
+function d2579(n) { var m = n + 3; return d2578(m); }
+function d2580(n) { var m = n + 4; return d2579(m); }
+function d2581(n) { var m = n + 5; return d2580(m); }
+function d2582(n) { var m = n + 6; return d2581(m); }
+function d2583(n) { var m = n + 0; return d2582(m); }
+function d2584(n) { var m = n + 1; return d2583(m); }
+function d2585(n) { var m = n + 2; return d2584(m); }
+function d2586(n) { var m = n + 3; return d2585(m); }
+function d2587(n) { var m = n + 4; return d2586(m); }
+function d2588(n) { var m = n + 5; return d2587(m); }
+function d2589(n) { var m = n + 6; return d2588(m); }
+function d2590(n) { var m = n + 0; return d2589(m); }
+function d2591(n) { var m = n + 1; return d2590(m); }
+function d2592(n) { var m = n + 2; return d2591(m); }
+function d2593(n) { var m = n + 3; return d2592(m); }
+function d2594(n) { var m = n + 4; return d2593(m); }
+function d2595(n) { var m = n + 5; return d2594(m); }
+function d2596(n) { var m = n + 6; return d2595(m); }
+function d2597(n) { var m = n + 0; return d2596(m); }
+function d2598(n) { var m = n + 1; return d2597(m); }
+function d2599(n) { var m = n + 2; return d2598(m); }
+function d2600(n) { var m = n + 3; return d2599(m); }
+function d2601(n) { var m = n + 4; return d2600(m); }
+function d2602(n) { var m = n + 5; return d2601(m); }
+function d2603(n) { var m = n + 6; return d2602(m); }
+function d2604(n) { var m = n + 0; return d2603(m); }
+function d2605(n) { var m = n + 1; return d2604(m); }
+function d2606(n) { var m = n + 2; return d2605(m); }
+function d2607(n) { var m = n + 3; return d2606(m); }
+function d2608(n) { var m = n + 4; return d2607(m); }
+function d2609(n) { var m = n + 5; return d2608(m); }
+function d2610(n) { var m = n + 6; return d2609(m); }
+function d2611(n) { var m = n + 0; return d2610(m); }
+function d2612(n) { var m = n + 1; return d2611(m); }
+function d2613(n) { var m = n + 2; return d2612(m); }
+function d2614(n) { var m = n + 3; return d2613(m); }
+function d2615(n) { var m = n + 4; return d2614(m); }
+function d2616(n) { var m = n + 5; return d2615(m); }
+function d2617(n) { var m = n + 6; return d2616(m); }
+function d2618(n) { var m = n + 0; return d2617(m); }
+function d2619(n) { var m = n + 1; return d2618(m); }
+function d2620(n) { var m = n + 2; return d2619(m); }
+function d2621(n) { var m = n + 3; return d2620(m); }
+function d2622(n) { var m = n + 4; return d2621(m); }
+function d2623(n) { var m = n + 5; return d2622(m); }
+function d2624(n) { var m = n + 6; return d2623(m); }
+function d2625(n) { var m = n + 0; return d2624(m); }
+function d2626(n) { var m = n + 1; return d2625(m); }
+function d2627(n) { var m = n + 2; return d2626(m); }
+function d2628(n) { var m = n + 3; return d2627(m); }
+function d2629(n) { var m = n + 4; return d2628(m); }
+function d2630(n) { var m = n + 5; return d2629(m); }
+function d2631(n) { var m = n + 6; return d2630(m); }
+function d2632(n) { var m = n + 0; return d2631(m); }
+function d2633(n) { var m = n + 1; return d2632(m); }
+function d2634(n) { var m = n + 2; return d2633(m); }
+function d2635(n) { var m = n + 3; return d2634(m); }
+function d2636(n) { var m = n + 4; return d2635(m); }
+function d2637(n) { var m = n + 5; return d2636(m); }
+function d2638(n) { var m = n + 6; return d2637(m); }
+function d2639(n) { var m = n + 0; return d2638(m); }
+function d2640(n) { var m = n + 1; return d2639(m); }
+function d2641(n) { var m = n + 2; return d2640(m); }
+function d2642(n) { var m = n + 3; return d2641(m); }
+function d2643(n) { var m = n + 4; return d2642(m); }
+function d2644(n) { var m = n + 5; return d2643(m); }
+function d2645(n) { var m = n + 6; return d2644(m); }
+function d2646(n) { var m = n + 0; return d2645(m); }
+function d2647(n) { var m = n + 1; return d2646(m); }
+function d2648(n) { var m = n + 2; return d2647(m); }
+function d2649(n) { var m = n + 3; return d2648(m); }
+function d2650(n) { var m = n + 4; return d2649(m); }
+function d2651(n) { var m = n + 5; return d2650(m); }
+function d2652(n) { var m = n + 6; return d2651(m); }
+function d2653(n) { var m = n + 0; return d2652(m); }
+function d2654(n) { var m = n + 1; return d2653(m); }
+function d2655(n) { var m = n + 2; return d2654(m); }
+function d2656(n) { var m = n + 3; return d2655(m); }
+function d2657(n) { var m = n + 4; return d2656(m); }
+function d2658(n) { var m = n + 5; return d2657(m); }
+function d2659(n) { var m = n + 6; return d2658(m); }
+function d2660(n) { var m = n + 0; return d2659(m); }
+function d2661(n) { var m = n + 1; return d2660(m); }
+function d2662(n) { var m = n + 2; return d2661(m); }
+function d2663(n) { var m = n + 3; return d2662(m); }
+function d2664(n) { var m = n + 4; return d2663(m); }
+function d2665(n) { var m = n + 5; return d2664(m); }
+function d2666(n) { var m = n + 6; return d2665(m); }
+function d2667(n) { var m = n + 0; return d2666(m); }
+function d2668(n) { var m = n + 1; return d2667(m); }
+function d2669(n) { var m = n + 2; return d2668(m); }
+function d2670(n) { var m = n + 3; return d2669(m); }
+function d2671(n) { var m = n + 4; return d2670(m); }
+function d2672(n) { var m = n + 5; return d2671(m); }
+function d2673(n) { var m = n + 6; return d2672(m); }
+function d2674(n) { var m = n + 0; return d2673(m); }
+function d2675(n) { var m = n + 1; return d2674(m); }
+function d2676(n) { var m = n + 2; return d2675(m); }
+function d2677(n) { var m = n + 3; return d2676(m); }
+function d2678(n) { var m = n + 4; return d2677(m); }
+function d2679(n) { var m = n + 5; return d2678(m); }
+function d2680(n) { var m = n + 6; return d2679(m); }
+function d2681(n) { var m = n + 0; return d2680(m); }
+function d2682(n) { var m = n + 1; return d2681(m); }
+function d2683(n) { var m = n + 2; return d2682(m); }
+function d2684(n) { var m = n + 3; return d2683(m); }
+function d2685(n) { var m = n + 4; return d2684(m); }
+function d2686(n) { var m = n + 5; return d2685(m); }
+function d2687(n) { var m = n + 6; return d2686(m); }
+function d2688(n) { var m = n + 0; return d2687(m); }
+function d2689(n) { var m = n + 1; return d2688(m); }
+function d2690(n) { var m = n + 2; return d2689(m); }
+function d2691(n) { var m = n + 3; return d2690(m); }
+function d2692(n) { var m = n + 4; return d2691(m); }
+function d2693(n) { var m = n + 5; return d2692(m); }
+function d2694(n) { var m = n + 6; return d2693(m); }
+function d2695(n) { var m = n + 0; return d2694(m); }
+function d2696(n) { var m = n + 1; return d2695(m); }
+function d2697(n) { var m = n + 2; return d2696(m); }
+function d2698(n) { var m = n + 3; return d2697(m); }
+function d2699(n) { var m = n + 4; return d2698(m); }
+function d2700(n) { var m = n + 5; return d2699(m); }
+function d2701(n) { var m = n + 6; return d2700(m); }
+function d2702(n) { var m = n + 0; return d2701(m); }
+function d2703(n) { var m = n + 1; return d2702(m); }
+function d2704(n) { var m = n + 2; return d2703(m); }
+function d2705(n) { var m = n + 3; return d2704(m); }
+function d2706(n) { var m = n + 4; return d2705(m); }
+function d2707(n) { var m = n + 5; return d2706(m); }
+function d2708(n) { var m = n + 6; return d2707(m); }
+function d2709(n) { var m = n + 0; return d2708(m); }
+function d2710(n) { var m = n + 1; return d2709(m); }
+function d2711(n) { var m = n + 2; return d2710(m); }
+function d2712(n) { var m = n + 3; return d2711(m); }
+function d2713(n) { var m = n + 4; return d2712(m); }
+function d2714(n) { var m = n + 5; return d2713(m); }
+function d2715(n) { var m = n + 6; return d2714(m); }
+function d2716(n) { var m = n + 0; return d2715(m); }
+function d2717(n) { var m = n + 1; return d2716(m); }
+function d2718(n) { var m = n + 2; return d2717(m); }
+function d2719(n) { var m = n + 3; return d2718(m); }
+function d2720(n) { var m = n + 4; return d2719(m); }
+function d2721(n) { var m = n + 5; return d2720(m); }
+function d2722(n) { var m = n + 6; return d2721(m); }
+function d2723(n) { var m = n + 0; return d2722(m); }
+function d2724(n) { var m = n + 1; return d2723(m); }
+function d2725(n) { var m = n + 2; return d2724(m); }
+function d2726(n) { var m = n + 3; return d2725(m); }
+function d2727(n) { var m = n + 4; return d2726(m); }
+function d2728(n) { var m = n + 5; return d2727(m); }
+function d2729(n) { var m = n + 6; return d2728(m); }
+function d2730(n) { var m = n + 0; return d2729(m); }
+function d2731(n) { var m = n + 1; return d2730(m); }
+function d2732(n) { var m = n + 2; return d2731(m); }
+function d2733(n) { var m = n + 3; return d2732(m); }
+function d2734(n) { var m = n + 4; return d2733(m); }
+function d2735(n) { var m = n + 5; return d2734(m); }
+function d2736(n) { var m = n + 6; return d2735(m); }
+function d2737(n) { var m = n + 0; return d2736(m); }
+function d2738(n) { var m = n + 1; return d2737(m); }
+function d2739(n) { var m = n + 2; return d2738(m); }
+function d2740(n) { var m = n + 3; return d2739(m); }
+function d2741(n) { var m = n + 4; return d2740(m); }
+function d2742(n) { var m = n + 5; return d2741(m); }
+function d2743(n) { var m = n + 6; return d2742(m); }
+function d2744(n) { var m = n + 0; return d2743(m); }
+function d2745(n) { var m = n + 1; return d2744(m); }
+function d2746(n) { var m = n + 2; return d2745(m); }
+function d2747(n) { var m = n + 3; return d2746(m); }
+function d2748(n) { var m = n + 4; return d2747(m); }
+function d2749(n) { var m = n + 5; return d2748(m); }
+function d2750(n) { var m = n + 6; return d2749(m); }
+function d2751(n) { var m = n + 0; return d2750(m); }
+function d2752(n) { var m = n + 1; return d2751(m); }
+function d2753(n) { var m = n + 2; return d2752(m); }
+function d2754(n) { var m = n + 3; return d2753(m); }
+function d2755(n) { var m = n + 4; return d2754(m); }
+function d2756(n) { var m = n + 5; return d2755(m); }
+function d2757(n) { var m = n + 6; return d2756(m); }
+function d2758(n) { var m = n + 0; return d2757(m); }
+function d2759(n) { var m = n + 1; return d2758(m); }
+function d2760(n) { var m = n + 2; return d2759(m); }
+function d2761(n) { var m = n + 3; return d2760(m); }
+function d2762(n) { var m = n + 4; return d2761(m); }
+function d2763(n) { var m = n + 5; return d2762(m); }
+function d2764(n) { var m = n + 6; return d2763(m); }
+function d2765(n) { var m = n + 0; return d2764(m); }
+function d2766(n) { var m = n + 1; return d2765(m); }
+function d2767(n) { var m = n + 2; return d2766(m); }
+function d2768(n) { var m = n + 3; return d2767(m); }
+function d2769(n) { var m = n + 4; return d2768(m); }
+function d2770(n) { var m = n + 5; return d2769(m); }
+function d2771(n) { var m = n + 6; return d2770(m); }
+function d2772(n) { var m = n + 0; return d2771(m); }
+function d2773(n) { var m = n + 1; return d2772(m); }
+function d2774(n) { var m = n + 2; return d2773(m); }
+function d2775(n) { var m = n + 3; return d2774(m); }
+function d2776(n) { var m = n + 4; return d2775(m); }
+function d2777(n) { var m = n + 5; return d2776(m); }
+function d2778(n) { var m = n + 6; return d2777(m); }
+function d2779(n) { var m = n + 0; return d2778(m); }
+function d2780(n) { var m = n + 1; return d2779(m); }
+function d2781(n) { var m = n + 2; return d2780(m); }
+function d2782(n) { var m = n + 3; return d2781(m); }
+function d2783(n) { var m = n + 4; return d2782(m); }
+function d2784(n) { var m = n + 5; return d2783(m); }
+function d2785(n) { var m = n + 6; return d2784(m); }
+function d2786(n) { var m = n + 0; return d2785(m); }
+function d2787(n) { var m = n + 1; return d2786(m); }
+function d2788(n) { var m = n + 2; return d2787(m); }
+function d2789(n) { var m = n + 3; return d2788(m); }
+function d2790(n) { var m = n + 4; return d2789(m); }
+function d2791(n) { var m = n + 5; return d2790(m); }
+function d2792(n) { var m = n + 6; return d2791(m); }
+function d2793(n) { var m = n + 0; return d2792(m); }
+function d2794(n) { var m = n + 1; return d2793(m); }
+function d2795(n) { var m = n + 2; return d2794(m); }
+function d2796(n) { var m = n + 3; return d2795(m); }
+function d2797(n) { var m = n + 4; return d2796(m); }
+function d2798(n) { var m = n + 5; return d2797(m); }
+function d2799(n) { var m = n + 6; return d2798(m); }
+function d2800(n) { var m = n + 0; return d2799(m); }
+function d2801(n) { var m = n + 1; return d2800(m); }
+function d2802(n) { var m = n + 2; return d2801(m); }
+function d2803(n) { var m = n + 3; return d2802(m); }
+function d2804(n) { var m = n + 4; return d2803(m); }
+function d2805(n) { var m = n + 5; return d2804(m); }
+function d2806(n) { var m = n + 6; return d2805(m); }
+function d2807(n) { var m = n + 0; return d2806(m); }
+function d2808(n) { var m = n + 1; return d2807(m); }
+function d2809(n) { var m = n + 2; return d2808(m); }
+function d2810(n) { var m = n + 3; return d2809(m); }
+function d2811(n) { var m = n + 4; return d2810(m); }
+function d2812(n) { var m = n + 5; return d2811(m); }
+function d2813(n) { var m = n + 6; return d2812(m); }
+function d2814(n) { var m = n + 0; return d2813(m); }
+function d2815(n) { var m = n + 1; return d2814(m); }
+function d2816(n) { var m = n + 2; return d2815(m); }
+function d2817(n) { var m = n + 3; return d2816(m); }
+function d2818(n) { var m = n + 4; return d2817(m); }
+function d2819(n) { var m = n + 5; return d2818(m); }
+function d2820(n) { var m = n + 6; return d2819(m); }
+function d2821(n) { var m = n + 0; return d2820(m); }
+function d2822(n) { var m = n + 1; return d2821(m); }
+function d2823(n) { var m = n + 2; return d2822(m); }
+function d2824(n) { var m = n + 3; return d2823(m); }
+function d2825(n) { var m = n + 4; return d2824(m); }
+function d2826(n) { var m = n + 5; return d2825(m); }
+function d2827(n) { var m = n + 6; return d2826(m); }
+function d2828(n) { var m = n + 0; return d2827(m); }
+function d2829(n) { var m = n + 1; return d2828(m); }
+function d2830(n) { var m = n + 2; return d2829(m); }
+function d2831(n) { var m = n + 3; return d2830(m); }
+function d2832(n) { var m = n + 4; return d2831(m); }
+function d2833(n) { var m = n + 5; return d2832(m); }
+function d2834(n) { var m = n + 6; return d2833(m); }
+function d2835(n) { var m = n + 0; return d2834(m); }
+function d2836(n) { var m = n + 1; return d2835(m); }
+function d2837(n) { var m = n + 2; return d2836(m); }
+function d2838(n) { var m = n + 3; return d2837(m); }
+function d2839(n) { var m = n + 4; return d2838(m); }
+function d2840(n) { var m = n + 5; return d2839(m); }
+function d2841(n) { var m = n + 6; return d2840(m); }
+function d2842(n) { var m = n + 0; return d2841(m); }
+function d2843(n) { var m = n + 1; return d2842(m); }
+function d2844(n) { var m = n + 2; return d2843(m); }
+function d2845(n) { var m = n + 3; return d2844(m); }
+function d2846(n) { var m = n + 4; return d2845(m); }
+function d2847(n) { var m = n + 5; return d2846(m); }
+function d2848(n) { var m = n + 6; return d2847(m); }
+function d2849(n) { var m = n + 0; return d2848(m); }
+function d2850(n) { var m = n + 1; return d2849(m); }
+function d2851(n) { var m = n + 2; return d2850(m); }
+function d2852(n) { var m = n + 3; return d2851(m); }
+function d2853(n) { var m = n + 4; return d2852(m); }
+function d2854(n) { var m = n + 5; return d2853(m); }
+function d2855(n) { var m = n + 6; return d2854(m); }
+function d2856(n) { var m = n + 0; return d2855(m); }
+function d2857(n) { var m = n + 1; return d2856(m); }
+function d2858(n) { var m = n + 2; return d2857(m); }
+function d2859(n) { var m = n + 3; return d2858(m); }
+function d2860(n) { var m = n + 4; return d2859(m); }
+function d2861(n) { var m = n + 5; return d2860(m); }
+function d2862(n) { var m = n + 6; return d2861(m); }
+function d2863(n) { var m = n + 0; return d2862(m); }
+function d2864(n) { var m = n + 1; return d2863(m); }
+function d2865(n) { var m = n + 2; return d2864(m); }
+function d2866(n) { var m = n + 3; return d2865(m); }
+function d2867(n) { var m = n + 4; return d2866(m); }
+function d2868(n) { var m = n + 5; return d2867(m); }
+function d2869(n) { var m = n + 6; return d2868(m); }
+function d2870(n) { var m = n + 0; return d2869(m); }
+function d2871(n) { var m = n + 1; return d2870(m); }
+function d2872(n) { var m = n + 2; return d2871(m); }
+function d2873(n) { var m = n + 3; return d2872(m); }
+function d2874(n) { var m = n + 4; return d2873(m); }
+function d2875(n) { var m = n + 5; return d2874(m); }
+function d2876(n) { var m = n + 6; return d2875(m); }
+function d2877(n) { var m = n + 0; return d2876(m); }
+function d2878(n) { var m = n + 1; return d2877(m); }
+function d2879(n) { var m = n + 2; return d2878(m); }
+function d2880(n) { var m = n + 3; return d2879(m); }
+function d2881(n) { var m = n + 4; return d2880(m); }
+function d2882(n) { var m = n + 5; return d2881(m); }
+function d2883(n) { var m = n + 6; return d2882(m); }
+function d2884(n) { var m = n + 0; return d2883(m); }
+function d2885(n) { var m = n + 1; return d2884(m); }
+function d2886(n) { var m = n + 2; return d2885(m); }
+function d2887(n) { var m = n + 3; return d2886(m); }
+function d2888(n) { var m = n + 4; return d2887(m); }
+function d2889(n) { var m = n + 5; return d2888(m); }
+function d2890(n) { var m = n + 6; return d2889(m); }
+function d2891(n) { var m = n + 0; return d2890(m); }
+function d2892(n) { var m = n + 1; return d2891(m); }
+function d2893(n) { var m = n + 2; return d2892(m); }
+function d2894(n) { var m = n + 3; return d2893(m); }
+function d2895(n) { var m = n + 4; return d2894(m); }
+function d2896(n) { var m = n + 5; return d2895(m); }
+function d2897(n) { var m = n + 6; return d2896(m); }
+function d2898(n) { var m = n + 0; return d2897(m); }
+function d2899(n) { var m = n + 1; return d2898(m); }
+function d2900(n) { var m = n + 2; return d2899(m); }
+function d2901(n) { var m = n + 3; return d2900(m); }
+function d2902(n) { var m = n + 4; return d2901(m); }
+function d2903(n) { var m = n + 5; return d2902(m); }
+function d2904(n) { var m = n + 6; return d2903(m); }
+function d2905(n) { var m = n + 0; return d2904(m); }
+function d2906(n) { var m = n + 1; return d2905(m); }
+function d2907(n) { var m = n + 2; return d2906(m); }
+function d2908(n) { var m = n + 3; return d2907(m); }
+function d2909(n) { var m = n + 4; return d2908(m); }
+function d2910(n) { var m = n + 5; return d2909(m); }
+function d2911(n) { var m = n + 6; return d2910(m); }
+function d2912(n) { var m = n + 0; return d2911(m); }
+function d2913(n) { var m = n + 1; return d2912(m); }
+function d2914(n) { var m = n + 2; return d2913(m); }
+function d2915(n) { var m = n + 3; return d2914(m); }
+function d2916(n) { var m = n + 4; return d2915(m); }
+function d2917(n) { var m = n + 5; return d2916(m); }
+function d2918(n) { var m = n + 6; return d2917(m); }
+function d2919(n) { var m = n + 0; return d2918(m); }
+function d2920(n) { var m = n + 1; return d2919(m); }
+function d2921(n) { var m = n + 2; return d2920(m); }
+function d2922(n) { var m = n + 3; return d2921(m); }
+function d2923(n) { var m = n + 4; return d2922(m); }
+function d2924(n) { var m = n + 5; return d2923(m); }
+function d2925(n) { var m = n + 6; return d2924(m); }
+function d2926(n) { var m = n + 0; return d2925(m); }
+function d2927(n) { var m = n + 1; return d2926(m); }
+function d2928(n) { var m = n + 2; return d2927(m); }
+function d2929(n) { var m = n + 3; return d2928(m); }
+function d2930(n) { var m = n + 4; return d2929(m); }
+function d2931(n) { var m = n + 5; return d2930(m); }
+function d2932(n) { var m = n + 6; return d2931(m); }
+function d2933(n) { var m = n + 0; return d2932(m); }
+function d2934(n) { var m = n + 1; return d2933(m); }
+function d2935(n) { var m = n + 2; return d2934(m); }
+function d2936(n) { var m = n + 3; return d2935(m); }
+function d2937(n) { var m = n + 4; return d2936(m); }
+function d2938(n) { var m = n + 5; return d2937(m); }
+function d2939(n) { var m = n + 6; return d2938(m); }
+function d2940(n) { var m = n + 0; return d2939(m); }
+function d2941(n) { var m = n + 1; return d2940(m); }
+function d2942(n) { var m = n + 2; return d2941(m); }
+function d2943(n) { var m = n + 3; return d2942(m); }
+function d2944(n) { var m = n + 4; return d2943(m); }
+function d2945(n) { var m = n + 5; return d2944(m); }
+function d2946(n) { var m = n + 6; return d2945(m); }
+function d2947(n) { var m = n + 0; return d2946(m); }
+function d2948(n) { var m = n + 1; return d2947(m); }
+function d2949(n) { var m = n + 2; return d2948(m); }
+function d2950(n) { var m = n + 3; return d2949(m); }
+function d2951(n) { var m = n + 4; return d2950(m); }
+function d2952(n) { var m = n + 5; return d2951(m); }
+function d2953(n) { var m = n + 6; return d2952(m); }
+function d2954(n) { var m = n + 0; return d2953(m); }
+function d2955(n) { var m = n + 1; return d2954(m); }
+function d2956(n) { var m = n + 2; return d2955(m); }
+function d2957(n) { var m = n + 3; return d2956(m); }
+function d2958(n) { var m = n + 4; return d2957(m); }
+function d2959(n) { var m = n + 5; return d2958(m); }
+function d2960(n) { var m = n + 6; return d2959(m); }
+function d2961(n) { var m = n + 0; return d2960(m); }
+function d2962(n) { var m = n + 1; return d2961(m); }
+function d2963(n) { var m = n + 2; return d2962(m); }
+function d2964(n) { var m = n + 3; return d2963(m); }
+function d2965(n) { var m = n + 4; return d2964(m); }
+function d2966(n) { var m = n + 5; return d2965(m); }
+function d2967(n) { var m = n + 6; return d2966(m); }
+function d2968(n) { var m = n + 0; return d2967(m); }
+function d2969(n) { var m = n + 1; return d2968(m); }
+function d2970(n) { var m = n + 2; return d2969(m); }
+function d2971(n) { var m = n + 3; return d2970(m); }
+function d2972(n) { var m = n + 4; return d2971(m); }
+function d2973(n) { var m = n + 5; return d2972(m); }
+function d2974(n) { var m = n + 6; return d2973(m); }
+function d2975(n) { var m = n + 0; return d2974(m); }
+function d2976(n) { var m = n + 1; return d2975(m); }
+function d2977(n) { var m = n + 2; return d2976(m); }
+function d2978(n) { var m = n + 3; return d2977(m); }
+function d2979(n) { var m = n + 4; return d2978(m); }
+function d2980(n) { var m = n + 5; return d2979(m); }
+function d2981(n) { var m = n + 6; return d2980(m); }
+function d2982(n) { var m = n + 0; return d2981(m); }
+function d2983(n) { var m = n + 1; return d2982(m); }
+function d2984(n) { var m = n + 2; return d2983(m); }
+function d2985(n) { var m = n + 3; return d2984(m); }
+function d2986(n) { var m = n + 4; return d2985(m); }
+function d2987(n) { var m = n + 5; return d2986(m); }
+function d2988(n) { var m = n + 6; return d2987(m); }
+function d2989(n) { var m = n + 0; return d2988(m); }
+function d2990(n) { var m = n + 1; return d2989(m); }
+function d2991(n) { var m = n + 2; return d2990(m); }
+function d2992(n) { var m = n + 3; return d2991(m); }
+function d2993(n) { var m = n + 4; return d2992(m); }
+function d2994(n) { var m = n + 5; return d2993(m); }
+function d2995(n) { var m = n + 6; return d2994(m); }
+function d2996(n) { var m = n + 0; return d2995(m); }
+function d2997(n) { var m = n + 1; return d2996(m); }
+function d2998(n) { var m = n + 2; return d2997(m); }
+function d2999(n) { var m = n + 3; return d2998(m); }
+function d3000(n) { var m = n + 4; return d2999(m); }
+function d3001(n) { var m = n + 5; return d3000(m); }
+function d3002(n) { var m = n + 6; return d3001(m); }
+function d3003(n) { var m = n + 0; return d3002(m); }
+function d3004(n) { var m = n + 1; return d3003(m); }
+function d3005(n) { var m = n + 2; return d3004(m); }
+function d3006(n) { var m = n + 3; return d3005(m); }
+function d3007(n) { var m = n + 4; return d3006(m); }
+function d3008(n) { var m = n + 5; return d3007(m); }
+function d3009(n) { var m = n + 6; return d3008(m); }
+function d3010(n) { var m = n + 0; return d3009(m); }
+function d3011(n) { var m = n + 1; return d3010(m); }
+function d3012(n) { var m = n + 2; return d3011(m); }
+function d3013(n) { var m = n + 3; return d3012(m); }
+function d3014(n) { var m = n + 4; return d3013(m); }
+function d3015(n) { var m = n + 5; return d3014(m); }
+function d3016(n) { var m = n + 6; return d3015(m); }
+function d3017(n) { var m = n + 0; return d3016(m); }
+function d3018(n) { var m = n + 1; return d3017(m); }
+function d3019(n) { var m = n + 2; return d3018(m); }
+function d3020(n) { var m = n + 3; return d3019(m); }
+function d3021(n) { var m = n + 4; return d3020(m); }
+function d3022(n) { var m = n + 5; return d3021(m); }
+function d3023(n) { var m = n + 6; return d3022(m); }
+function d3024(n) { var m = n + 0; return d3023(m); }
+function d3025(n) { var m = n + 1; return d3024(m); }
+function d3026(n) { var m = n + 2; return d3025(m); }
+function d3027(n) { var m = n + 3; return d3026(m); }
+function d3028(n) { var m = n + 4; return d3027(m); }
+function d3029(n) { var m = n + 5; return d3028(m); }
+function d3030(n) { var m = n + 6; return d3029(m); }
+function d3031(n) { var m = n + 0; return d3030(m); }
+function d3032(n) { var m = n + 1; return d3031(m); }
+function d3033(n) { var m = n + 2; return d3032(m); }
+function d3034(n) { var m = n + 3; return d3033(m); }
+function d3035(n) { var m = n + 4; return d3034(m); }
+function d3036(n) { var m = n + 5; return d3035(m); }
+function d3037(n) { var m = n + 6; return d3036(m); }
+function d3038(n) { var m = n + 0; return d3037(m); }
+function d3039(n) { var m = n + 1; return d3038(m); }
+function d3040(n) { var m = n + 2; return d3039(m); }
+function d3041(n) { var m = n + 3; return d3040(m); }
+function d3042(n) { var m = n + 4; return d3041(m); }
+function d3043(n) { var m = n + 5; return d3042(m); }
+function d3044(n) { var m = n + 6; return d3043(m); }
+function d3045(n) { var m = n + 0; return d3044(m); }
+function d3046(n) { var m = n + 1; return d3045(m); }
+function d3047(n) { var m = n + 2; return d3046(m); }
+function d3048(n) { var m = n + 3; return d3047(m); }
+function d3049(n) { var m = n + 4; return d3048(m); }
+function d3050(n) { var m = n + 5; return d3049(m); }
+function d3051(n) { var m = n + 6; return d3050(m); }
+function d3052(n) { var m = n + 0; return d3051(m); }
+function d3053(n) { var m = n + 1; return d3052(m); }
+function d3054(n) { var m = n + 2; return d3053(m); }
+function d3055(n) { var m = n + 3; return d3054(m); }
+function d3056(n) { var m = n + 4; return d3055(m); }
+function d3057(n) { var m = n + 5; return d3056(m); }
+function d3058(n) { var m = n + 6; return d3057(m); }
+function d3059(n) { var m = n + 0; return d3058(m); }
+function d3060(n) { var m = n + 1; return d3059(m); }
+function d3061(n) { var m = n + 2; return d3060(m); }
+function d3062(n) { var m = n + 3; return d3061(m); }
+function d3063(n) { var m = n + 4; return d3062(m); }
+function d3064(n) { var m = n + 5; return d3063(m); }
+function d3065(n) { var m = n + 6; return d3064(m); }
+function d3066(n) { var m = n + 0; return d3065(m); }
+function d3067(n) { var m = n + 1; return d3066(m); }
+function d3068(n) { var m = n + 2; return d3067(m); }
+function d3069(n) { var m = n + 3; return d3068(m); }
+function d3070(n) { var m = n + 4; return d3069(m); }
+function d3071(n) { var m = n + 5; return d3070(m); }
+function d3072(n) { var m = n + 6; return d3071(m); }
+function d3073(n) { var m = n + 0; return d3072(m); }
+function d3074(n) { var m = n + 1; return d3073(m); }
+function d3075(n) { var m = n + 2; return d3074(m); }
+function d3076(n) { var m = n + 3; return d3075(m); }
+function d3077(n) { var m = n + 4; return d3076(m); }
+function d3078(n) { var m = n + 5; return d3077(m); }
+function d3079(n) { var m = n + 6; return d3078(m); }
+function d3080(n) { var m = n + 0; return d3079(m); }
+function d3081(n) { var m = n + 1; return d3080(m); }
+function d3082(n) { var m = n + 2; return d3081(m); }
+function d3083(n) { var m = n + 3; return d3082(m); }
+function d3084(n) { var m = n + 4; return d3083(m); }
+function d3085(n) { var m = n + 5; return d3084(m); }
+function d3086(n) { var m = n + 6; return d3085(m); }
+function d3087(n) { var m = n + 0; return d3086(m); }
+function d3088(n) { var m = n + 1; return d3087(m); }
+function d3089(n) { var m = n + 2; return d3088(m); }
+function d3090(n) { var m = n + 3; return d3089(m); }
+function d3091(n) { var m = n + 4; return d3090(m); }
+function d3092(n) { var m = n + 5; return d3091(m); }
+function d3093(n) { var m = n + 6; return d3092(m); }
+function d3094(n) { var m = n + 0; return d3093(m); }
+function d3095(n) { var m = n + 1; return d3094(m); }
+function d3096(n) { var m = n + 2; return d3095(m); }
+function d3097(n) { var m = n + 3; return d3096(m); }
+function d3098(n) { var m = n + 4; return d3097(m); }
+function d3099(n) { var m = n + 5; return d3098(m); }
+function d3100(n) { var m = n + 6; return d3099(m); }
+function d3101(n) { var m = n + 0; return d3100(m); }
+function d3102(n) { var m = n + 1; return d3101(m); }
+function d3103(n) { var m = n + 2; return d3102(m); }
+function d3104(n) { var m = n + 3; return d3103(m); }
+function d3105(n) { var m = n + 4; return d3104(m); }
+function d3106(n) { var m = n + 5; return d3105(m); }
+function d3107(n) { var m = n + 6; return d3106(m); }
+function d3108(n) { var m = n + 0; return d3107(m); }
+function d3109(n) { var m = n + 1; return d3108(m); }
+function d3110(n) { var m = n + 2; return d3109(m); }
+function d3111(n) { var m = n + 3; return d3110(m); }
+function d3112(n) { var m = n + 4; return d3111(m); }
+function d3113(n) { var m = n + 5; return d3112(m); }
+function d3114(n) { var m = n + 6; return d3113(m); }
+function d3115(n) { var m = n + 0; return d3114(m); }
+function d3116(n) { var m = n + 1; return d3115(m); }
+function d3117(n) { var m = n + 2; return d3116(m); }
+function d3118(n) { var m = n + 3; return d3117(m); }
+function d3119(n) { var m = n + 4; return d3118(m); }
+function d3120(n) { var m = n + 5; return d3119(m); }
+function d3121(n) { var m = n + 6; return d3120(m); }
+function d3122(n) { var m = n + 0; return d3121(m); }
+function d3123(n) { var m = n + 1; return d3122(m); }
+function d3124(n) { var m = n + 2; return d3123(m); }
+function d3125(n) { var m = n + 3; return d3124(m); }
+function d3126(n) { var m = n + 4; return d3125(m); }
+function d3127(n) { var m = n + 5; return d3126(m); }
+function d3128(n) { var m = n + 6; return d3127(m); }
+function d3129(n) { var m = n + 0; return d3128(m); }
+function d3130(n) { var m = n + 1; return d3129(m); }
+function d3131(n) { var m = n + 2; return d3130(m); }
+function d3132(n) { var m = n + 3; return d3131(m); }
+function d3133(n) { var m = n + 4; return d3132(m); }
+function d3134(n) { var m = n + 5; return d3133(m); }
+function d3135(n) { var m = n + 6; return d3134(m); }
+function d3136(n) { var m = n + 0; return d3135(m); }
+function d3137(n) { var m = n + 1; return d3136(m); }
+function d3138(n) { var m = n + 2; return d3137(m); }
+function d3139(n) { var m = n + 3; return d3138(m); }
+function d3140(n) { var m = n + 4; return d3139(m); }
+function d3141(n) { var m = n + 5; return d3140(m); }
+function d3142(n) { var m = n + 6; return d3141(m); }
+function d3143(n) { var m = n + 0; return d3142(m); }
+function d3144(n) { var m = n + 1; return d3143(m); }
+function d3145(n) { var m = n + 2; return d3144(m); }
+function d3146(n) { var m = n + 3; return d3145(m); }
+function d3147(n) { var m = n + 4; return d3146(m); }
+function d3148(n) { var m = n + 5; return d3147(m); }
+function d3149(n) { var m = n + 6; return d3148(m); }
+function d3150(n) { var m = n + 0; return d3149(m); }
+function d3151(n) { var m = n + 1; return d3150(m); }
+function d3152(n) { var m = n + 2; return d3151(m); }
+function d3153(n) { var m = n + 3; return d3152(m); }
+function d3154(n) { var m = n + 4; return d3153(m); }
+function d3155(n) { var m = n + 5; return d3154(m); }
+function d3156(n) { var m = n + 6; return d3155(m); }
+function d3157(n) { var m = n + 0; return d3156(m); }
+function d3158(n) { var m = n + 1; return d3157(m); }
+function d3159(n) { var m = n + 2; return d3158(m); }
+function d3160(n) { var m = n + 3; return d3159(m); }
+function d3161(n) { var m = n + 4; return d3160(m); }
+function d3162(n) { var m = n + 5; return d3161(m); }
+function d3163(n) { var m = n + 6; return d3162(m); }
+function d3164(n) { var m = n + 0; return d3163(m); }
+function d3165(n) { var m = n + 1; return d3164(m); }
+function d3166(n) { var m = n + 2; return d3165(m); }
+function d3167(n) { var m = n + 3; return d3166(m); }
+function d3168(n) { var m = n + 4; return d3167(m); }
+function d3169(n) { var m = n + 5; return d3168(m); }
+function d3170(n) { var m = n + 6; return d3169(m); }
+function d3171(n) { var m = n + 0; return d3170(m); }
+function d3172(n) { var m = n + 1; return d3171(m); }
+function d3173(n) { var m = n + 2; return d3172(m); }
+function d3174(n) { var m = n + 3; return d3173(m); }
+function d3175(n) { var m = n + 4; return d3174(m); }
+function d3176(n) { var m = n + 5; return d3175(m); }
+function d3177(n) { var m = n + 6; return d3176(m); }
+function d3178(n) { var m = n + 0; return d3177(m); }
+function d3179(n) { var m = n + 1; return d3178(m); }
+function d3180(n) { var m = n + 2; return d3179(m); }
+function d3181(n) { var m = n + 3; return d3180(m); }
+function d3182(n) { var m = n + 4; return d3181(m); }
+function d3183(n) { var m = n + 5; return d3182(m); }
+function d3184(n) { var m = n + 6; return d3183(m); }
+function d3185(n) { var m = n + 0; return d3184(m); }
+function d3186(n) { var m = n + 1; return d3185(m); }
+function d3187(n) { var m = n + 2; return d3186(m); }
+function d3188(n) { var m = n + 3; return d3187(m); }
+function d3189(n) { var m = n + 4; return d3188(m); }
+function d3190(n) { var m = n + 5; return d3189(m); }
+function d3191(n) { var m = n + 6; return d3190(m); }
+function d3192(n) { var m = n + 0; return d3191(m); }
+function d3193(n) { var m = n + 1; return d3192(m); }
+function d3194(n) { var m = n + 2; return d3193(m); }
+function d3195(n) { var m = n + 3; return d3194(m); }
+function d3196(n) { var m = n + 4; return d3195(m); }
+function d3197(n) { var m = n + 5; return d3196(m); }
+function d3198(n) { var m = n + 6; return d3197(m); }
+function d3199(n) { var m = n + 0; return d3198(m); }
+function d3200(n) { var m = n + 1; return d3199(m); }
+function d3201(n) { var m = n + 2; return d3200(m); }
+function d3202(n) { var m = n + 3; return d3201(m); }
+function d3203(n) { var m = n + 4; return d3202(m); }
+function d3204(n) { var m = n + 5; return d3203(m); }
+function d3205(n) { var m = n + 6; return d3204(m); }
+function d3206(n) { var m = n + 0; return d3205(m); }
+function d3207(n) { var m = n + 1; return d3206(m); }
+function d3208(n) { var m = n + 2; return d3207(m); }
+function d3209(n) { var m = n + 3; return d3208(m); }
+function d3210(n) { var m = n + 4; return d3209(m); }
+function d3211(n) { var m = n + 5; return d3210(m); }
+function d3212(n) { var m = n + 6; return d3211(m); }
+function d3213(n) { var m = n + 0; return d3212(m); }
+function d3214(n) { var m = n + 1; return d3213(m); }
+function d3215(n) { var m = n + 2; return d3214(m); }
+function d3216(n) { var m = n + 3; return d3215(m); }
+function d3217(n) { var m = n + 4; return d3216(m); }
+function d3218(n) { var m = n + 5; return d3217(m); }
+function d3219(n) { var m = n + 6; return d3218(m); }
+function d3220(n) { var m = n + 0; return d3219(m); }
+function d3221(n) { var m = n + 1; return d3220(m); }
+function d3222(n) { var m = n + 2; return d3221(m); }
+function d3223(n) { var m = n + 3; return d3222(m); }
+function d3224(n) { var m = n + 4; return d3223(m); }
+function d3225(n) { var m = n + 5; return d3224(m); }
+function d3226(n) { var m = n + 6; return d3225(m); }
+function d3227(n) { var m = n + 0; return d3226(m); }
+function d3228(n) { var m = n + 1; return d3227(m); }
+function d3229(n) { var m = n + 2; return d3228(m); }
+function d3230(n) { var m = n + 3; return d3229(m); }
+function d3231(n) { var m = n + 4; return d3230(m); }
+function d3232(n) { var m = n + 5; return d3231(m); }
+function d3233(n) { var m = n + 6; return d3232(m); }
+function d3234(n) { var m = n + 0; return d3233(m); }
+function d3235(n) { var m = n + 1; return d3234(m); }
+function d3236(n) { var m = n + 2; return d3235(m); }
+function d3237(n) { var m = n + 3; return d3236(m); }
+function d3238(n) { var m = n + 4; return d3237(m); }
+function d3239(n) { var m = n + 5; return d3238(m); }
+function d3240(n) { var m = n + 6; return d3239(m); }
+function d3241(n) { var m = n + 0; return d3240(m); }
+function d3242(n) { var m = n + 1; return d3241(m); }
+function d3243(n) { var m = n + 2; return d3242(m); }
+function d3244(n) { var m = n + 3; return d3243(m); }
+function d3245(n) { var m = n + 4; return d3244(m); }
+function d3246(n) { var m = n + 5; return d3245(m); }
+function d3247(n) { var m = n + 6; return d3246(m); }
+function d3248(n) { var m = n + 0; return d3247(m); }
+function d3249(n) { var m = n + 1; return d3248(m); }
+function d3250(n) { var m = n + 2; return d3249(m); }
+function d3251(n) { var m = n + 3; return d3250(m); }
+function d3252(n) { var m = n + 4; return d3251(m); }
+function d3253(n) { var m = n + 5; return d3252(m); }
+function d3254(n) { var m = n + 6; return d3253(m); }
+function d3255(n) { var m = n + 0; return d3254(m); }
+function d3256(n) { var m = n + 1; return d3255(m); }
+function d3257(n) { var m = n + 2; return d3256(m); }
+function d3258(n) { var m = n + 3; return d3257(m); }
+function d3259(n) { var m = n + 4; return d3258(m); }
+function d3260(n) { var m = n + 5; return d3259(m); }
+function d3261(n) { var m = n + 6; return d3260(m); }
+function d3262(n) { var m = n + 0; return d3261(m); }
+function d3263(n) { var m = n + 1; return d3262(m); }
+function d3264(n) { var m = n + 2; return d3263(m); }
+function d3265(n) { var m = n + 3; return d3264(m); }
+function d3266(n) { var m = n + 4; return d3265(m); }
+function d3267(n) { var m = n + 5; return d3266(m); }
+function d3268(n) { var m = n + 6; return d3267(m); }
+function d3269(n) { var m = n + 0; return d3268(m); }
+function d3270(n) { var m = n + 1; return d3269(m); }
+function d3271(n) { var m = n + 2; return d3270(m); }
+function d3272(n) { var m = n + 3; return d3271(m); }
+function d3273(n) { var m = n + 4; return d3272(m); }
+function d3274(n) { var m = n + 5; return d3273(m); }
+function d3275(n) { var m = n + 6; return d3274(m); }
+function d3276(n) { var m = n + 0; return d3275(m); }
+function d3277(n) { var m = n + 1; return d3276(m); }
+function d3278(n) { var m = n + 2; return d3277(m); }
+function d3279(n) { var m = n + 3; return d3278(m); }
+function d3280(n) { var m = n + 4; return d3279(m); }
+function d3281(n) { var m = n + 5; return d3280(m); }
+function d3282(n) { var m = n + 6; return d3281(m); }
+function d3283(n) { var m = n + 0; return d3282(m); }
+function d3284(n) { var m = n + 1; return d3283(m); }
+function d3285(n) { var m = n + 2; return d3284(m); }
+function d3286(n) { var m = n + 3; return d3285(m); }
+function d3287(n) { var m = n + 4; return d3286(m); }
+function d3288(n) { var m = n + 5; return d3287(m); }
+function d3289(n) { var m = n + 6; return d3288(m); }
+function d3290(n) { var m = n + 0; return d3289(m); }
+function d3291(n) { var m = n + 1; return d3290(m); }
+function d3292(n) { var m = n + 2; return d3291(m); }
+function d3293(n) { var m = n + 3; return d3292(m); }
+function d3294(n) { var m = n + 4; return d3293(m); }
+function d3295(n) { var m = n + 5; return d3294(m); }
+function d3296(n) { var m = n + 6; return d3295(m); }
+function d3297(n) { var m = n + 0; return d3296(m); }
+function d3298(n) { var m = n + 1; return d3297(m); }
+function d3299(n) { var m = n + 2; return d3298(m); }
+function d3300(n) { var m = n + 3; return d3299(m); }
+function d3301(n) { var m = n + 4; return d3300(m); }
+function d3302(n) { var m = n + 5; return d3301(m); }
+function d3303(n) { var m = n + 6; return d3302(m); }
+function d3304(n) { var m = n + 0; return d3303(m); }
+function d3305(n) { var m = n + 1; return d3304(m); }
+function d3306(n) { var m = n + 2; return d3305(m); }
+function d3307(n) { var m = n + 3; return d3306(m); }
+function d3308(n) { var m = n + 4; return d3307(m); }
+function d3309(n) { var m = n + 5; return d3308(m); }
+function d3310(n) { var m = n + 6; return d3309(m); }
+function d3311(n) { var m = n + 0; return d3310(m); }
+function d3312(n) { var m = n + 1; return d3311(m); }
+function d3313(n) { var m = n + 2; return d3312(m); }
+function d3314(n) { var m = n + 3; return d3313(m); }
+function d3315(n) { var m = n + 4; return d3314(m); }
+function d3316(n) { var m = n + 5; return d3315(m); }
+function d3317(n) { var m = n + 6; return d3316(m); }
+function d3318(n) { var m = n + 0; return d3317(m); }
+function d3319(n) { var m = n + 1; return d3318(m); }
+function d3320(n) { var m = n + 2; return d3319(m); }
+function d3321(n) { var m = n + 3; return d3320(m); }
+function d3322(n) { var m = n + 4; return d3321(m); }
+function d3323(n) { var m = n + 5; return d3322(m); }
+function d3324(n) { var m = n + 6; return d3323(m); }
+function d3325(n) { var m = n + 0; return d3324(m); }
+function d3326(n) { var m = n + 1; return d3325(m); }
+function d3327(n) { var m = n + 2; return d3326(m); }
+function d3328(n) { var m = n + 3; return d3327(m); }
+function d3329(n) { var m = n + 4; return d3328(m); }
+function d3330(n) { var m = n + 5; return d3329(m); }
+function d3331(n) { var m = n + 6; return d3330(m); }
+function d3332(n) { var m = n + 0; return d3331(m); }
+function d3333(n) { var m = n + 1; return d3332(m); }
+function d3334(n) { var m = n + 2; return d3333(m); }
+function d3335(n) { var m = n + 3; return d3334(m); }
+function d3336(n) { var m = n + 4; return d3335(m); }
+function d3337(n) { var m = n + 5; return d3336(m); }
+function d3338(n) { var m = n + 6; return d3337(m); }
+function d3339(n) { var m = n + 0; return d3338(m); }
+function d3340(n) { var m = n + 1; return d3339(m); }
+function d3341(n) { var m = n + 2; return d3340(m); }
+function d3342(n) { var m = n + 3; return d3341(m); }
+function d3343(n) { var m = n + 4; return d3342(m); }
+function d3344(n) { var m = n + 5; return d3343(m); }
+function d3345(n) { var m = n + 6; return d3344(m); }
+function d3346(n) { var m = n + 0; return d3345(m); }
+function d3347(n) { var m = n + 1; return d3346(m); }
+function d3348(n) { var m = n + 2; return d3347(m); }
+function d3349(n) { var m = n + 3; return d3348(m); }
+function d3350(n) { var m = n + 4; return d3349(m); }
+function d3351(n) { var m = n + 5; return d3350(m); }
+function d3352(n) { var m = n + 6; return d3351(m); }
+function d3353(n) { var m = n + 0; return d3352(m); }
+function d3354(n) { var m = n + 1; return d3353(m); }
+function d3355(n) { var m = n + 2; return d3354(m); }
+function d3356(n) { var m = n + 3; return d3355(m); }
+function d3357(n) { var m = n + 4; return d3356(m); }
+function d3358(n) { var m = n + 5; return d3357(m); }
+function d3359(n) { var m = n + 6; return d3358(m); }
+function d3360(n) { var m = n + 0; return d3359(m); }
+function d3361(n) { var m = n + 1; return d3360(m); }
+function d3362(n) { var m = n + 2; return d3361(m); }
+function d3363(n) { var m = n + 3; return d3362(m); }
+function d3364(n) { var m = n + 4; return d3363(m); }
+function d3365(n) { var m = n + 5; return d3364(m); }
+function d3366(n) { var m = n + 6; return d3365(m); }
+function d3367(n) { var m = n + 0; return d3366(m); }
+function d3368(n) { var m = n + 1; return d3367(m); }
+function d3369(n) { var m = n + 2; return d3368(m); }
+function d3370(n) { var m = n + 3; return d3369(m); }
+function d3371(n) { var m = n + 4; return d3370(m); }
+function d3372(n) { var m = n + 5; return d3371(m); }
+function d3373(n) { var m = n + 6; return d3372(m); }
+function d3374(n) { var m = n + 0; return d3373(m); }
+function d3375(n) { var m = n + 1; return d3374(m); }
+function d3376(n) { var m = n + 2; return d3375(m); }
+function d3377(n) { var m = n + 3; return d3376(m); }
+function d3378(n) { var m = n + 4; return d3377(m); }
+function d3379(n) { var m = n + 5; return d3378(m); }
+function d3380(n) { var m = n + 6; return d3379(m); }
+function d3381(n) { var m = n + 0; return d3380(m); }
+function d3382(n) { var m = n + 1; return d3381(m); }
+function d3383(n) { var m = n + 2; return d3382(m); }
+function d3384(n) { var m = n + 3; return d3383(m); }
+function d3385(n) { var m = n + 4; return d3384(m); }
+function d3386(n) { var m = n + 5; return d3385(m); }
+function d3387(n) { var m = n + 6; return d3386(m); }
+function d3388(n) { var m = n + 0; return d3387(m); }
+function d3389(n) { var m = n + 1; return d3388(m); }
+function d3390(n) { var m = n + 2; return d3389(m); }
+function d3391(n) { var m = n + 3; return d3390(m); }
+function d3392(n) { var m = n + 4; return d3391(m); }
+function d3393(n) { var m = n + 5; return d3392(m); }
+function d3394(n) { var m = n + 6; return d3393(m); }
+function d3395(n) { var m = n + 0; return d3394(m); }
+function d3396(n) { var m = n + 1; return d3395(m); }
+function d3397(n) { var m = n + 2; return d3396(m); }
+function d3398(n) { var m = n + 3; return d3397(m); }
+function d3399(n) { var m = n + 4; return d3398(m); }
+function d3400(n) { var m = n + 5; return d3399(m); }
+function d3401(n) { var m = n + 6; return d3400(m); }
+function d3402(n) { var m = n + 0; return d3401(m); }
+function d3403(n) { var m = n + 1; return d3402(m); }
+function d3404(n) { var m = n + 2; return d3403(m); }
+function d3405(n) { var m = n + 3; return d3404(m); }
+function d3406(n) { var m = n + 4; return d3405(m); }
+function d3407(n) { var m = n + 5; return d3406(m); }
+function d3408(n) { var m = n + 6; return d3407(m); }
+function d3409(n) { var m = n + 0; return d3408(m); }
+function d3410(n) { var m = n + 1; return d3409(m); }
+function d3411(n) { var m = n + 2; return d3410(m); }
+function d3412(n) { var m = n + 3; return d3411(m); }
+function d3413(n) { var m = n + 4; return d3412(m); }
+function d3414(n) { var m = n + 5; return d3413(m); }
+function d3415(n) { var m = n + 6; return d3414(m); }
+function d3416(n) { var m = n + 0; return d3415(m); }
+function d3417(n) { var m = n + 1; return d3416(m); }
+function d3418(n) { var m = n + 2; return d3417(m); }
+function d3419(n) { var m = n + 3; return d3418(m); }
+function d3420(n) { var m = n + 4; return d3419(m); }
+function d3421(n) { var m = n + 5; return d3420(m); }
+function d3422(n) { var m = n + 6; return d3421(m); }
+function d3423(n) { var m = n + 0; return d3422(m); }
+function d3424(n) { var m = n + 1; return d3423(m); }
+function d3425(n) { var m = n + 2; return d3424(m); }
+function d3426(n) { var m = n + 3; return d3425(m); }
+function d3427(n) { var m = n + 4; return d3426(m); }
+function d3428(n) { var m = n + 5; return d3427(m); }
+function d3429(n) { var m = n + 6; return d3428(m); }
+function d3430(n) { var m = n + 0; return d3429(m); }
+function d3431(n) { var m = n + 1; return d3430(m); }
+function d3432(n) { var m = n + 2; return d3431(m); }
+function d3433(n) { var m = n + 3; return d3432(m); }
+function d3434(n) { var m = n + 4; return d3433(m); }
+function d3435(n) { var m = n + 5; return d3434(m); }
+function d3436(n) { var m = n + 6; return d3435(m); }
+function d3437(n) { var m = n + 0; return d3436(m); }
+function d3438(n) { var m = n + 1; return d3437(m); }
+function d3439(n) { var m = n + 2; return d3438(m); }
+function d3440(n) { var m = n + 3; return d3439(m); }
+function d3441(n) { var m = n + 4; return d3440(m); }
+function d3442(n) { var m = n + 5; return d3441(m); }
+function d3443(n) { var m = n + 6; return d3442(m); }
+function d3444(n) { var m = n + 0; return d3443(m); }
+function d3445(n) { var m = n + 1; return d3444(m); }
+function d3446(n) { var m = n + 2; return d3445(m); }
+function d3447(n) { var m = n + 3; return d3446(m); }
+function d3448(n) { var m = n + 4; return d3447(m); }
+function d3449(n) { var m = n + 5; return d3448(m); }
+function d3450(n) { var m = n + 6; return d3449(m); }
+function d3451(n) { var m = n + 0; return d3450(m); }
+function d3452(n) { var m = n + 1; return d3451(m); }
+function d3453(n) { var m = n + 2; return d3452(m); }
+function d3454(n) { var m = n + 3; return d3453(m); }
+function d3455(n) { var m = n + 4; return d3454(m); }
+function d3456(n) { var m = n + 5; return d3455(m); }
+function d3457(n) { var m = n + 6; return d3456(m); }
+function d3458(n) { var m = n + 0; return d3457(m); }
+function d3459(n) { var m = n + 1; return d3458(m); }
+function d3460(n) { var m = n + 2; return d3459(m); }
+function d3461(n) { var m = n + 3; return d3460(m); }
+function d3462(n) { var m = n + 4; return d3461(m); }
+function d3463(n) { var m = n + 5; return d3462(m); }
+function d3464(n) { var m = n + 6; return d3463(m); }
+function d3465(n) { var m = n + 0; return d3464(m); }
+function d3466(n) { var m = n + 1; return d3465(m); }
+function d3467(n) { var m = n + 2; return d3466(m); }
+function d3468(n) { var m = n + 3; return d3467(m); }
+function d3469(n) { var m = n + 4; return d3468(m); }
+function d3470(n) { var m = n + 5; return d3469(m); }
+function d3471(n) { var m = n + 6; return d3470(m); }
+function d3472(n) { var m = n + 0; return d3471(m); }
+function d3473(n) { var m = n + 1; return d3472(m); }
+function d3474(n) { var m = n + 2; return d3473(m); }
+function d3475(n) { var m = n + 3; return d3474(m); }
+function d3476(n) { var m = n + 4; return d3475(m); }
+function d3477(n) { var m = n + 5; return d3476(m); }
+function d3478(n) { var m = n + 6; return d3477(m); }
+function d3479(n) { var m = n + 0; return d3478(m); }
+function d3480(n) { var m = n + 1; return d3479(m); }
+function d3481(n) { var m = n + 2; return d3480(m); }
+function d3482(n) { var m = n + 3; return d3481(m); }
+function d3483(n) { var m = n + 4; return d3482(m); }
+function d3484(n) { var m = n + 5; return d3483(m); }
+function d3485(n) { var m = n + 6; return d3484(m); }
+function d3486(n) { var m = n + 0; return d3485(m); }
+function d3487(n) { var m = n + 1; return d3486(m); }
+function d3488(n) { var m = n + 2; return d3487(m); }
+function d3489(n) { var m = n + 3; return d3488(m); }
+function d3490(n) { var m = n + 4; return d3489(m); }
+function d3491(n) { var m = n + 5; return d3490(m); }
+function d3492(n) { var m = n + 6; return d3491(m); }
+function d3493(n) { var m = n + 0; return d3492(m); }
+function d3494(n) { var m = n + 1; return d3493(m); }
+function d3495(n) { var m = n + 2; return d3494(m); }
+function d3496(n) { var m = n + 3; return d3495(m); }
+function d3497(n) { var m = n + 4; return d3496(m); }
+function d3498(n) { var m = n + 5; return d3497(m); }
+function d3499(n) { var m = n + 6; return d3498(m); }
+function d3500(n) { var m = n + 0; return d3499(m); }
+function d3501(n) { var m = n + 1; return d3500(m); }
+function d3502(n) { var m = n + 2; return d3501(m); }
+function d3503(n) { var m = n + 3; return d3502(m); }
+function d3504(n) { var m = n + 4; return d3503(m); }
+function d3505(n) { var m = n + 5; return d3504(m); }
+function d3506(n) { var m = n + 6; return d3505(m); }
+function d3507(n) { var m = n + 0; return d3506(m); }
+function d3508(n) { var m = n + 1; return d3507(m); }
+function d3509(n) { var m = n + 2; return d3508(m); }
+function d3510(n) { var m = n + 3; return d3509(m); }
+function d3511(n) { var m = n + 4; return d3510(m); }
+function d3512(n) { var m = n + 5; return d3511(m); }
+function d3513(n) { var m = n + 6; return d3512(m); }
+function d3514(n) { var m = n + 0; return d3513(m); }
+function d3515(n) { var m = n + 1; return d3514(m); }
+function d3516(n) { var m = n + 2; return d3515(m); }
+function d3517(n) { var m = n + 3; return d3516(m); }
+function d3518(n) { var m = n + 4; return d3517(m); }
+function d3519(n) { var m = n + 5; return d3518(m); }
+function d3520(n) { var m = n + 6; return d3519(m); }
+function d3521(n) { var m = n + 0; return d3520(m); }
+function d3522(n) { var m = n + 1; return d3521(m); }
+function d3523(n) { var m = n + 2; return d3522(m); }
+function d3524(n) { var m = n + 3; return d3523(m); }
+function d3525(n) { var m = n + 4; return d3524(m); }
+function d3526(n) { var m = n + 5; return d3525(m); }
+function d3527(n) { var m = n + 6; return d3526(m); }
+function d3528(n) { var m = n + 0; return d3527(m); }
+function d3529(n) { var m = n + 1; return d3528(m); }
+function d3530(n) { var m = n + 2; return d3529(m); }
+function d3531(n) { var m = n + 3; return d3530(m); }
+function d3532(n) { var m = n + 4; return d3531(m); }
+function d3533(n) { var m = n + 5; return d3532(m); }
+function d3534(n) { var m = n + 6; return d3533(m); }
+function d3535(n) { var m = n + 0; return d3534(m); }
+function d3536(n) { var m = n + 1; return d3535(m); }
+function d3537(n) { var m = n + 2; return d3536(m); }
+function d3538(n) { var m = n + 3; return d3537(m); }
+function d3539(n) { var m = n + 4; return d3538(m); }
+function d3540(n) { var m = n + 5; return d3539(m); }
+function d3541(n) { var m = n + 6; return d3540(m); }
+function d3542(n) { var m = n + 0; return d3541(m); }
+function d3543(n) { var m = n + 1; return d3542(m); }
+function d3544(n) { var m = n + 2; return d3543(m); }
+function d3545(n) { var m = n + 3; return d3544(m); }
+function d3546(n) { var m = n + 4; return d3545(m); }
+function d3547(n) { var m = n + 5; return d3546(m); }
+function d3548(n) { var m = n + 6; return d3547(m); }
+function d3549(n) { var m = n + 0; return d3548(m); }
+function d3550(n) { var m = n + 1; return d3549(m); }
+function d3551(n) { var m = n + 2; return d3550(m); }
+function d3552(n) { var m = n + 3; return d3551(m); }
+function d3553(n) { var m = n + 4; return d3552(m); }
+function d3554(n) { var m = n + 5; return d3553(m); }
+function d3555(n) { var m = n + 6; return d3554(m); }
+function d3556(n) { var m = n + 0; return d3555(m); }
+function d3557(n) { var m = n + 1; return d3556(m); }
+function d3558(n) { var m = n + 2; return d3557(m); }
+function d3559(n) { var m = n + 3; return d3558(m); }
+function d3560(n) { var m = n + 4; return d3559(m); }
+function d3561(n) { var m = n + 5; return d3560(m); }
+function d3562(n) { var m = n + 6; return d3561(m); }
+function d3563(n) { var m = n + 0; return d3562(m); }
+function d3564(n) { var m = n + 1; return d3563(m); }
+function d3565(n) { var m = n + 2; return d3564(m); }
+function d3566(n) { var m = n + 3; return d3565(m); }
+function d3567(n) { var m = n + 4; return d3566(m); }
+function d3568(n) { var m = n + 5; return d3567(m); }
+function d3569(n) { var m = n + 6; return d3568(m); }
+function d3570(n) { var m = n + 0; return d3569(m); }
+function d3571(n) { var m = n + 1; return d3570(m); }
+function d3572(n) { var m = n + 2; return d3571(m); }
+function d3573(n) { var m = n + 3; return d3572(m); }
+function d3574(n) { var m = n + 4; return d3573(m); }
+function d3575(n) { var m = n + 5; return d3574(m); }
+function d3576(n) { var m = n + 6; return d3575(m); }
+function d3577(n) { var m = n + 0; return d3576(m); }
+function d3578(n) { var m = n + 1; return d3577(m); }
+function d3579(n) { var m = n + 2; return d3578(m); }
+function d3580(n) { var m = n + 3; return d3579(m); }
+function d3581(n) { var m = n + 4; return d3580(m); }
+function d3582(n) { var m = n + 5; return d3581(m); }
+function d3583(n) { var m = n + 6; return d3582(m); }
+function d3584(n) { var m = n + 0; return d3583(m); }
+function d3585(n) { var m = n + 1; return d3584(m); }
+function d3586(n) { var m = n + 2; return d3585(m); }
+function d3587(n) { var m = n + 3; return d3586(m); }
+function d3588(n) { var m = n + 4; return d3587(m); }
+function d3589(n) { var m = n + 5; return d3588(m); }
+function d3590(n) { var m = n + 6; return d3589(m); }
+function d3591(n) { var m = n + 0; return d3590(m); }
+function d3592(n) { var m = n + 1; return d3591(m); }
+function d3593(n) { var m = n + 2; return d3592(m); }
+function d3594(n) { var m = n + 3; return d3593(m); }
+function d3595(n) { var m = n + 4; return d3594(m); }
+function d3596(n) { var m = n + 5; return d3595(m); }
+function d3597(n) { var m = n + 6; return d3596(m); }
+function d3598(n) { var m = n + 0; return d3597(m); }
+function d3599(n) { var m = n + 1; return d3598(m); }
+function d3600(n) { var m = n + 2; return d3599(m); }
+function d3601(n) { var m = n + 3; return d3600(m); }
+function d3602(n) { var m = n + 4; return d3601(m); }
+function d3603(n) { var m = n + 5; return d3602(m); }
+function d3604(n) { var m = n + 6; return d3603(m); }
+function d3605(n) { var m = n + 0; return d3604(m); }
+function d3606(n) { var m = n + 1; return d3605(m); }
+function d3607(n) { var m = n + 2; return d3606(m); }
+function d3608(n) { var m = n + 3; return d3607(m); }
+function d3609(n) { var m = n + 4; return d3608(m); }
+function d3610(n) { var m = n + 5; return d3609(m); }
+function d3611(n) { var m = n + 6; return d3610(m); }
+function d3612(n) { var m = n + 0; return d3611(m); }
+function d3613(n) { var m = n + 1; return d3612(m); }
+function d3614(n) { var m = n + 2; return d3613(m); }
+function d3615(n) { var m = n + 3; return d3614(m); }
+function d3616(n) { var m = n + 4; return d3615(m); }
+function d3617(n) { var m = n + 5; return d3616(m); }
+function d3618(n) { var m = n + 6; return d3617(m); }
+function d3619(n) { var m = n + 0; return d3618(m); }
+function d3620(n) { var m = n + 1; return d3619(m); }
+function d3621(n) { var m = n + 2; return d3620(m); }
+function d3622(n) { var m = n + 3; return d3621(m); }
+function d3623(n) { var m = n + 4; return d3622(m); }
+function d3624(n) { var m = n + 5; return d3623(m); }
+function d3625(n) { var m = n + 6; return d3624(m); }
+function d3626(n) { var m = n + 0; return d3625(m); }
+function d3627(n) { var m = n + 1; return d3626(m); }
+function d3628(n) { var m = n + 2; return d3627(m); }
+function d3629(n) { var m = n + 3; return d3628(m); }
+function d3630(n) { var m = n + 4; return d3629(m); }
+function d3631(n) { var m = n + 5; return d3630(m); }
+function d3632(n) { var m = n + 6; return d3631(m); }
+function d3633(n) { var m = n + 0; return d3632(m); }
+function d3634(n) { var m = n + 1; return d3633(m); }
+function d3635(n) { var m = n + 2; return d3634(m); }
+function d3636(n) { var m = n + 3; return d3635(m); }
+function d3637(n) { var m = n + 4; return d3636(m); }
+function d3638(n) { var m = n + 5; return d3637(m); }
+function d3639(n) { var m = n + 6; return d3638(m); }
+function d3640(n) { var m = n + 0; return d3639(m); }
+function d3641(n) { var m = n + 1; return d3640(m); }
+function d3642(n) { var m = n + 2; return d3641(m); }
+function d3643(n) { var m = n + 3; return d3642(m); }
+function d3644(n) { var m = n + 4; return d3643(m); }
+function d3645(n) { var m = n + 5; return d3644(m); }
+function d3646(n) { var m = n + 6; return d3645(m); }
+function d3647(n) { var m = n + 0; return d3646(m); }
+function d3648(n) { var m = n + 1; return d3647(m); }
+function d3649(n) { var m = n + 2; return d3648(m); }
+function d3650(n) { var m = n + 3; return d3649(m); }
+function d3651(n) { var m = n + 4; return d3650(m); }
+function d3652(n) { var m = n + 5; return d3651(m); }
+function d3653(n) { var m = n + 6; return d3652(m); }
+function d3654(n) { var m = n + 0; return d3653(m); }
+function d3655(n) { var m = n + 1; return d3654(m); }
+function d3656(n) { var m = n + 2; return d3655(m); }
+function d3657(n) { var m = n + 3; return d3656(m); }
+function d3658(n) { var m = n + 4; return d3657(m); }
+function d3659(n) { var m = n + 5; return d3658(m); }
+function d3660(n) { var m = n + 6; return d3659(m); }
+function d3661(n) { var m = n + 0; return d3660(m); }
+function d3662(n) { var m = n + 1; return d3661(m); }
+function d3663(n) { var m = n + 2; return d3662(m); }
+function d3664(n) { var m = n + 3; return d3663(m); }
+function d3665(n) { var m = n + 4; return d3664(m); }
+function d3666(n) { var m = n + 5; return d3665(m); }
+function d3667(n) { var m = n + 6; return d3666(m); }
+function d3668(n) { var m = n + 0; return d3667(m); }
+function d3669(n) { var m = n + 1; return d3668(m); }
+function d3670(n) { var m = n + 2; return d3669(m); }
+function d3671(n) { var m = n + 3; return d3670(m); }
+function d3672(n) { var m = n + 4; return d3671(m); }
+function d3673(n) { var m = n + 5; return d3672(m); }
+function d3674(n) { var m = n + 6; return d3673(m); }
+function d3675(n) { var m = n + 0; return d3674(m); }
+function d3676(n) { var m = n + 1; return d3675(m); }
+function d3677(n) { var m = n + 2; return d3676(m); }
+function d3678(n) { var m = n + 3; return d3677(m); }
+function d3679(n) { var m = n + 4; return d3678(m); }
+function d3680(n) { var m = n + 5; return d3679(m); }
+function d3681(n) { var m = n + 6; return d3680(m); }
+function d3682(n) { var m = n + 0; return d3681(m); }
+function d3683(n) { var m = n + 1; return d3682(m); }
+function d3684(n) { var m = n + 2; return d3683(m); }
+function d3685(n) { var m = n + 3; return d3684(m); }
+function d3686(n) { var m = n + 4; return d3685(m); }
+function d3687(n) { var m = n + 5; return d3686(m); }
+function d3688(n) { var m = n + 6; return d3687(m); }
+function d3689(n) { var m = n + 0; return d3688(m); }
+function d3690(n) { var m = n + 1; return d3689(m); }
+function d3691(n) { var m = n + 2; return d3690(m); }
+function d3692(n) { var m = n + 3; return d3691(m); }
+function d3693(n) { var m = n + 4; return d3692(m); }
+function d3694(n) { var m = n + 5; return d3693(m); }
+function d3695(n) { var m = n + 6; return d3694(m); }
+function d3696(n) { var m = n + 0; return d3695(m); }
+function d3697(n) { var m = n + 1; return d3696(m); }
+function d3698(n) { var m = n + 2; return d3697(m); }
+function d3699(n) { var m = n + 3; return d3698(m); }
+function d3700(n) { var m = n + 4; return d3699(m); }
+function d3701(n) { var m = n + 5; return d3700(m); }
+function d3702(n) { var m = n + 6; return d3701(m); }
+function d3703(n) { var m = n + 0; return d3702(m); }
+function d3704(n) { var m = n + 1; return d3703(m); }
+function d3705(n) { var m = n + 2; return d3704(m); }
+function d3706(n) { var m = n + 3; return d3705(m); }
+function d3707(n) { var m = n + 4; return d3706(m); }
+function d3708(n) { var m = n + 5; return d3707(m); }
+function d3709(n) { var m = n + 6; return d3708(m); }
+function d3710(n) { var m = n + 0; return d3709(m); }
+function d3711(n) { var m = n + 1; return d3710(m); }
+function d3712(n) { var m = n + 2; return d3711(m); }
+function d3713(n) { var m = n + 3; return d3712(m); }
+function d3714(n) { var m = n + 4; return d3713(m); }
+function d3715(n) { var m = n + 5; return d3714(m); }
+function d3716(n) { var m = n + 6; return d3715(m); }
+function d3717(n) { var m = n + 0; return d3716(m); }
+function d3718(n) { var m = n + 1; return d3717(m); }
+function d3719(n) { var m = n + 2; return d3718(m); }
+function d3720(n) { var m = n + 3; return d3719(m); }
+function d3721(n) { var m = n + 4; return d3720(m); }
+function d3722(n) { var m = n + 5; return d3721(m); }
+function d3723(n) { var m = n + 6; return d3722(m); }
+function d3724(n) { var m = n + 0; return d3723(m); }
+function d3725(n) { var m = n + 1; return d3724(m); }
+function d3726(n) { var m = n + 2; return d3725(m); }
+function d3727(n) { var m = n + 3; return d3726(m); }
+function d3728(n) { var m = n + 4; return d3727(m); }
+function d3729(n) { var m = n + 5; return d3728(m); }
+function d3730(n) { var m = n + 6; return d3729(m); }
+function d3731(n) { var m = n + 0; return d3730(m); }
+function d3732(n) { var m = n + 1; return d3731(m); }
+function d3733(n) { var m = n + 2; return d3732(m); }
+function d3734(n) { var m = n + 3; return d3733(m); }
+function d3735(n) { var m = n + 4; return d3734(m); }
+function d3736(n) { var m = n + 5; return d3735(m); }
+function d3737(n) { var m = n + 6; return d3736(m); }
+function d3738(n) { var m = n + 0; return d3737(m); }
+function d3739(n) { var m = n + 1; return d3738(m); }
+function d3740(n) { var m = n + 2; return d3739(m); }
+function d3741(n) { var m = n + 3; return d3740(m); }
+function d3742(n) { var m = n + 4; return d3741(m); }
+function d3743(n) { var m = n + 5; return d3742(m); }
+function d3744(n) { var m = n + 6; return d3743(m); }
+function d3745(n) { var m = n + 0; return d3744(m); }
+function d3746(n) { var m = n + 1; return d3745(m); }
+function d3747(n) { var m = n + 2; return d3746(m); }
+function d3748(n) { var m = n + 3; return d3747(m); }
+function d3749(n) { var m = n + 4; return d3748(m); }
+function d3750(n) { var m = n + 5; return d3749(m); }
+function d3751(n) { var m = n + 6; return d3750(m); }
+function d3752(n) { var m = n + 0; return d3751(m); }
+function d3753(n) { var m = n + 1; return d3752(m); }
+function d3754(n) { var m = n + 2; return d3753(m); }
+function d3755(n) { var m = n + 3; return d3754(m); }
+function d3756(n) { var m = n + 4; return d3755(m); }
+function d3757(n) { var m = n + 5; return d3756(m); }
+function d3758(n) { var m = n + 6; return d3757(m); }
+function d3759(n) { var m = n + 0; return d3758(m); }
+function d3760(n) { var m = n + 1; return d3759(m); }
+function d3761(n) { var m = n + 2; return d3760(m); }
+function d3762(n) { var m = n + 3; return d3761(m); }
+function d3763(n) { var m = n + 4; return d3762(m); }
+function d3764(n) { var m = n + 5; return d3763(m); }
+function d3765(n) { var m = n + 6; return d3764(m); }
+function d3766(n) { var m = n + 0; return d3765(m); }
+function d3767(n) { var m = n + 1; return d3766(m); }
+function d3768(n) { var m = n + 2; return d3767(m); }
+function d3769(n) { var m = n + 3; return d3768(m); }
+function d3770(n) { var m = n + 4; return d3769(m); }
+function d3771(n) { var m = n + 5; return d3770(m); }
+function d3772(n) { var m = n + 6; return d3771(m); }
+function d3773(n) { var m = n + 0; return d3772(m); }
+function d3774(n) { var m = n + 1; return d3773(m); }
+function d3775(n) { var m = n + 2; return d3774(m); }
+function d3776(n) { var m = n + 3; return d3775(m); }
+function d3777(n) { var m = n + 4; return d3776(m); }
+function d3778(n) { var m = n + 5; return d3777(m); }
+function d3779(n) { var m = n + 6; return d3778(m); }
+function d3780(n) { var m = n + 0; return d3779(m); }
+function d3781(n) { var m = n + 1; return d3780(m); }
+function d3782(n) { var m = n + 2; return d3781(m); }
+function d3783(n) { var m = n + 3; return d3782(m); }
+function d3784(n) { var m = n + 4; return d3783(m); }
+function d3785(n) { var m = n + 5; return d3784(m); }
+function d3786(n) { var m = n + 6; return d3785(m); }
+function d3787(n) { var m = n + 0; return d3786(m); }
+function d3788(n) { var m = n + 1; return d3787(m); }
+function d3789(n) { var m = n + 2; return d3788(m); }
+function d3790(n) { var m = n + 3; return d3789(m); }
+function d3791(n) { var m = n + 4; return d3790(m); }
+function d3792(n) { var m = n + 5; return d3791(m); }
+function d3793(n) { var m = n + 6; return d3792(m); }
+function d3794(n) { var m = n + 0; return d3793(m); }
+function d3795(n) { var m = n + 1; return d3794(m); }
+function d3796(n) { var m = n + 2; return d3795(m); }
+function d3797(n) { var m = n + 3; return d3796(m); }
+function d3798(n) { var m = n + 4; return d3797(m); }
+function d3799(n) { var m = n + 5; return d3798(m); }
+function d3800(n) { var m = n + 6; return d3799(m); }
+function d3801(n) { var m = n + 0; return d3800(m); }
+function d3802(n) { var m = n + 1; return d3801(m); }
+function d3803(n) { var m = n + 2; return d3802(m); }
+function d3804(n) { var m = n + 3; return d3803(m); }
+function d3805(n) { var m = n + 4; return d3804(m); }
+function d3806(n) { var m = n + 5; return d3805(m); }
+function d3807(n) { var m = n + 6; return d3806(m); }
+function d3808(n) { var m = n + 0; return d3807(m); }
+function d3809(n) { var m = n + 1; return d3808(m); }
+function d3810(n) { var m = n + 2; return d3809(m); }
+function d3811(n) { var m = n + 3; return d3810(m); }
+function d3812(n) { var m = n + 4; return d3811(m); }
+function d3813(n) { var m = n + 5; return d3812(m); }
+function d3814(n) { var m = n + 6; return d3813(m); }
+function d3815(n) { var m = n + 0; return d3814(m); }
+function d3816(n) { var m = n + 1; return d3815(m); }
+function d3817(n) { var m = n + 2; return d3816(m); }
+function d3818(n) { var m = n + 3; return d3817(m); }
+function d3819(n) { var m = n + 4; return d3818(m); }
+function d3820(n) { var m = n + 5; return d3819(m); }
+function d3821(n) { var m = n + 6; return d3820(m); }
+function d3822(n) { var m = n + 0; return d3821(m); }
+function d3823(n) { var m = n + 1; return d3822(m); }
+function d3824(n) { var m = n + 2; return d3823(m); }
+function d3825(n) { var m = n + 3; return d3824(m); }
+function d3826(n) { var m = n + 4; return d3825(m); }
+function d3827(n) { var m = n + 5; return d3826(m); }
+function d3828(n) { var m = n + 6; return d3827(m); }
+function d3829(n) { var m = n + 0; return d3828(m); }
+function d3830(n) { var m = n + 1; return d3829(m); }
+function d3831(n) { var m = n + 2; return d3830(m); }
+function d3832(n) { var m = n + 3; return d3831(m); }
+function d3833(n) { var m = n + 4; return d3832(m); }
+function d3834(n) { var m = n + 5; return d3833(m); }
+function d3835(n) { var m = n + 6; return d3834(m); }
+function d3836(n) { var m = n + 0; return d3835(m); }
+function d3837(n) { var m = n + 1; return d3836(m); }
+function d3838(n) { var m = n + 2; return d3837(m); }
+function d3839(n) { var m = n + 3; return d3838(m); }
+function d3840(n) { var m = n + 4; return d3839(m); }
+function d3841(n) { var m = n + 5; return d3840(m); }
+function d3842(n) { var m = n + 6; return d3841(m); }
+function d3843(n) { var m = n + 0; return d3842(m); }
+function d3844(n) { var m = n + 1; return d3843(m); }
+function d3845(n) { var m = n + 2; return d3844(m); }
+function d3846(n) { var m = n + 3; return d3845(m); }
+function d3847(n) { var m = n + 4; return d3846(m); }
+function d3848(n) { var m = n + 5; return d3847(m); }
+function d3849(n) { var m = n + 6; return d3848(m); }
+function d3850(n) { var m = n + 0; return d3849(m); }
+function d3851(n) { var m = n + 1; return d3850(m); }
+function d3852(n) { var m = n + 2; return d3851(m); }
+function d3853(n) { var m = n + 3; return d3852(m); }
+function d3854(n) { var m = n + 4; return d3853(m); }
+function d3855(n) { var m = n + 5; return d3854(m); }
+function d3856(n) { var m = n + 6; return d3855(m); }
+function d3857(n) { var m = n + 0; return d3856(m); }
+function d3858(n) { var m = n + 1; return d3857(m); }
+function d3859(n) { var m = n + 2; return d3858(m); }
+function d3860(n) { var m = n + 3; return d3859(m); }
+function d3861(n) { var m = n + 4; return d3860(m); }
+function d3862(n) { var m = n + 5; return d3861(m); }
+function d3863(n) { var m = n + 6; return d3862(m); }
+function d3864(n) { var m = n + 0; return d3863(m); }
+function d3865(n) { var m = n + 1; return d3864(m); }
+function d3866(n) { var m = n + 2; return d3865(m); }
+function d3867(n) { var m = n + 3; return d3866(m); }
+function d3868(n) { var m = n + 4; return d3867(m); }
+function d3869(n) { var m = n + 5; return d3868(m); }
+function d3870(n) { var m = n + 6; return d3869(m); }
+function d3871(n) { var m = n + 0; return d3870(m); }
+function d3872(n) { var m = n + 1; return d3871(m); }
+function d3873(n) { var m = n + 2; return d3872(m); }
+function d3874(n) { var m = n + 3; return d3873(m); }
+function d3875(n) { var m = n + 4; return d3874(m); }
+function d3876(n) { var m = n + 5; return d3875(m); }
+function d3877(n) { var m = n + 6; return d3876(m); }
+function d3878(n) { var m = n + 0; return d3877(m); }
+function d3879(n) { var m = n + 1; return d3878(m); }
+function d3880(n) { var m = n + 2; return d3879(m); }
+function d3881(n) { var m = n + 3; return d3880(m); }
+function d3882(n) { var m = n + 4; return d3881(m); }
+function d3883(n) { var m = n + 5; return d3882(m); }
+function d3884(n) { var m = n + 6; return d3883(m); }
+function d3885(n) { var m = n + 0; return d3884(m); }
+function d3886(n) { var m = n + 1; return d3885(m); }
+function d3887(n) { var m = n + 2; return d3886(m); }
+function d3888(n) { var m = n + 3; return d3887(m); }
+function d3889(n) { var m = n + 4; return d3888(m); }
+function d3890(n) { var m = n + 5; return d3889(m); }
+function d3891(n) { var m = n + 6; return d3890(m); }
+function d3892(n) { var m = n + 0; return d3891(m); }
+function d3893(n) { var m = n + 1; return d3892(m); }
+function d3894(n) { var m = n + 2; return d3893(m); }
+function d3895(n) { var m = n + 3; return d3894(m); }
+function d3896(n) { var m = n + 4; return d3895(m); }
+function d3897(n) { var m = n + 5; return d3896(m); }
+function d3898(n) { var m = n + 6; return d3897(m); }
+function d3899(n) { var m = n + 0; return d3898(m); }
+function d3900(n) { var m = n + 1; return d3899(m); }
+function d3901(n) { var m = n + 2; return d3900(m); }
+function d3902(n) { var m = n + 3; return d3901(m); }
+function d3903(n) { var m = n + 4; return d3902(m); }
+function d3904(n) { var m = n + 5; return d3903(m); }
+function d3905(n) { var m = n + 6; return d3904(m); }
+function d3906(n) { var m = n + 0; return d3905(m); }
+function d3907(n) { var m = n + 1; return d3906(m); }
+function d3908(n) { var m = n + 2; return d3907(m); }
+function d3909(n) { var m = n + 3; return d3908(m); }
+function d3910(n) { var m = n + 4; return d3909(m); }
+function d3911(n) { var m = n + 5; return d3910(m); }
+function d3912(n) { var m = n + 6; return d3911(m); }
+function d3913(n) { var m = n + 0; return d3912(m); }
+function d3914(n) { var m = n + 1; return d3913(m); }
+function d3915(n) { var m = n + 2; return d3914(m); }
+function d3916(n) { var m = n + 3; return d3915(m); }
+function d3917(n) { var m = n + 4; return d3916(m); }
+function d3918(n) { var m = n + 5; return d3917(m); }
+function d3919(n) { var m = n + 6; return d3918(m); }
+function d3920(n) { var m = n + 0; return d3919(m); }
+function d3921(n) { var m = n + 1; return d3920(m); }
+function d3922(n) { var m = n + 2; return d3921(m); }
+function d3923(n) { var m = n + 3; return d3922(m); }
+function d3924(n) { var m = n + 4; return d3923(m); }
+function d3925(n) { var m = n + 5; return d3924(m); }
+function d3926(n) { var m = n + 6; return d3925(m); }
+function d3927(n) { var m = n + 0; return d3926(m); }
+function d3928(n) { var m = n + 1; return d3927(m); }
+function d3929(n) { var m = n + 2; return d3928(m); }
+function d3930(n) { var m = n + 3; return d3929(m); }
+function d3931(n) { var m = n + 4; return d3930(m); }
+function d3932(n) { var m = n + 5; return d3931(m); }
+function d3933(n) { var m = n + 6; return d3932(m); }
+function d3934(n) { var m = n + 0; return d3933(m); }
+function d3935(n) { var m = n + 1; return d3934(m); }
+function d3936(n) { var m = n + 2; return d3935(m); }
+function d3937(n) { var m = n + 3; return d3936(m); }
+function d3938(n) { var m = n + 4; return d3937(m); }
+function d3939(n) { var m = n + 5; return d3938(m); }
+function d3940(n) { var m = n + 6; return d3939(m); }
+function d3941(n) { var m = n + 0; return d3940(m); }
+function d3942(n) { var m = n + 1; return d3941(m); }
+function d3943(n) { var m = n + 2; return d3942(m); }
+function d3944(n) { var m = n + 3; return d3943(m); }
+function d3945(n) { var m = n + 4; return d3944(m); }
+function d3946(n) { var m = n + 5; return d3945(m); }
+function d3947(n) { var m = n + 6; return d3946(m); }
+function d3948(n) { var m = n + 0; return d3947(m); }
+function d3949(n) { var m = n + 1; return d3948(m); }
+function d3950(n) { var m = n + 2; return d3949(m); }
+function d3951(n) { var m = n + 3; return d3950(m); }
+function d3952(n) { var m = n + 4; return d3951(m); }
+function d3953(n) { var m = n + 5; return d3952(m); }
+function d3954(n) { var m = n + 6; return d3953(m); }
+function d3955(n) { var m = n + 0; return d3954(m); }
+function d3956(n) { var m = n + 1; return d3955(m); }
+function d3957(n) { var m = n + 2; return d3956(m); }
+function d3958(n) { var m = n + 3; return d3957(m); }
+function d3959(n) { var m = n + 4; return d3958(m); }
+function d3960(n) { var m = n + 5; return d3959(m); }
+function d3961(n) { var m = n + 6; return d3960(m); }
+function d3962(n) { var m = n + 0; return d3961(m); }
+function d3963(n) { var m = n + 1; return d3962(m); }
+function d3964(n) { var m = n + 2; return d3963(m); }
+function d3965(n) { var m = n + 3; return d3964(m); }
+function d3966(n) { var m = n + 4; return d3965(m); }
+function d3967(n) { var m = n + 5; return d3966(m); }
+function d3968(n) { var m = n + 6; return d3967(m); }
+function d3969(n) { var m = n + 0; return d3968(m); }
+function d3970(n) { var m = n + 1; return d3969(m); }
+function d3971(n) { var m = n + 2; return d3970(m); }
+function d3972(n) { var m = n + 3; return d3971(m); }
+function d3973(n) { var m = n + 4; return d3972(m); }
+function d3974(n) { var m = n + 5; return d3973(m); }
+function d3975(n) { var m = n + 6; return d3974(m); }
+function d3976(n) { var m = n + 0; return d3975(m); }
+function d3977(n) { var m = n + 1; return d3976(m); }
+function d3978(n) { var m = n + 2; return d3977(m); }
+function d3979(n) { var m = n + 3; return d3978(m); }
+function d3980(n) { var m = n + 4; return d3979(m); }
+function d3981(n) { var m = n + 5; return d3980(m); }
+function d3982(n) { var m = n + 6; return d3981(m); }
+function d3983(n) { var m = n + 0; return d3982(m); }
+function d3984(n) { var m = n + 1; return d3983(m); }
+function d3985(n) { var m = n + 2; return d3984(m); }
+function d3986(n) { var m = n + 3; return d3985(m); }
+function d3987(n) { var m = n + 4; return d3986(m); }
+function d3988(n) { var m = n + 5; return d3987(m); }
+function d3989(n) { var m = n + 6; return d3988(m); }
+function d3990(n) { var m = n + 0; return d3989(m); }
+function d3991(n) { var m = n + 1; return d3990(m); }
+function d3992(n) { var m = n + 2; return d3991(m); }
+function d3993(n) { var m = n + 3; return d3992(m); }
+function d3994(n) { var m = n + 4; return d3993(m); }
+function d3995(n) { var m = n + 5; return d3994(m); }
+function d3996(n) { var m = n + 6; return d3995(m); }
+function d3997(n) { var m = n + 0; return d3996(m); }
+function d3998(n) { var m = n + 1; return d3997(m); }
+function d3999(n) { var m = n + 2; return d3998(m); }
+d3999(0);
+d3999(1);
+d3999(2);
+d3999(3);
+d3999(4);
+d3999(5);
+d3999(6);
+d3999(7);
+d3999(8);
+d3999(9);
+d3999(10);
+d3999(11);
+d3999(12);
+d3999(13);
+d3999(14);
+d3999(15);
@@ -0,0 +1,16128 @@
+function m0(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return v399 - v200;
+}
+function m1(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m0(v399, v200);
+}
+function m2(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m1(v399, v200);
+}
+function m3(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m2(v399, v200);
+}
+function m4(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m3(v399, v200);
+}
+function m5(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m4(v399, v200);
+}
+function m6(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m5(v399, v200);
+}
+function m7(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m6(v399, v200);
+}
+function m8(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m7(v399, v200);
+}
+function m9(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m8(v399, v200);
+}
+function m10(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m9(v399, v200);
+}
+function m11(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m10(v399, v200);
+}
+function m12(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m11(v399, v200);
+}
+function m13(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m12(v399, v200);
+}
+function m14(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m13(v399, v200);
+}
+function m15(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m14(v399, v200);
+}
+function m16(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m15(v399, v200);
+}
+function m17(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m16(v399, v200);
+}
+function m18(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m17(v399, v200);
+}
+function m19(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m18(v399, v200);
+}
+function m20(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m19(v399, v200);
+}
+function m21(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m20(v399, v200);
+}
+function m22(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m21(v399, v200);
+}
+function m23(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m22(v399, v200);
+}
+function m24(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m23(v399, v200);
+}
+function m25(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m24(v399, v200);
+}
+function m26(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m25(v399, v200);
+}
+function m27(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m26(v399, v200);
+}
+function m28(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m27(v399, v200);
+}
+function m29(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m28(v399, v200);
+}
+function m30(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m29(v399, v200);
+}
+function m31(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m30(v399, v200);
+}
+function m32(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m31(v399, v200);
+}
+function m33(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m32(v399, v200);
+}
+function m34(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m33(v399, v200);
+}
+function m35(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m34(v399, v200);
+}
+function m36(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m35(v399, v200);
+}
+function m37(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m36(v399, v200);
+}
+function m38(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m37(v399, v200);
+}
+function m39(a, b) {
+	var v0 = a + b;
+	var v1 = v0 + 2;
+	var v2 = v1 - 3;
+	var v3 = v2 * 4;
+	var v4 = v3 + 5;
+	var v5 = v4 - 6;
+	var v6 = v5 * 7;
+	var v7 = v6 + 8;
+	var v8 = v7 - 9;
+	var v9 = v8 * 10;
+	var v10 = v9 + 11;
+	var v11 = v10 - 1;
+	var v12 = v11 * 2;
+	var v13 = v12 + 3;
+	var v14 = v13 - 4;
+	var v15 = v14 * 5;
+	var v16 = v15 + 6;
+	var v17 = v16 - 7;
+	var v18 = v17 * 8;
+	var v19 = v18 + 9;
+	var v20 = v19 - 10;
+	var v21 = v20 * 11;
+	var v22 = v21 + 1;
+	var v23 = v22 - 2;
+	var v24 = v23 * 3;
+	var v25 = v24 + 4;
+	var v26 = v25 - 5;
+	var v27 = v26 * 6;
+	var v28 = v27 + 7;
+	var v29 = v28 - 8;
+	var v30 = v29 * 9;
+	var v31 = v30 + 10;
+	var v32 = v31 - 11;
+	var v33 = v32 * 1;
+	var v34 = v33 + 2;
+	var v35 = v34 - 3;
+	var v36 = v35 * 4;
+	var v37 = v36 + 5;
+	var v38 = v37 - 6;
+	var v39 = v38 * 7;
+	var v40 = v39 + 8;
+	var v41 = v40 - 9;
+	var v42 = v41 * 10;
+	var v43 = v42 + 11;
+	var v44 = v43 - 1;
+	var v45 = v44 * 2;
+	var v46 = v45 + 3;
+	var v47 = v46 - 4;
+	var v48 = v47 * 5;
+	var v49 = v48 + 6;
+	var v50 = v49 - 7;
+	var v51 = v50 * 8;
+	var v52 = v51 + 9;
+	var v53 = v52 - 10;
+	var v54 = v53 * 11;
+	var v55 = v54 + 1;
+	var v56 = v55 - 2;
+	var v57 = v56 * 3;
+	var v58 = v57 + 4;
+	var v59 = v58 - 5;
+	var v60 = v59 * 6;
+	var v61 = v60 + 7;
+	var v62 = v61 - 8;
+	var v63 = v62 * 9;
+	var v64 = v63 + 10;
+	var v65 = v64 - 11;
+	var v66 = v65 * 1;
+	var v67 = v66 + 2;
+	var v68 = v67 - 3;
+	var v69 = v68 * 4;
+	var v70 = v69 + 5;
+	var v71 = v70 - 6;
+	var v72 = v71 * 7;
+	var v73 = v72 + 8;
+	var v74 = v73 - 9;
+	var v75 = v74 * 10;
+	var v76 = v75 + 11;
+	var v77 = v76 - 1;
+	var v78 = v77 * 2;
+	var v79 = v78 + 3;
+	var v80 = v79 - 4;
+	var v81 = v80 * 5;
+	var v82 = v81 + 6;
+	var v83 = v82 - 7;
+	var v84 = v83 * 8;
+	var v85 = v84 + 9;
+	var v86 = v85 - 10;
+	var v87 = v86 * 11;
+	var v88 = v87 + 1;
+	var v89 = v88 - 2;
+	var v90 = v89 * 3;
+	var v91 = v90 + 4;
+	var v92 = v91 - 5;
+	var v93 = v92 * 6;
+	var v94 = v93 + 7;
+	var v95 = v94 - 8;
+	var v96 = v95 * 9;
+	var v97 = v96 + 10;
+	var v98 = v97 - 11;
+	var v99 = v98 * 1;
+	var v100 = v99 + 2;
+	var v101 = v100 - 3;
+	var v102 = v101 * 4;
+	var v103 = v102 + 5;
+	var v104 = v103 - 6;
+	var v105 = v104 * 7;
+	var v106 = v105 + 8;
+	var v107 = v106 - 9;
+	var v108 = v107 * 10;
+	var v109 = v108 + 11;
+	var v110 = v109 - 1;
+	var v111 = v110 * 2;
+	var v112 = v111 + 3;
+	var v113 = v112 - 4;
+	var v114 = v113 * 5;
+	var v115 = v114 + 6;
+	var v116 = v115 - 7;
+	var v117 = v116 * 8;
+	var v118 = v117 + 9;
+	var v119 = v118 - 10;
+	var v120 = v119 * 11;
+	var v121 = v120 + 1;
+	var v122 = v121 - 2;
+	var v123 = v122 * 3;
+	var v124 = v123 + 4;
+	var v125 = v124 - 5;
+	var v126 = v125 * 6;
+	var v127 = v126 + 7;
+	var v128 = v127 - 8;
+	var v129 = v128 * 9;
+	var v130 = v129 + 10;
+	var v131 = v130 - 11;
+	var v132 = v131 * 1;
+	var v133 = v132 + 2;
+	var v134 = v133 - 3;
+	var v135 = v134 * 4;
+	var v136 = v135 + 5;
+	var v137 = v136 - 6;
+	var v138 = v137 * 7;
+	var v139 = v138 + 8;
+	var v140 = v139 - 9;
+	var v141 = v140 * 10;
+	var v142 = v141 + 11;
+	var v143 = v142 - 1;
+	var v144 = v143 * 2;
+	var v145 = v144 + 3;
+	var v146 = v145 - 4;
+	var v147 = v146 * 5;
+	var v148 = v147 + 6;
+	var v149 = v148 - 7;
+	var v150 = v149 * 8;
+	var v151 = v150 + 9;
+	var v152 = v151 - 10;
+	var v153 = v152 * 11;
+	var v154 = v153 + 1;
+	var v155 = v154 - 2;
+	var v156 = v155 * 3;
+	var v157 = v156 + 4;
+	var v158 = v157 - 5;
+	var v159 = v158 * 6;
+	var v160 = v159 + 7;
+	var v161 = v160 - 8;
+	var v162 = v161 * 9;
+	var v163 = v162 + 10;
+	var v164 = v163 - 11;
+	var v165 = v164 * 1;
+	var v166 = v165 + 2;
+	var v167 = v166 - 3;
+	var v168 = v167 * 4;
+	var v169 = v168 + 5;
+	var v170 = v169 - 6;
+	var v171 = v170 * 7;
+	var v172 = v171 + 8;
+	var v173 = v172 - 9;
+	var v174 = v173 * 10;
+	var v175 = v174 + 11;
+	var v176 = v175 - 1;
+	var v177 = v176 * 2;
+	var v178 = v177 + 3;
+	var v179 = v178 - 4;
+	var v180 = v179 * 5;
+	var v181 = v180 + 6;
+	var v182 = v181 - 7;
+	var v183 = v182 * 8;
+	var v184 = v183 + 9;
+	var v185 = v184 - 10;
+	var v186 = v185 * 11;
+	var v187 = v186 + 1;
+	var v188 = v187 - 2;
+	var v189 = v188 * 3;
+	var v190 = v189 + 4;
+	var v191 = v190 - 5;
+	var v192 = v191 * 6;
+	var v193 = v192 + 7;
+	var v194 = v193 - 8;
+	var v195 = v194 * 9;
+	var v196 = v195 + 10;
+	var v197 = v196 - 11;
+	var v198 = v197 * 1;
+	var v199 = v198 + 2;
+	var v200 = v199 - 3;
+	var v201 = v200 * 4;
+	var v202 = v201 + 5;
+	var v203 = v202 - 6;
+	var v204 = v203 * 7;
+	var v205 = v204 + 8;
+	var v206 = v205 - 9;
+	var v207 = v206 * 10;
+	var v208 = v207 + 11;
+	var v209 = v208 - 1;
+	var v210 = v209 * 2;
+	var v211 = v210 + 3;
+	var v212 = v211 - 4;
+	var v213 = v212 * 5;
+	var v214 = v213 + 6;
+	var v215 = v214 - 7;
+	var v216 = v215 * 8;
+	var v217 = v216 + 9;
+	var v218 = v217 - 10;
+	var v219 = v218 * 11;
+	var v220 = v219 + 1;
+	var v221 = v220 - 2;
+	var v222 = v221 * 3;
+	var v223 = v222 + 4;
+	var v224 = v223 - 5;
+	var v225 = v224 * 6;
+	var v226 = v225 + 7;
+	var v227 = v226 - 8;
+	var v228 = v227 * 9;
+	var v229 = v228 + 10;
+	var v230 = v229 - 11;
+	var v231 = v230 * 1;
+	var v232 = v231 + 2;
+	var v233 = v232 - 3;
+	var v234 = v233 * 4;
+	var v235 = v234 + 5;
+	var v236 = v235 - 6;
+	var v237 = v236 * 7;
+	var v238 = v237 + 8;
+	var v239 = v238 - 9;
+	var v240 = v239 * 10;
+	var v241 = v240 + 11;
+	var v242 = v241 - 1;
+	var v243 = v242 * 2;
+	var v244 = v243 + 3;
+	var v245 = v244 - 4;
+	var v246 = v245 * 5;
+	var v247 = v246 + 6;
+	var v248 = v247 - 7;
+	var v249 = v248 * 8;
+	var v250 = v249 + 9;
+	var v251 = v250 - 10;
+	var v252 = v251 * 11;
+	var v253 = v252 + 1;
+	var v254 = v253 - 2;
+	var v255 = v254 * 3;
+	var v256 = v255 + 4;
+	var v257 = v256 - 5;
+	var v258 = v257 * 6;
+	var v259 = v258 + 7;
+	var v260 = v259 - 8;
+	var v261 = v260 * 9;
+	var v262 = v261 + 10;
+	var v263 = v262 - 11;
+	var v264 = v263 * 1;
+	var v265 = v264 + 2;
+	var v266 = v265 - 3;
+	var v267 = v266 * 4;
+	var v268 = v267 + 5;
+	var v269 = v268 - 6;
+	var v270 = v269 * 7;
+	var v271 = v270 + 8;
+	var v272 = v271 - 9;
+	var v273 = v272 * 10;
+	var v274 = v273 + 11;
+	var v275 = v274 - 1;
+	var v276 = v275 * 2;
+	var v277 = v276 + 3;
+	var v278 = v277 - 4;
+	var v279 = v278 * 5;
+	var v280 = v279 + 6;
+	var v281 = v280 - 7;
+	var v282 = v281 * 8;
+	var v283 = v282 + 9;
+	var v284 = v283 - 10;
+	var v285 = v284 * 11;
+	var v286 = v285 + 1;
+	var v287 = v286 - 2;
+	var v288 = v287 * 3;
+	var v289 = v288 + 4;
+	var v290 = v289 - 5;
+	var v291 = v290 * 6;
+	var v292 = v291 + 7;
+	var v293 = v292 - 8;
+	var v294 = v293 * 9;
+	var v295 = v294 + 10;
+	var v296 = v295 - 11;
+	var v297 = v296 * 1;
+	var v298 = v297 + 2;
+	var v299 = v298 - 3;
+	var v300 = v299 * 4;
+	var v301 = v300 + 5;
+	var v302 = v301 - 6;
+	var v303 = v302 * 7;
+	var v304 = v303 + 8;
+	var v305 = v304 - 9;
+	var v306 = v305 * 10;
+	var v307 = v306 + 11;
+	var v308 = v307 - 1;
+	var v309 = v308 * 2;
+	var v310 = v309 + 3;
+	var v311 = v310 - 4;
+	var v312 = v311 * 5;
+	var v313 = v312 + 6;
+	var v314 = v313 - 7;
+	var v315 = v314 * 8;
+	var v316 = v315 + 9;
+	var v317 = v316 - 10;
+	var v318 = v317 * 11;
+	var v319 = v318 + 1;
+	var v320 = v319 - 2;
+	var v321 = v320 * 3;
+	var v322 = v321 + 4;
+	var v323 = v322 - 5;
+	var v324 = v323 * 6;
+	var v325 = v324 + 7;
+	var v326 = v325 - 8;
+	var v327 = v326 * 9;
+	var v328 = v327 + 10;
+	var v329 = v328 - 11;
+	var v330 = v329 * 1;
+	var v331 = v330 + 2;
+	var v332 = v331 - 3;
+	var v333 = v332 * 4;
+	var v334 = v333 + 5;
+	var v335 = v334 - 6;
+	var v336 = v335 * 7;
+	var v337 = v336 + 8;
+	var v338 = v337 - 9;
+	var v339 = v338 * 10;
+	var v340 = v339 + 11;
+	var v341 = v340 - 1;
+	var v342 = v341 * 2;
+	var v343 = v342 + 3;
+	var v344 = v343 - 4;
+	var v345 = v344 * 5;
+	var v346 = v345 + 6;
+	var v347 = v346 - 7;
+	var v348 = v347 * 8;
+	var v349 = v348 + 9;
+	var v350 = v349 - 10;
+	var v351 = v350 * 11;
+	var v352 = v351 + 1;
+	var v353 = v352 - 2;
+	var v354 = v353 * 3;
+	var v355 = v354 + 4;
+	var v356 = v355 - 5;
+	var v357 = v356 * 6;
+	var v358 = v357 + 7;
+	var v359 = v358 - 8;
+	var v360 = v359 * 9;
+	var v361 = v360 + 10;
+	var v362 = v361 - 11;
+	var v363 = v362 * 1;
+	var v364 = v363 + 2;
+	var v365 = v364 - 3;
+	var v366 = v365 * 4;
+	var v367 = v366 + 5;
+	var v368 = v367 - 6;
+	var v369 = v368 * 7;
+	var v370 = v369 + 8;
+	var v371 = v370 - 9;
+	var v372 = v371 * 10;
+	var v373 = v372 + 11;
+	var v374 = v373 - 1;
+	var v375 = v374 * 2;
+	var v376 = v375 + 3;
+	var v377 = v376 - 4;
+	var v378 = v377 * 5;
+	var v379 = v378 + 6;
+	var v380 = v379 - 7;
+	var v381 = v380 * 8;
+	var v382 = v381 + 9;
+	var v383 = v382 - 10;
+	var v384 = v383 * 11;
+	var v385 = v384 + 1;
+	var v386 = v385 - 2;
+	var v387 = v386 * 3;
+	var v388 = v387 + 4;
+	var v389 = v388 - 5;
+	var v390 = v389 * 6;
+	var v391 = v390 + 7;
+	var v392 = v391 - 8;
+	var v393 = v392 * 9;
+	var v394 = v393 + 10;
+	var v395 = v394 - 11;
+	var v396 = v395 * 1;
+	var v397 = v396 + 2;
+	var v398 = v397 - 3;
+	var v399 = v398 * 4;
+	return m38(v399, v200);
+}
+m39(0, 0);
+m39(1, 3);
+m39(2, 6);
+m39(3, 9);
+m39(4, 12);
+m39(5, 15);
+m39(6, 18);
+m39(7, 21);
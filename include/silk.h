@@ -1,8 +1,19 @@
 #ifndef _SILK_H_
 #define _SILK_H_
 
+#include <stddef.h>
+
 #define SILK_API __attribute__((visibility("default")))
 
+// A VM keeps its stacks between runs, so once warmed up a run allocates
+// nothing. It runs one program at a time.
+typedef struct Silk_VM Silk_VM;
+// Idle VMs that any thread can check out and give back
+typedef struct Silk_VMPool Silk_VMPool;
+
+#define SILK_DEFAULT_CALL_DEPTH (1 << 18)
+#define SILK_DEFAULT_STACK_SIZE (1 << 21)
+
 typedef struct {
 	const char* filename;
 	char print_tokens;
@@ -10,8 +21,46 @@ typedef struct {
 	char print_bytecode;
 	char print_stack_on_exit;
 	char print_errors;
+	char compact_bytecode;
+	char jit;
+	char profile;
+	// Emit instructions straight from the parser instead of going
+	// through a tree. Same code, less time and memory, but print_ast has
+	// nothing to print.
+	char single_pass;
+	// Skip function bodies while parsing and compile each one the first
+	// time it's called, so code that never runs costs little more than a
+	// scan. Errors in a body only show up once it's called. Lazy runs
+	// always use the instruction interpreter, ignoring compact_bytecode,
+	// jit, profile and single_pass.
+	char lazy;
+	// Threads compiling function bodies, 0 for one per core. The code is
+	// the same however many there are.
+	int compile_threads;
+	// Have silk_run_file keep the compiled code in <file>.silkc and run
+	// from there while the source stays the same, skipping the front
+	// end, so print_tokens and print_ast show nothing then. Lazy runs
+	// use a cache but don't write one.
+	char bytecode_cache;
+	// How deep calls may go, and how many values the operand stack and
+	// the locals of called functions may each hold, before a run fails
+	// with a stack overflow. 0 picks SILK_DEFAULT_CALL_DEPTH and
+	// SILK_DEFAULT_STACK_SIZE. Stacks are reserved address space, so
+	// memory is only used as deep as a run actually goes.
+	size_t call_depth;
+	size_t stack_size;
+	// Runs check a VM out of vm_pool when it's set. Otherwise they all
+	// go on vm, which silk_ctx_init makes and silk_ctx_deinit frees.
+	Silk_VMPool* vm_pool;
+	Silk_VM* vm;
 } Silk_Ctx;
 
+// Nothing a run or a compile does writes to the Silk_Ctx or the
+// Silk_Program it's given, so both can be shared between threads. Runs
+// that overlap need a VM each though: set vm_pool, or pass every thread
+// its own VM with silk_program_run_on. Streams take a copy of the
+// Silk_Ctx when they're opened.
+
 SILK_API int silk_ctx_init(Silk_Ctx* ctx);
 SILK_API void silk_ctx_deinit(Silk_Ctx* ctx);
 
@@ -19,4 +68,63 @@ SILK_API int silk_run_file(Silk_Ctx* ctx, const char* filename);
 SILK_API int silk_run_string(Silk_Ctx* ctx, const char* js_data);
 SILK_API int silk_run(Silk_Ctx* ctx, const char* js_data, const char* js_data_end);
 
+// A compiled script, run as many times as needed without going through
+// the front end again. Programs don't change once compiled, and the
+// tree is gone by the time silk_compile returns. Everything gets
+// compiled up front, so lazy is ignored. With compact_bytecode set the
+// packed code is made once, at compile time; the JIT still translates
+// the code on each run.
+typedef struct Silk_Program Silk_Program;
+
+// Return NULL on errors, which are reported as silk_run reports them.
+// silk_compile_file goes through the bytecode cache when it's enabled.
+SILK_API Silk_Program* silk_compile(Silk_Ctx* ctx, const char* js_data, const char* js_data_end);
+SILK_API Silk_Program* silk_compile_file(Silk_Ctx* ctx, const char* filename);
+// Runs the program with ctx's run and print options, on ctx's VM.
+// Errors name ctx's filename, or the one the program was compiled under
+// when that's NULL.
+SILK_API int silk_program_run(Silk_Ctx* ctx, const Silk_Program* program);
+// Same, on a VM the caller picked
+SILK_API int silk_program_run_on(Silk_Ctx* ctx, const Silk_Program* program, Silk_VM* vm);
+SILK_API void silk_program_free(Silk_Program* program);
+
+SILK_API Silk_VM* silk_vm_create(void);
+SILK_API void silk_vm_free(Silk_VM* vm);
+
+// Acquiring hands out an idle VM, or a new one when none is idle.
+// Acquire and release may be called from any thread. Every VM has to
+// be released before the pool is freed.
+SILK_API Silk_VMPool* silk_vm_pool_create(void);
+SILK_API Silk_VM* silk_vm_pool_acquire(Silk_VMPool* pool);
+SILK_API void silk_vm_pool_release(Silk_VMPool* pool, Silk_VM* vm);
+SILK_API void silk_vm_pool_free(Silk_VMPool* pool);
+
+// A fixed set of threads, each with a VM of its own, for running a
+// program many times over
+typedef struct Silk_Workers Silk_Workers;
+
+// n_threads of 0 starts one per core
+SILK_API Silk_Workers* silk_workers_create(int n_threads);
+// Runs the program n_runs times across the workers and waits for all of
+// them. results, unless NULL, gets what each run returned. Returns 1 if
+// any run failed. Batches given to the same workers run one at a time.
+SILK_API int silk_workers_run(Silk_Workers* workers, Silk_Ctx* ctx, const Silk_Program* program,
+	size_t n_runs, int* results);
+SILK_API void silk_workers_free(Silk_Workers* workers);
+
+// Runs a script as it arrives, in chunks that may end anywhere, even in
+// the middle of a token. Each top-level statement runs once it's
+// complete and every function it can reach has been defined, so
+// statements before an error have already run. Streams always use the
+// instruction interpreter, ignoring compact_bytecode, jit, profile,
+// single_pass and lazy.
+typedef struct Silk_Stream Silk_Stream;
+
+SILK_API Silk_Stream* silk_stream_open(Silk_Ctx* ctx);
+SILK_API int silk_stream_feed(Silk_Stream* stream, const char* data, size_t size);
+// Ends the input, runs what's left and frees the stream
+SILK_API int silk_stream_close(Silk_Stream* stream);
+// Streams everything read from fd until end of file
+SILK_API int silk_run_fd(Silk_Ctx* ctx, int fd);
+
 #endif
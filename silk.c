@@ -4,7 +4,7 @@
 
 int main(int argc, char** argv) {
 	if(argc < 2) {
-		printf("Usage: %s [-t|-a|-b|-s|-e] <file.js>\n", argv[0]);
+		printf("Usage: %s [-t|-a|-b|-s|-e|-c|-j|-p|-d|-l|-k] <file.js|->\n", argv[0]);
 		return 1;
 	}
 
@@ -15,6 +15,13 @@ int main(int argc, char** argv) {
 	ctx.print_bytecode = 0;
 	ctx.print_stack_on_exit = 0;
 	ctx.print_errors = 0;
+	ctx.compact_bytecode = 0;
+	ctx.jit = 0;
+	ctx.profile = 0;
+	ctx.single_pass = 0;
+	ctx.lazy = 0;
+	ctx.compile_threads = 0;
+	ctx.bytecode_cache = 0;
 
 	int i;
 	for(i = 1; i < argc - 1; ++i) {
@@ -28,6 +35,18 @@ int main(int argc, char** argv) {
 			ctx.print_stack_on_exit = 1;
 		else if(!strcmp(argv[i], "-e"))
 			ctx.print_errors = 1;
+		else if(!strcmp(argv[i], "-c"))
+			ctx.compact_bytecode = 1;
+		else if(!strcmp(argv[i], "-j"))
+			ctx.jit = 1;
+		else if(!strcmp(argv[i], "-p"))
+			ctx.profile = 1;
+		else if(!strcmp(argv[i], "-d"))
+			ctx.single_pass = 1;
+		else if(!strcmp(argv[i], "-l"))
+			ctx.lazy = 1;
+		else if(!strcmp(argv[i], "-k"))
+			ctx.bytecode_cache = 1;
 		else {
 			printf("Unknown argument \"%s\"\n", argv[i]);
 			return 1;
@@ -35,8 +54,16 @@ int main(int argc, char** argv) {
 	}
 
 	const char* filename = argv[i];
-	int ret = silk_run_file(&ctx, filename);
-	printf("silk_run_file() returned %d\n", ret);
+	int ret;
+	if(!strcmp(filename, "-")) {
+		ctx.filename = "(stdin)";
+		ret = silk_run_fd(&ctx, 0);
+		printf("silk_run_fd() returned %d\n", ret);
+	}
+	else {
+		ret = silk_run_file(&ctx, filename);
+		printf("silk_run_file() returned %d\n", ret);
+	}
 
 	silk_ctx_deinit(&ctx);
 	return ret;
@@ -0,0 +1,71 @@
+#include "arena.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_ALIGN 16
+#define ARENA_MIN_BLOCK (16 * 1024)
+#define ARENA_MAX_BLOCK (1024 * 1024)
+
+struct ArenaBlock {
+	ArenaBlock* next;
+	size_t size;
+	size_t used;
+	// Keeps data[] aligned to ARENA_ALIGN
+	size_t pad;
+	unsigned char data[];
+};
+
+void arena_init(Arena* arena) {
+	arena->head = NULL;
+	arena->next_size = ARENA_MIN_BLOCK;
+}
+
+// Blocks double in size up to ARENA_MAX_BLOCK, and anything bigger than
+// that gets a block of its own
+static ArenaBlock* arena_grow(Arena* arena, size_t size) {
+	size_t block_size = arena->next_size;
+	if(block_size < size)
+		block_size = size;
+	ArenaBlock* block = malloc(sizeof(ArenaBlock) + block_size);
+	if(!block)
+		return NULL;
+	block->next = arena->head;
+	block->size = block_size;
+	block->used = 0;
+	arena->head = block;
+	if(arena->next_size < ARENA_MAX_BLOCK)
+		arena->next_size *= 2;
+	return block;
+}
+
+void* arena_alloc(Arena* arena, size_t size) {
+	size = (size + ARENA_ALIGN - 1) & ~(size_t) (ARENA_ALIGN - 1);
+	ArenaBlock* block = arena->head;
+	if(!block || block->size - block->used < size) {
+		block = arena_grow(arena, size);
+		if(!block)
+			return NULL;
+	}
+	void* ptr = block->data + block->used;
+	block->used += size;
+	return ptr;
+}
+
+void* arena_copy(Arena* arena, const void* data, size_t size) {
+	if(!size)
+		return NULL;
+	void* ptr = arena_alloc(arena, size);
+	if(ptr)
+		memcpy(ptr, data, size);
+	return ptr;
+}
+
+void arena_deinit(Arena* arena) {
+	ArenaBlock* block = arena->head;
+	while(block) {
+		ArenaBlock* next = block->next;
+		free(block);
+		block = next;
+	}
+	arena_init(arena);
+}
@@ -0,0 +1,20 @@
+#ifndef _ARENA_H_
+#define _ARENA_H_
+
+#include <stddef.h>
+
+typedef struct ArenaBlock ArenaBlock;
+
+// Bump allocator. Allocations are only ever released together, by
+// arena_deinit.
+typedef struct {
+	ArenaBlock* head;
+	size_t next_size;
+} Arena;
+
+void arena_init(Arena* arena);
+void* arena_alloc(Arena* arena, size_t size);
+void* arena_copy(Arena* arena, const void* data, size_t size);
+void arena_deinit(Arena* arena);
+
+#endif
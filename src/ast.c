@@ -1,140 +1,374 @@
+#define _DEFAULT_SOURCE
 #include "ast.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <pthread.h>
+#include <unistd.h>
 #include "instruction.h"
 
 typedef struct {
 	ASTNode* node;
 	size_t start_addr;
 	int64_t ra_index;
+	size_t n_locals;
 } FunctionCtx;
 VECTOR_DEFINE(FunctionCtx)
 
 typedef struct {
-	const char* identifier;
-	size_t code_pos;
-	int line;
-} BackPatch;
-VECTOR_DEFINE(BackPatch)
+	size_t id;
+	size_t n_vars;
+	size_t shadowed_base;
+} Scope;
 
 typedef struct {
-	char* identifier;
-	int64_t index;
-} Variable;
-VECTOR_DEFINE(Variable)
+	// All indexed by symbol id, NULL when only folding arithmetic
+	uint8_t* reassigned;
+	uint8_t* is_constant;
+	int64_t* constants;
+	// Number of the function that declared the symbol as a local, so the
+	// sets don't need clearing between functions
+	size_t* local_in;
+	// 0 at the top level
+	size_t fun;
+	Vector_ASTNode_ptr_t spine;
+} Folder;
 
-ASTNode* ast_create_node(ASTNode node) {
-	ASTNode* new = malloc(sizeof(ASTNode));
+ASTNode* ast_create_node(Arena* arena, ASTNode node) {
+	ASTNode* new = arena_alloc(arena, sizeof(ASTNode));
 	assert(new);
 	*new = node;
 	return new;
 }
 
-void ast_destroy(ASTNode* node) {
+static int is_bin_op(ASTNode* node) {
+	return node->type == NODE_EXPR && node->expr.type == NODE_EXPR_BIN_OP;
+}
+
+// Operator chains lean left and are as long as the source makes them, so
+// the passes walk them with a stack of their left spine instead of
+// recursing into each lhs. Returns the leftmost operand.
+static ASTNode* push_spine(Vector_ASTNode_ptr_t* spine, ASTNode* node) {
+	while(is_bin_op(node)) {
+		vector_aappend(spine, node);
+		node = node->expr.bin_op.lhs;
+	}
+	return node;
+}
+
+static void collect_reassigned(ASTNode* node, uint8_t* reassigned) {
 	if(!node)
 		return;
 
 	switch(node->type) {
 		case NODE_SCOPE:
 			for(size_t i = 0; i < node->scope.n_nodes; ++i)
-				ast_destroy(node->scope.nodes[i]);
-			free(node->scope.nodes);
+				collect_reassigned(node->scope.nodes[i], reassigned);
 			break;
 		case NODE_FUN_STATEMENT:
-			free(node->fun.identifier);
-			for(size_t i = 0; i < node->fun.arguments.size; ++i)
-				free(node->fun.arguments.data[i]);
-			vector_deinit(&node->fun.arguments);
-			ast_destroy(node->fun.body);
+			collect_reassigned(node->fun.body, reassigned);
 			break;
 		case NODE_RET_STATEMENT:
-			ast_destroy(node->ret.expr);
+			collect_reassigned(node->ret.expr, reassigned);
+			break;
+		case NODE_VAR_STATEMENT:
+			collect_reassigned(node->var.expr, reassigned);
 			break;
 		case NODE_EXPR:
 			switch(node->expr.type) {
-				case NODE_EXPR_INT_LIT:
+				case NODE_EXPR_BIN_OP:
+					// Order doesn't matter here, no stack needed
+					do {
+						collect_reassigned(node->expr.bin_op.rhs, reassigned);
+						node = node->expr.bin_op.lhs;
+					} while(is_bin_op(node));
+					collect_reassigned(node, reassigned);
 					break;
-				case NODE_EXPR_STR_LIT:
-					free(node->expr.str_lit.str);
+				case NODE_EXPR_VAR_REASSIGNMENT:
+					reassigned[node->expr.var_assignment.identifier.id] = 1;
+					collect_reassigned(node->expr.var_assignment.expr, reassigned);
 					break;
-				case NODE_EXPR_BIN_OP:
-					ast_destroy(node->expr.bin_op.lhs);
-					ast_destroy(node->expr.bin_op.rhs);
+				case NODE_EXPR_FUN_CALL:
+					for(size_t i = 0; i < node->expr.fun_call.args.size; ++i)
+						collect_reassigned(node->expr.fun_call.args.data[i], reassigned);
 					break;
-				case NODE_EXPR_VAR_LOOKUP:
-					free(node->expr.var_lookup.identifier);
+				default:
+					break;
+			}
+			break;
+		default:
+			assert(0);
+	}
+}
+
+static InstructionType bin_op_instruction(int type) {
+	switch(type) {
+		case NODE_EXPR_SUM:
+			return INST_SUM;
+		case NODE_EXPR_SUB:
+			return INST_SUB;
+		case NODE_EXPR_MUL:
+			return INST_MUL;
+		case NODE_EXPR_DIV:
+			return INST_DIV;
+		default:
+			assert(0);
+			return INST_EXIT;
+	}
+}
+
+static int fold_bin_op(ASTNode* node) {
+	int64_t num;
+	if(!instruction_fold(bin_op_instruction(node->expr.bin_op.type),
+		node->expr.bin_op.lhs->expr.int_lit.num, node->expr.bin_op.rhs->expr.int_lit.num, &num))
+		return 0;
+	node->expr.type = NODE_EXPR_INT_LIT;
+	node->expr.int_lit.num = num;
+	return 1;
+}
+
+// Folds integer arithmetic bottom-up and replaces lookups of constant
+// globals with their value
+static size_t fold_recur(ASTNode* node, Folder* folder) {
+	if(!node)
+		return 0;
+
+	size_t n_folded = 0;
+	switch(node->type) {
+		case NODE_SCOPE:
+			for(size_t i = 0; i < node->scope.n_nodes; ++i)
+				n_folded += fold_recur(node->scope.nodes[i], folder);
+			break;
+		case NODE_RET_STATEMENT:
+			n_folded += fold_recur(node->ret.expr, folder);
+			break;
+		case NODE_VAR_STATEMENT: {
+			n_folded += fold_recur(node->var.expr, folder);
+			SymbolId id = node->var.identifier.id;
+			if(!folder->is_constant)
+				break;
+			if(folder->fun) {
+				folder->local_in[id] = folder->fun;
+				break;
+			}
+			if(node->var.expr->type == NODE_EXPR && node->var.expr->expr.type == NODE_EXPR_INT_LIT &&
+				!folder->reassigned[id] && !folder->is_constant[id]) {
+				folder->is_constant[id] = 1;
+				folder->constants[id] = node->var.expr->expr.int_lit.num;
+			}
+			break;
+		}
+		case NODE_EXPR:
+			switch(node->expr.type) {
+				case NODE_EXPR_BIN_OP: {
+					size_t base = folder->spine.size;
+					n_folded += fold_recur(push_spine(&folder->spine, node), folder);
+					while(folder->spine.size > base) {
+						ASTNode* op = folder->spine.data[--folder->spine.size];
+						n_folded += fold_recur(op->expr.bin_op.rhs, folder);
+						if(op->expr.bin_op.lhs->expr.type == NODE_EXPR_INT_LIT &&
+							op->expr.bin_op.rhs->expr.type == NODE_EXPR_INT_LIT)
+							n_folded += fold_bin_op(op);
+					}
 					break;
+				}
+				case NODE_EXPR_VAR_LOOKUP: {
+					SymbolId id = node->expr.var_lookup.identifier.id;
+					if(!folder->is_constant || (folder->fun && folder->local_in[id] == folder->fun) || !folder->is_constant[id])
+						break;
+					node->expr.type = NODE_EXPR_INT_LIT;
+					node->expr.int_lit.num = folder->constants[id];
+					++n_folded;
+					break;
+				}
 				case NODE_EXPR_VAR_REASSIGNMENT:
-					free(node->expr.var_assignment.identifier);
-					ast_destroy(node->expr.var_assignment.expr);
+					n_folded += fold_recur(node->expr.var_assignment.expr, folder);
 					break;
 				case NODE_EXPR_FUN_CALL:
 					for(size_t i = 0; i < node->expr.fun_call.args.size; ++i)
-						ast_destroy(node->expr.fun_call.args.data[i]);
-					vector_deinit(&node->expr.fun_call.args);
-					free(node->expr.fun_call.identifier);
+						n_folded += fold_recur(node->expr.fun_call.args.data[i], folder);
 					break;
 				default:
-					assert(0);
+					break;
 			}
 			break;
-		case NODE_VAR_STATEMENT:
-			free(node->var.identifier);
-			ast_destroy(node->var.expr);
-			break;
 		default:
 			assert(0);
 	}
-	free(node);
+	return n_folded;
 }
 
-static inline FunctionCtx* lookup_fun_ctx(Vector_FunctionCtx* funcs, ASTNode* node) {
-	for(size_t i = 0; i < funcs->size; ++i)
-		if(funcs->data[i].node == node)
-			return &funcs->data[i];
-	assert(0);
-}
+size_t ast_fold_constants(ASTNode* root, size_t n_symbols) {
+	assert(root->type == NODE_SCOPE);
+	size_t n_folded = 0;
 
-static inline FunctionCtx* lookup_fun_ctx_by_name(Vector_FunctionCtx* funcs, const char* name) {
-	for(size_t i = 0; i < funcs->size; ++i)
-		if(!strcmp(funcs->data[i].node->fun.identifier, name))
-			return &funcs->data[i];
-	return NULL;
+	Folder folder = {
+		.reassigned = calloc(n_symbols + 1, sizeof(uint8_t)),
+		.is_constant = calloc(n_symbols + 1, sizeof(uint8_t)),
+		.constants = malloc(sizeof(int64_t) * (n_symbols + 1)),
+		.local_in = calloc(n_symbols + 1, sizeof(size_t)),
+		.fun = 0
+	};
+	// Folding is only an optimization, an unfolded tree compiles all the same
+	if(vector_ASTNode_ptr_t_init(&folder.spine, 64))
+		goto quit;
+	if(!folder.reassigned || !folder.is_constant || !folder.constants || !folder.local_in)
+		goto quit;
+
+	// Assignments in a body the parser skipped can't be seen, so no global
+	// is known to stay constant. Arithmetic folds all the same.
+	for(size_t i = 0; i < root->scope.n_nodes; ++i) {
+		ASTNode* fun = root->scope.nodes[i];
+		if(fun->type != NODE_FUN_STATEMENT || fun->fun.body)
+			continue;
+		Folder arithmetic = { .spine = folder.spine };
+		for(size_t j = 0; j < root->scope.n_nodes; ++j) {
+			ASTNode* node = root->scope.nodes[j];
+			n_folded += fold_recur(node->type == NODE_FUN_STATEMENT ? node->fun.body : node, &arithmetic);
+		}
+		folder.spine = arithmetic.spine;
+		goto quit;
+	}
+
+	collect_reassigned(root, folder.reassigned);
+
+	// Function bodies run after every top-level declaration is known, so
+	// they see all constant globals while top-level code only sees
+	// those declared before it.
+	for(size_t i = 0; i < root->scope.n_nodes; ++i)
+		if(root->scope.nodes[i]->type != NODE_FUN_STATEMENT)
+			n_folded += fold_recur(root->scope.nodes[i], &folder);
+
+	for(size_t i = 0; i < root->scope.n_nodes; ++i) {
+		ASTNode* fun = root->scope.nodes[i];
+		if(fun->type != NODE_FUN_STATEMENT)
+			continue;
+		++folder.fun;
+		for(size_t j = 0; j < fun->fun.arguments.size; ++j)
+			folder.local_in[fun->fun.arguments.data[j].id] = folder.fun;
+		n_folded += fold_recur(fun->fun.body, &folder);
+	}
+
+quit:
+	free(folder.reassigned);
+	free(folder.is_constant);
+	free(folder.constants);
+	free(folder.local_in);
+	vector_deinit(&folder.spine);
+	return n_folded;
 }
 
-static int is_a_redecl(const char* iden, Vector_Variable* global_vars, Vector_Variable* vars) {
-	if(!vars) {
-		for(size_t i = 0; i < global_vars->size; ++i)
-			if(!strcmp(global_vars->data[i].identifier, iden))
-				return 1;
+size_t ast_fold_statement(ASTNode* node) {
+	Folder folder = { 0 };
+	if(vector_ASTNode_ptr_t_init(&folder.spine, 64))
 		return 0;
+	size_t n_folded = fold_recur(node->type == NODE_FUN_STATEMENT ? node->fun.body : node, &folder);
+	vector_deinit(&folder.spine);
+	return n_folded;
+}
+
+int resolver_init(Resolver* res, size_t n_symbols, int incremental) {
+	*res = (Resolver){ .incremental = incremental };
+	if(vector_Shadowed_init(&res->shadowed, 64))
+		return 1;
+	if(vector_ASTNode_ptr_t_init(&res->spine, 64)) {
+		vector_deinit(&res->shadowed);
+		return 1;
+	}
+	if(resolver_reserve(res, n_symbols)) {
+		vector_deinit(&res->shadowed);
+		vector_deinit(&res->spine);
+		return 1;
 	}
-	for(size_t i = 0; i < vars->size; ++i)
-		if(!strcmp(vars->data[i].identifier, iden))
-			return 1;
 	return 0;
 }
 
+int resolver_reserve(Resolver* res, size_t n_symbols) {
+	if(n_symbols <= res->n_bindings && res->bindings)
+		return 0;
+	size_t n_bindings = res->n_bindings * 2 > n_symbols ? res->n_bindings * 2 : n_symbols;
+	Binding* bindings = realloc(res->bindings, sizeof(Binding) * (n_bindings + 1));
+	if(!bindings)
+		return 1;
+	for(size_t i = res->n_bindings; i < n_bindings; ++i)
+		bindings[i] = (Binding){ -1, -1, 0, -1, 0, 0 };
+	res->bindings = bindings;
+	res->n_bindings = n_bindings;
+	return 0;
+}
+
+void resolver_deinit(Resolver* res) {
+	free(res->bindings);
+	res->bindings = NULL;
+	res->n_bindings = 0;
+	vector_deinit(&res->shadowed);
+	vector_deinit(&res->spine);
+}
+
+static void scope_open(Resolver* res, Scope* scope, Scope* parent) {
+	scope->id = ++res->n_scopes;
+	scope->n_vars = parent ? parent->n_vars : 0;
+	scope->shadowed_base = res->shadowed.size;
+}
+
+static void scope_declare(Resolver* res, Scope* scope, SymbolId id, int64_t index) {
+	Binding* binding = &res->bindings[id];
+	vector_aappend(&res->shadowed, ((Shadowed){ id, binding->local, binding->scope }));
+	binding->local = index;
+	binding->scope = scope->id;
+}
+
+static void scope_close(Resolver* res, Scope* scope) {
+	while(res->shadowed.size > scope->shadowed_base) {
+		Shadowed* shadowed = &res->shadowed.data[--res->shadowed.size];
+		res->bindings[shadowed->id].local = shadowed->local;
+		res->bindings[shadowed->id].scope = shadowed->scope;
+	}
+}
+
+static int is_a_redecl(Resolver* res, SymbolId id, Scope* scope) {
+	Binding* binding = &res->bindings[id];
+	if(!scope)
+		return binding->global >= 0 && !binding->global_line;
+	return binding->local >= 0 && binding->scope == scope->id;
+}
+
+static void undeclared(Silk_Ctx* ctx, int line, Symbol identifier) {
+	if(ctx->print_errors)
+		printf("%s:%d: error: Undeclared identifier \"" STR_FMT "\"\n",
+			ctx->filename, line, STR_ARG(identifier.str));
+}
+
+// Top-level code only sees globals declared before it. Function bodies
+// see them all, which means reserving the ones that haven't arrived yet
+// when compiling incrementally.
+static Binding* resolve_var(Resolver* res, SymbolId id, Scope* scope, int line) {
+	Binding* binding = &res->bindings[id];
+	if(scope && binding->local >= 0)
+		return binding;
+	if(binding->global >= 0 && (scope || !binding->global_line))
+		return binding;
+	if(!scope || !res->incremental)
+		return NULL;
+	binding->global = res->n_globals++;
+	binding->global_line = line;
+	++res->n_unresolved;
+	return binding;
+}
+
+// `scope` is NULL at the top level
 static int compile_recur(Silk_Ctx* ctx, Vector_Instruction* instructions, ASTNode* node,
-	Vector_FunctionCtx* functions, Vector_BackPatch* bpatches, Vector_Variable* global_vars,
-	Vector_Variable* vars, Vector_Variable* scope_merge_vars) {
-	int is_global = vars == NULL;
+	Resolver* res, Scope* scope, FunctionCtx* fun) {
+	int is_global = scope == NULL;
 	switch(node->type) {
-		case NODE_SCOPE: { // TODO: Rethink how scopes should be implemented
-			Vector_Variable scope_vars;
-			vector_Variable_ainit(&scope_vars, 64);
-			if(scope_merge_vars) {
-				memcpy(scope_vars.data, scope_merge_vars->data, sizeof(Variable) * scope_merge_vars->size);
-				scope_vars.size = scope_merge_vars->size;
-			}
+		case NODE_SCOPE: {
+			Scope inner;
+			scope_open(res, &inner, scope);
 			for(size_t i = 0; i < node->scope.n_nodes; ++i)
-				if(compile_recur(ctx, instructions, node->scope.nodes[i], functions, bpatches, global_vars, &scope_vars, NULL)) {
-					vector_deinit(&scope_vars);
+				if(compile_recur(ctx, instructions, node->scope.nodes[i], res, &inner, fun))
 					return 1;
-				}
-			vector_deinit(&scope_vars);
+			scope_close(res, &inner);
 		}
 			break;
 		case NODE_EXPR:
@@ -142,117 +376,138 @@ static int compile_recur(Silk_Ctx* ctx, Vector_Instruction* instructions, ASTNod
 				case NODE_EXPR_INT_LIT:
 					vector_aappend(instructions, ((Instruction){ INST_PUSH, node->expr.int_lit.num }));
 					break;
-				case NODE_EXPR_BIN_OP:
-					if(compile_recur(ctx, instructions, node->expr.bin_op.lhs, functions, bpatches, global_vars, vars, NULL))
-						return 1;
-					if(compile_recur(ctx, instructions, node->expr.bin_op.rhs, functions, bpatches, global_vars, vars, NULL))
-						return 1;
-					switch(node->expr.bin_op.type) {
-						case NODE_EXPR_SUM:
-							vector_aappend(instructions, ((Instruction){ INST_SUM, 0 }));
-							break;
-						case NODE_EXPR_SUB:
-							vector_aappend(instructions, ((Instruction){ INST_SUB, 0 }));
-							break;
-						case NODE_EXPR_MUL:
-							vector_aappend(instructions, ((Instruction){ INST_MUL, 0 }));
-							break;
-						case NODE_EXPR_DIV:
-							vector_aappend(instructions, ((Instruction){ INST_DIV, 0 }));
-							break;
-						default:
-							assert(0);
+				case NODE_EXPR_BIN_OP: {
+					size_t base = res->spine.size;
+					int failed = compile_recur(ctx, instructions, push_spine(&res->spine, node), res, scope, fun);
+					while(!failed && res->spine.size > base) {
+						ASTNode* op = res->spine.data[--res->spine.size];
+						failed = compile_recur(ctx, instructions, op->expr.bin_op.rhs, res, scope, fun);
+						vector_aappend(instructions, ((Instruction){ bin_op_instruction(op->expr.bin_op.type), 0 }));
 					}
+					res->spine.size = base;
+					if(failed)
+						return 1;
 					break;
-				case NODE_EXPR_FUN_CALL:
+				}
+				case NODE_EXPR_FUN_CALL: {
 					for(size_t i = 0; i < node->expr.fun_call.args.size; ++i)
-						if(compile_recur(ctx, instructions, node->expr.fun_call.args.data[i], functions, bpatches, global_vars, vars, NULL))
+						if(compile_recur(ctx, instructions, node->expr.fun_call.args.data[i], res, scope, fun))
 						return 1;
 
-					vector_aappend(bpatches, ((BackPatch){ node->expr.fun_call.identifier, instructions->size, node->line }));
-					vector_aappend(instructions, ((Instruction){ INST_CALL, 0 }));
+					// Every function is known before any code is compiled, so
+					// calls resolve straight away. Incrementally, the callee may
+					// not have arrived yet.
+					Binding* binding = &res->bindings[node->expr.fun_call.identifier.id];
+					if(binding->function < 0 && res->incremental) {
+						binding->function = res->n_functions++;
+						binding->function_line = node->line;
+						++res->n_unresolved;
+					}
+					else if(binding->function < 0) {
+						undeclared(ctx, node->line, node->expr.fun_call.identifier);
+						return 1;
+					}
+					vector_aappend(instructions, ((Instruction){ INST_CALL, binding->function + 1 }));
 					break;
-				case NODE_EXPR_VAR_LOOKUP:
-					if(!is_global) {
-						for(size_t i = 0; i < vars->size; ++i)
-							if(!strcmp(node->expr.var_lookup.identifier, vars->data[i].identifier)) {
-								vector_aappend(instructions, ((Instruction){ INST_LOAD, vars->data[i].index }));
-								return 0;
-							}
+				}
+				case NODE_EXPR_VAR_LOOKUP: {
+					Binding* binding = resolve_var(res, node->expr.var_lookup.identifier.id, scope, node->line);
+					if(!binding) {
+						undeclared(ctx, node->line, node->expr.var_lookup.identifier);
+						return 1;
 					}
-					for(size_t i = 0; i < global_vars->size; ++i)
-						if(!strcmp(node->expr.var_lookup.identifier, global_vars->data[i].identifier)) {
-							vector_aappend(instructions, ((Instruction){ INST_LOAD_GLOBAL, global_vars->data[i].index }));
-							return 0;
-						}
-					if(ctx->print_errors)
-						printf("%s:%d: error: Undeclared identifier \"%s\"\n",
-							ctx->filename, node->line,
-							node->expr.var_lookup.identifier);
-					return 1;
-				case NODE_EXPR_VAR_REASSIGNMENT:
-					if(compile_recur(ctx, instructions, node->expr.var_assignment.expr, functions, bpatches, global_vars, vars, NULL))
+					if(!is_global && binding->local >= 0)
+						vector_aappend(instructions, ((Instruction){ INST_LOAD, binding->local }));
+					else
+						vector_aappend(instructions, ((Instruction){ INST_LOAD_GLOBAL, binding->global }));
+					break;
+				}
+				case NODE_EXPR_VAR_REASSIGNMENT: {
+					if(compile_recur(ctx, instructions, node->expr.var_assignment.expr, res, scope, fun))
 						return 1;
 
-					if(!is_global) {
-						for(size_t i = 0; i < vars->size; ++i)
-							if(!strcmp(node->expr.var_assignment.identifier, vars->data[i].identifier)) {
-								vector_aappend(instructions, ((Instruction){ INST_STORE, vars->data[i].index }));
-								vector_aappend(instructions, ((Instruction){ INST_LOAD, vars->data[i].index }));
-								return 0;
-							}
+					Binding* binding = resolve_var(res, node->expr.var_assignment.identifier.id, scope, node->line);
+					if(!binding) {
+						undeclared(ctx, node->line, node->expr.var_assignment.identifier);
+						return 1;
 					}
-
-					for(size_t i = 0; i < global_vars->size; ++i)
-						if(!strcmp(node->expr.var_assignment.identifier, global_vars->data[i].identifier)) {
-							vector_aappend(instructions, ((Instruction){ INST_STORE_GLOBAL, global_vars->data[i].index }));
-							vector_aappend(instructions, ((Instruction){ INST_LOAD_GLOBAL, global_vars->data[i].index }));
-							return 0;
-						}
-					if(ctx->print_errors)
-						printf("%s:%d: error: Undeclared identifier \"%s\"\n",
-							ctx->filename, node->line,
-							node->expr.var_lookup.identifier);
-					return 1;
+					if(!is_global && binding->local >= 0) {
+						vector_aappend(instructions, ((Instruction){ INST_STORE, binding->local }));
+						vector_aappend(instructions, ((Instruction){ INST_LOAD, binding->local }));
+					}
+					else {
+						vector_aappend(instructions, ((Instruction){ INST_STORE_GLOBAL, binding->global }));
+						vector_aappend(instructions, ((Instruction){ INST_LOAD_GLOBAL, binding->global }));
+					}
+					break;
+				}
 				default:
 					assert(0);
 			}
 			break;
 		case NODE_RET_STATEMENT:
-			if(compile_recur(ctx, instructions, node->ret.expr, functions, bpatches, global_vars, vars, NULL))
+			if(compile_recur(ctx, instructions, node->ret.expr, res, scope, fun))
 				return 1;
+			// A call in tail position reuses the current frame
+			if(node->ret.expr->type == NODE_EXPR && node->ret.expr->expr.type == NODE_EXPR_FUN_CALL) {
+				instructions->data[instructions->size - 1].type = INST_TAILCALL;
+				break;
+			}
 			vector_aappend(instructions, ((Instruction){ INST_RET, 0 }));
 			break;
 		case NODE_FUN_STATEMENT: {
-			FunctionCtx* fun = lookup_fun_ctx(functions, node);
+			// Arguments share a scope with the body's declarations
+			Scope fun_scope;
+			scope_open(res, &fun_scope, NULL);
 			fun->start_addr = instructions->size;
-			Vector_Variable* merge_or_null = NULL;
-			Vector_Variable merge;
-			if(node->fun.arguments.size) {
-				vector_Variable_ainit(&merge, 64);
-				for(size_t i = 0; i < node->fun.arguments.size; ++i) {
-					vector_aappend(&merge, ((Variable){ node->fun.arguments.data[i], i }));
-					vector_aappend(instructions, ((Instruction){ INST_STORE, i }));
-				}
-
-				merge_or_null = &merge;
+			fun->n_locals = node->fun.arguments.size;
+			for(size_t i = 0; i < node->fun.arguments.size; ++i) {
+				// The first of several same-named arguments wins
+				SymbolId id = node->fun.arguments.data[i].id;
+				if(!is_a_redecl(res, id, &fun_scope))
+					scope_declare(res, &fun_scope, id, i);
+				vector_aappend(instructions, ((Instruction){ INST_STORE, i }));
 			}
-			if(compile_recur(ctx, instructions, node->fun.body, functions, bpatches, global_vars, vars, merge_or_null)) {
-				if(node->fun.arguments.size)
-					vector_deinit(merge_or_null);
-				return 1;
+			fun_scope.n_vars = node->fun.arguments.size;
+
+			ASTNode* body = node->fun.body;
+			for(size_t i = 0; i < body->scope.n_nodes; ++i)
+				if(compile_recur(ctx, instructions, body->scope.nodes[i], res, &fun_scope, fun))
+					return 1;
+			// A body that doesn't end in a return gives back 0 rather than
+			// running on into the next function's code
+			if(instructions->size == fun->start_addr ||
+				!instruction_is_return(instructions->data[instructions->size - 1].type)) {
+				vector_aappend(instructions, ((Instruction){ INST_PUSH, 0 }));
+				vector_aappend(instructions, ((Instruction){ INST_RET, 0 }));
 			}
-			if(node->fun.arguments.size)
-				vector_deinit(merge_or_null);
+			scope_close(res, &fun_scope);
 			break;
 		}
 		case NODE_VAR_STATEMENT: {
-			if(is_a_redecl(node->var.identifier, global_vars, vars))
+			SymbolId id = node->var.identifier.id;
+			if(is_a_redecl(res, id, scope))
 				return 1;
-			if(compile_recur(ctx, instructions, node->var.expr, functions, bpatches, global_vars, vars, NULL))
+			if(compile_recur(ctx, instructions, node->var.expr, res, scope, fun))
 				return 1;
-			int64_t index = is_global ? global_vars->size : vars->size;
-			vector_aappend(is_global ? global_vars : vars, ((Variable){ node->var.identifier, index }));
+			int64_t index;
+			Binding* binding = &res->bindings[id];
+			if(is_global && binding->global >= 0) {
+				// Reserved by a function body that came first
+				index = binding->global;
+				binding->global_line = 0;
+				--res->n_unresolved;
+			}
+			else if(is_global) {
+				index = res->n_globals++;
+				binding->global = index;
+			}
+			else {
+				index = scope->n_vars++;
+				scope_declare(res, scope, id, index);
+			}
+			if(fun && (size_t) index >= fun->n_locals)
+				fun->n_locals = index + 1;
 			vector_aappend(instructions, ((Instruction){ is_global ? INST_STORE_GLOBAL : INST_STORE, index }));
 			break;
 		}
@@ -262,25 +517,178 @@ static int compile_recur(Silk_Ctx* ctx, Vector_Instruction* instructions, ASTNod
 	return 0;
 }
 
-int ast_compile(Silk_Ctx* ctx, Vector_Instruction* instructions, ASTNode* node) {
+size_t ast_max_stack(Instruction* code, size_t begin, size_t end, FunctionInfo* infos) {
+	int64_t depth = 0;
+	int64_t max = 0;
+	for(size_t i = begin; i < end; ++i) {
+		Instruction* inst = &code[i];
+		if(inst->type == INST_CALL || inst->type == INST_TAILCALL)
+			depth += 1 - (int64_t) infos[inst->val].n_args;
+		else
+			depth += instruction_stack_effect(inst);
+		if(depth > max)
+			max = depth;
+	}
+	return max;
+}
+
+// Appends functions[begin..end) to `code`, start addresses relative to it
+static int compile_functions(Silk_Ctx* ctx, Resolver* res, Vector_Instruction* code,
+	Vector_FunctionCtx* functions, size_t begin, size_t end) {
+	for(size_t i = begin; i < end; ++i)
+		if(compile_recur(ctx, code, functions->data[i].node, res, NULL, &functions->data[i]))
+			return 1;
+	return 0;
+}
+
+// Functions are handed out in chunks of this many, each compiled into
+// a buffer of its own. The buffers are joined in order, so the code is
+// the same whichever thread compiled what.
+#define COMPILE_CHUNK 64
+
+typedef struct {
+	// Copy with print_errors off. A failure gets compiled again on the
+	// calling thread to report it.
+	Silk_Ctx ctx;
+	const Resolver* res;
+	Vector_FunctionCtx* functions;
+	Vector_Instruction* chunks;
+	size_t n_chunks;
+	pthread_mutex_t lock;
+	size_t next;
+	char failed;
+} CompileJobs;
+
+// Bindings only change within a function and are back where they were
+// once it's compiled, so each thread works on a copy of the resolver as
+// the top level left it
+static int resolver_clone(Resolver* res, const Resolver* from) {
+	if(resolver_init(res, from->n_bindings, 0))
+		return 1;
+	memcpy(res->bindings, from->bindings, sizeof(Binding) * from->n_bindings);
+	res->n_globals = from->n_globals;
+	res->n_functions = from->n_functions;
+	res->n_scopes = from->n_scopes;
+	return 0;
+}
+
+static void* compile_worker(void* arg) {
+	CompileJobs* jobs = arg;
+	Resolver res;
+	int failed = resolver_clone(&res, jobs->res);
+	while(!failed) {
+		pthread_mutex_lock(&jobs->lock);
+		size_t chunk = jobs->next++;
+		failed = jobs->failed;
+		pthread_mutex_unlock(&jobs->lock);
+		if(failed || chunk >= jobs->n_chunks)
+			break;
+
+		size_t begin = chunk * COMPILE_CHUNK;
+		size_t end = begin + COMPILE_CHUNK < jobs->functions->size ? begin + COMPILE_CHUNK : jobs->functions->size;
+		failed = vector_Instruction_init(&jobs->chunks[chunk], 1024) ||
+			compile_functions(&jobs->ctx, &res, &jobs->chunks[chunk], jobs->functions, begin, end);
+	}
+	if(failed) {
+		pthread_mutex_lock(&jobs->lock);
+		jobs->failed = 1;
+		pthread_mutex_unlock(&jobs->lock);
+	}
+	if(res.bindings)
+		resolver_deinit(&res);
+	return NULL;
+}
+
+static size_t compile_threads(Silk_Ctx* ctx, size_t n_chunks) {
+	long n = ctx->compile_threads;
+	if(n <= 0)
+		n = sysconf(_SC_NPROCESSORS_ONLN);
+	if(n < 1)
+		n = 1;
+	return (size_t) n < n_chunks ? (size_t) n : n_chunks;
+}
+
+// Compiles every function body after the code already in `instructions`,
+// spreading the chunks over the threads. Returns 1 if any of them failed
+// or the threads couldn't be set up, in which case nothing is appended.
+static int compile_parallel(Silk_Ctx* ctx, Resolver* res, Vector_Instruction* instructions,
+	Vector_FunctionCtx* functions, size_t n_threads) {
+	size_t n_chunks = (functions->size + COMPILE_CHUNK - 1) / COMPILE_CHUNK;
+	CompileJobs jobs = {
+		.ctx = *ctx,
+		.res = res,
+		.functions = functions,
+		.chunks = calloc(n_chunks, sizeof(Vector_Instruction)),
+		.n_chunks = n_chunks
+	};
+	jobs.ctx.print_errors = 0;
+	if(!jobs.chunks)
+		return 1;
+	if(pthread_mutex_init(&jobs.lock, NULL)) {
+		free(jobs.chunks);
+		return 1;
+	}
+
+	pthread_t* threads = malloc(sizeof(pthread_t) * n_threads);
+	size_t n_started = 0;
+	// The calling thread is one of the workers
+	if(threads)
+		while(n_started + 1 < n_threads &&
+			!pthread_create(&threads[n_started], NULL, compile_worker, &jobs))
+			++n_started;
+	compile_worker(&jobs);
+	for(size_t i = 0; i < n_started; ++i)
+		pthread_join(threads[i], NULL);
+	free(threads);
+	pthread_mutex_destroy(&jobs.lock);
+
+	for(size_t chunk = 0; chunk < n_chunks; ++chunk) {
+		Vector_Instruction* code = &jobs.chunks[chunk];
+		if(!jobs.failed) {
+			size_t offset = instructions->size;
+			size_t begin = chunk * COMPILE_CHUNK;
+			size_t end = begin + COMPILE_CHUNK < functions->size ? begin + COMPILE_CHUNK : functions->size;
+			for(size_t i = begin; i < end; ++i)
+				functions->data[i].start_addr += offset;
+			for(size_t i = 0; i < code->size; ++i)
+				vector_aappend(instructions, code->data[i]);
+		}
+		vector_deinit(code);
+	}
+	free(jobs.chunks);
+	return jobs.failed;
+}
+
+int ast_compile(Silk_Ctx* ctx, Vector_Instruction* instructions, Vector_FunctionInfo* infos,
+	ASTNode* node, size_t n_symbols) {
 	int ret = 0;
 
 	Vector_FunctionCtx functions;
 	vector_FunctionCtx_ainit(&functions, 64);
 
-	Vector_BackPatch bpatches;
-	vector_BackPatch_ainit(&bpatches, 64);
-
-	Vector_Variable global_vars;
-	vector_Variable_ainit(&global_vars, 64);
+	Resolver res;
+	if(resolver_init(&res, n_symbols, 0)) {
+		vector_deinit(&functions);
+		return 1;
+	}
 
 	assert(node->type == NODE_SCOPE);
 	for(size_t i = 0; i < node->scope.n_nodes; ++i) {
-		if(node->scope.nodes[i]->type == NODE_FUN_STATEMENT) {
-			vector_aappend(&functions, ((FunctionCtx){ node->scope.nodes[i], 0, 0 }));
+		ASTNode* fun = node->scope.nodes[i];
+		if(fun->type != NODE_FUN_STATEMENT)
 			continue;
-		}
-		if(compile_recur(ctx, instructions, node->scope.nodes[i], &functions, &bpatches, &global_vars, NULL, NULL)) {
+		// Calls go to the first definition of a name
+		Binding* binding = &res.bindings[fun->fun.identifier.id];
+		if(binding->function < 0)
+			binding->function = functions.size;
+		++res.n_functions;
+		vector_aappend(&functions, ((FunctionCtx){ fun, 0, 0, 0 }));
+	}
+
+	for(size_t i = 0; i < node->scope.n_nodes; ++i) {
+		if(node->scope.nodes[i]->type == NODE_FUN_STATEMENT)
+			continue;
+		if(compile_recur(ctx, instructions, node->scope.nodes[i], &res, NULL, NULL)) {
 			ret = 1;
 			goto quit;
 		}
@@ -288,38 +696,135 @@ int ast_compile(Silk_Ctx* ctx, Vector_Instruction* instructions, ASTNode* node)
 
 	vector_aappend(instructions, ((Instruction){ INST_EXIT, 0 }));
 
-	for(size_t i = 0; i < functions.size; ++i) {
-		Vector_Variable scope_vars;
-		vector_Variable_ainit(&scope_vars, 64);
-		if(compile_recur(ctx, instructions, functions.data[i].node, &functions, &bpatches, &global_vars, &scope_vars, NULL)) {
-			vector_deinit(&scope_vars);
-			ret = 1;
-			goto quit;
-		}
-		vector_deinit(&scope_vars);
+	size_t n_threads = compile_threads(ctx, (functions.size + COMPILE_CHUNK - 1) / COMPILE_CHUNK);
+	if((n_threads < 2 || compile_parallel(ctx, &res, instructions, &functions, n_threads)) &&
+		compile_functions(ctx, &res, instructions, &functions, 0, functions.size)) {
+		ret = 1;
+		goto quit;
 	}
 
-	for(size_t i = 0; i < bpatches.size; ++i) {
-		FunctionCtx* fun_ctx = lookup_fun_ctx_by_name(&functions, bpatches.data[i].identifier);
-		if(!fun_ctx) {
-			if(ctx->print_errors)
-				printf("%s:%d: error: Undeclared identifier \"%s\"\n",
-				ctx->filename, bpatches.data[i].line,
-				bpatches.data[i].identifier);
-			ret = 1;
-			goto quit;
-		}
-		instructions->data[bpatches.data[i].code_pos].val = fun_ctx->start_addr;
+	// Entry 0 describes the top level, whose frame holds the globals
+	vector_aappend(infos, ((FunctionInfo){ 0, 0, res.n_globals, 0 }));
+	for(size_t i = 0; i < functions.size; ++i)
+		vector_aappend(infos, ((FunctionInfo){
+			functions.data[i].start_addr,
+			functions.data[i].node->fun.arguments.size,
+			functions.data[i].n_locals,
+			0
+		}));
+	for(size_t i = 0; i < infos->size; ++i) {
+		size_t end = i + 1 < infos->size ? infos->data[i + 1].start_addr : instructions->size;
+		infos->data[i].max_stack = ast_max_stack(instructions->data, infos->data[i].start_addr, end, infos->data);
 	}
 
 quit:
 	vector_deinit(&functions);
-	vector_deinit(&bpatches);
-	vector_deinit(&global_vars);
+	resolver_deinit(&res);
 
 	return ret;
 }
 
+int ast_compile_top(Silk_Ctx* ctx, Resolver* res, Vector_Instruction* instructions,
+	Vector_FunctionInfo* infos, ASTNode* node) {
+	assert(node->type == NODE_SCOPE && !res->incremental);
+	vector_aappend(infos, ((FunctionInfo){ 0, 0, 0, 0 }));
+	for(size_t i = 0; i < node->scope.n_nodes; ++i) {
+		ASTNode* fun = node->scope.nodes[i];
+		if(fun->type != NODE_FUN_STATEMENT)
+			continue;
+		// Calls go to the first definition of a name
+		Binding* binding = &res->bindings[fun->fun.identifier.id];
+		if(binding->function < 0)
+			binding->function = res->n_functions;
+		++res->n_functions;
+		vector_aappend(infos, ((FunctionInfo){ FUNCTION_UNCOMPILED, fun->fun.arguments.size, 0, 0 }));
+	}
+
+	for(size_t i = 0; i < node->scope.n_nodes; ++i) {
+		if(node->scope.nodes[i]->type == NODE_FUN_STATEMENT)
+			continue;
+		if(compile_recur(ctx, instructions, node->scope.nodes[i], res, NULL, NULL))
+			return 1;
+	}
+	vector_aappend(instructions, ((Instruction){ INST_EXIT, 0 }));
+
+	infos->data[0].n_locals = res->n_globals;
+	infos->data[0].max_stack = ast_max_stack(instructions->data, 0, instructions->size, infos->data);
+	return 0;
+}
+
+int ast_compile_function(Silk_Ctx* ctx, Resolver* res, Vector_Instruction* instructions,
+	Vector_FunctionInfo* infos, ASTNode* node, size_t index) {
+	assert(node->type == NODE_FUN_STATEMENT && node->fun.body);
+	FunctionCtx fun = { node, 0, 0, 0 };
+	if(compile_recur(ctx, instructions, node, res, NULL, &fun))
+		return 1;
+	FunctionInfo* info = &infos->data[index];
+	info->start_addr = fun.start_addr;
+	info->n_locals = fun.n_locals;
+	info->max_stack = ast_max_stack(instructions->data, fun.start_addr, instructions->size, infos->data);
+	return 0;
+}
+
+int ast_compile_statement(Silk_Ctx* ctx, Resolver* res, Vector_Instruction* top,
+	Vector_Instruction* code, Vector_FunctionInfo* infos, ASTNode* node, int64_t* function) {
+	assert(res->incremental);
+	*function = -1;
+	if(!infos->size)
+		vector_aappend(infos, ((FunctionInfo){ 0, 0, 0, 0 }));
+
+	int failed;
+	if(node->type == NODE_FUN_STATEMENT) {
+		// Calls go to the first definition of a name, which may have been
+		// reserved by a call that came first
+		Binding* binding = &res->bindings[node->fun.identifier.id];
+		if(binding->function >= 0 && binding->function_line) {
+			*function = binding->function + 1;
+			binding->function_line = 0;
+			--res->n_unresolved;
+		}
+		else {
+			*function = res->n_functions++ + 1;
+			if(binding->function < 0)
+				binding->function = *function - 1;
+		}
+
+		FunctionCtx fun = { node, 0, 0, 0 };
+		failed = compile_recur(ctx, code, node, res, NULL, &fun);
+		while(infos->size < res->n_functions + 1)
+			vector_aappend(infos, ((FunctionInfo){ 0, 0, 0, 0 }));
+		infos->data[*function] = (FunctionInfo){ fun.start_addr, node->fun.arguments.size, fun.n_locals, 0 };
+	}
+	else
+		failed = compile_recur(ctx, top, node, res, NULL, NULL);
+
+	// Entries reserved for callees that haven't been seen yet
+	while(infos->size < res->n_functions + 1)
+		vector_aappend(infos, ((FunctionInfo){ 0, 0, 0, 0 }));
+	infos->data[0].n_locals = res->n_globals;
+	return failed;
+}
+
+int ast_check_resolved(Silk_Ctx* ctx, Resolver* res, const SymbolTable* symbols) {
+	if(!res->n_unresolved)
+		return 0;
+	SymbolId first = 0;
+	int first_line = 0;
+	for(SymbolId id = 0; id < res->n_bindings && id < symbols->size; ++id) {
+		Binding* binding = &res->bindings[id];
+		int line = binding->global_line && (!binding->function_line ||
+			binding->global_line < binding->function_line)
+			? binding->global_line
+			: binding->function_line;
+		if(line && (!first_line || line < first_line)) {
+			first = id;
+			first_line = line;
+		}
+	}
+	undeclared(ctx, first_line, (Symbol){ symbols->names[first], first });
+	return 1;
+}
+
 const char* ast_node_type_to_str(ASTNodeType type) {
 	switch(type) {
 #define ENUMERATOR(typ3) case typ3: return &#typ3[5];
@@ -351,9 +856,9 @@ void ast_print_node(ASTNode* node, int indent) {
 				ast_print_node(node->scope.nodes[i], indent + 1);
 			break;
 		case NODE_FUN_STATEMENT:
-			printf("%s(", node->fun.identifier);
+			printf(STR_FMT "(", STR_ARG(node->fun.identifier.str));
 			for(size_t i = 0; i < node->fun.arguments.size; ++i)
-				printf("%s%s", node->fun.arguments.data[i],
+				printf(STR_FMT "%s", STR_ARG(node->fun.arguments.data[i].str),
 					i == node->fun.arguments.size - 1 ? "" : ", ");
 			printf(")\n");
 			ast_print_node(node->fun.body, indent + 1);
@@ -368,22 +873,37 @@ void ast_print_node(ASTNode* node, int indent) {
 					printf("%ld\n", node->expr.int_lit.num);
 					break;
 				case NODE_EXPR_STR_LIT:
-					printf("\"%s\"\n", node->expr.str_lit.str);
+					printf("\"" STR_FMT "\"\n", STR_ARG(node->expr.str_lit.str));
 					break;
-				case NODE_EXPR_BIN_OP:
+				case NODE_EXPR_BIN_OP: {
+					// Each lhs down the chain goes one level deeper, then
+					// the rhs operands follow from the innermost out
+					Vector_ASTNode_ptr_t spine;
+					vector_ASTNode_ptr_t_ainit(&spine, 64);
 					printf("%c\n", node->expr.bin_op.type);
-					ast_print_node(node->expr.bin_op.lhs, indent + 1);
-					ast_print_node(node->expr.bin_op.rhs, indent + 1);
+					vector_aappend(&spine, node);
+					for(ASTNode* lhs = node->expr.bin_op.lhs; is_bin_op(lhs); lhs = lhs->expr.bin_op.lhs) {
+						print_indent(indent + spine.size);
+						printf("%s %c\n", ast_node_type_to_str(lhs->type), lhs->expr.bin_op.type);
+						vector_aappend(&spine, lhs);
+					}
+					ast_print_node(spine.data[spine.size - 1]->expr.bin_op.lhs, indent + spine.size);
+					while(spine.size) {
+						ASTNode* op = spine.data[--spine.size];
+						ast_print_node(op->expr.bin_op.rhs, indent + spine.size + 1);
+					}
+					vector_deinit(&spine);
 					break;
+				}
 				case NODE_EXPR_VAR_LOOKUP:
-					printf("%s\n", node->expr.var_lookup.identifier);
+					printf(STR_FMT "\n", STR_ARG(node->expr.var_lookup.identifier.str));
 					break;
 				case NODE_EXPR_VAR_REASSIGNMENT:
-					printf("%s =\n", node->expr.var_assignment.identifier);
+					printf(STR_FMT " =\n", STR_ARG(node->expr.var_assignment.identifier.str));
 					ast_print_node(node->expr.var_assignment.expr, indent + 1);
 					break;
 				case NODE_EXPR_FUN_CALL:
-					printf("%s()\n", node->expr.fun_call.identifier);
+					printf(STR_FMT "()\n", STR_ARG(node->expr.fun_call.identifier.str));
 					for(size_t i = 0; i < node->expr.fun_call.args.size; ++i)
 						ast_print_node(node->expr.fun_call.args.data[i], indent + 1);
 					break;
@@ -392,7 +912,7 @@ void ast_print_node(ASTNode* node, int indent) {
 			}
 			break;
 		case NODE_VAR_STATEMENT:
-			printf("%s =\n", node->var.identifier);
+			printf(STR_FMT " =\n", STR_ARG(node->var.identifier.str));
 			ast_print_node(node->var.expr, indent + 1);
 			break;
 		default:
@@ -6,6 +6,9 @@
 #include <silk.h>
 
 #include "instruction.h"
+#include "str.h"
+#include "symbol.h"
+#include "arena.h"
 #include "vector.h"
 
 #define FOR_EACH_NODE(_) \
@@ -21,10 +24,9 @@ typedef enum {
 #undef ENUMERATOR
 } ASTNodeType;
 
-typedef char* str_t;
-#ifndef VECTOR_DEFINED_str_t
-#define VECTOR_DEFINED_str_t
-VECTOR_DEFINE(str_t)
+#ifndef VECTOR_DEFINED_Symbol
+#define VECTOR_DEFINED_Symbol
+VECTOR_DEFINE(Symbol)
 #endif
 
 typedef struct ASTNode ASTNode;
@@ -34,6 +36,17 @@ typedef ASTNode* ASTNode_ptr_t;
 VECTOR_DEFINE(ASTNode_ptr_t)
 #endif
 
+// Arrays allocated in the parse arena, sized exactly
+typedef struct {
+	size_t size;
+	ASTNode** data;
+} ASTNodeList;
+
+typedef struct {
+	size_t size;
+	Symbol* data;
+} SymbolList;
+
 struct ASTNode {
 	ASTNodeType type;
 	int line;
@@ -56,7 +69,7 @@ struct ASTNode {
 					int64_t num;
 				} int_lit;
 				struct {
-					char* str;
+					str_t str;
 				} str_lit;
 				struct {
 					enum {
@@ -69,28 +82,32 @@ struct ASTNode {
 					ASTNode* rhs;
 				} bin_op;
 				struct {
-					char* identifier;
+					Symbol identifier;
 				} var_lookup;
 				struct {
-					char* identifier;
+					Symbol identifier;
 					ASTNode* expr;
 				} var_assignment;
 				struct {
-					char* identifier;
-					Vector_ASTNode_ptr_t args;
+					Symbol identifier;
+					ASTNodeList args;
 				} fun_call;
 			};
 		} expr;
 		struct {
-			char* identifier;
-			Vector_str_t arguments;
+			Symbol identifier;
+			SymbolList arguments;
+			// NULL while the body is only known by its source, from the
+			// opening brace to the closing one, starting on body_line
 			ASTNode* body;
+			str_t source;
+			int body_line;
 		} fun;
 		struct {
 			ASTNode* expr;
 		} ret;
 		struct {
-			char* identifier;
+			Symbol identifier;
 			ASTNode* expr;
 		} var;
 	};
@@ -101,11 +118,91 @@ struct ASTNode {
 VECTOR_DEFINE(Instruction)
 #endif
 
-ASTNode* ast_create_node(ASTNode node);
+#ifndef VECTOR_DEFINED_FunctionInfo
+#define VECTOR_DEFINED_FunctionInfo
+VECTOR_DEFINE(FunctionInfo)
+#endif
+
+// What a name refers to at the current point of compilation. One per
+// symbol id, so resolving a name is a single array access.
+typedef struct {
+	// Slot among the globals, -1 until declared at the top level
+	int64_t global;
+	// Slot in the function being compiled, -1 if there's none
+	int64_t local;
+	// Scope that declared `local`
+	size_t scope;
+	// Index into the function table, -1 if there's no such function
+	int64_t function;
+	// Line of the first use of `global` or `function` ahead of its
+	// declaration, 0 once declared. Only incremental compilation
+	// reserves names like that.
+	int global_line;
+	int function_line;
+} Binding;
+
+// Local binding hidden by a declaration, restored when its scope closes
+typedef struct {
+	SymbolId id;
+	int64_t local;
+	size_t scope;
+} Shadowed;
+#ifndef VECTOR_DEFINED_Shadowed
+#define VECTOR_DEFINED_Shadowed
+VECTOR_DEFINE(Shadowed)
+#endif
+
+// Name resolution state, kept across statements when compiling
+// incrementally
+typedef struct {
+	Binding* bindings;
+	size_t n_bindings;
+	Vector_Shadowed shadowed;
+	size_t n_globals;
+	size_t n_functions;
+	size_t n_scopes;
+	// Set when a statement is compiled before the rest of the script has
+	// been seen. Function bodies may then use globals and functions
+	// declared further on, which get reserved until they show up.
+	char incremental;
+	size_t n_unresolved;
+	// Scratch stack for walking operator chains
+	Vector_ASTNode_ptr_t spine;
+} Resolver;
+
+// Nodes live in the parser's arena and are freed with it
+ASTNode* ast_create_node(Arena* arena, ASTNode node);
+
+// n_symbols bounds the symbol ids found in the tree
+size_t ast_fold_constants(ASTNode* root, size_t n_symbols);
+int ast_compile(Silk_Ctx* ctx, Vector_Instruction* instructions, Vector_FunctionInfo* infos,
+	ASTNode* node, size_t n_symbols);
 
-void ast_destroy(ASTNode* node);
+// Lazy compilation: ast_compile_top compiles the top level of a tree
+// whose function bodies the parser skipped, giving every function a
+// FUNCTION_UNCOMPILED entry. ast_compile_function later appends the code
+// of one function, index being its entry in the table, once its body is
+// parsed. `res` is kept between the two.
+int ast_compile_top(Silk_Ctx* ctx, Resolver* res, Vector_Instruction* instructions,
+	Vector_FunctionInfo* infos, ASTNode* node);
+int ast_compile_function(Silk_Ctx* ctx, Resolver* res, Vector_Instruction* instructions,
+	Vector_FunctionInfo* infos, ASTNode* node, size_t index);
 
-int ast_compile(Silk_Ctx* ctx, Vector_Instruction* instructions, ASTNode* node);
+int resolver_init(Resolver* res, size_t n_symbols, int incremental);
+// Makes room for symbol ids below n_symbols
+int resolver_reserve(Resolver* res, size_t n_symbols);
+void resolver_deinit(Resolver* res);
+// Compiles one top-level statement. Function bodies are appended to
+// `code` and described in `infos`, whose entry 0 is left for the top
+// level, everything else is appended to `top`. *function is set to the
+// entry of a compiled function, -1 otherwise.
+int ast_compile_statement(Silk_Ctx* ctx, Resolver* res, Vector_Instruction* top,
+	Vector_Instruction* code, Vector_FunctionInfo* infos, ASTNode* node, int64_t* function);
+// Reports the first name still reserved, if any, returning 1 then
+int ast_check_resolved(Silk_Ctx* ctx, Resolver* res, const SymbolTable* symbols);
+// Folds arithmetic within a single statement, leaving globals alone
+size_t ast_fold_statement(ASTNode* node);
+size_t ast_max_stack(Instruction* code, size_t begin, size_t end, FunctionInfo* infos);
 
 const char* ast_node_type_to_str(ASTNodeType node);
 void ast_print_node(ASTNode* root, int indent);
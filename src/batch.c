@@ -0,0 +1,177 @@
+#define _DEFAULT_SOURCE
+#include <silk.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "vm.h"
+
+// Runs are claimed a few at a time, so that short ones don't spend their
+// time on the lock, while long batches still even out across threads
+#define BATCH_CLAIMS_PER_THREAD 8
+
+typedef struct {
+	Silk_Workers* workers;
+	Silk_VM* vm;
+	pthread_t thread;
+} Worker;
+
+struct Silk_Workers {
+	Worker* workers;
+	size_t n_workers;
+	// Held for a whole batch, so batches from several callers queue up
+	pthread_mutex_t batch_lock;
+
+	pthread_mutex_t lock;
+	// Signalled when a batch comes in and when the workers should stop
+	pthread_cond_t work;
+	// Signalled when the last run of a batch is done
+	pthread_cond_t done;
+	Silk_Ctx* ctx;
+	const Silk_Program* program;
+	int* results;
+	size_t n_runs;
+	size_t claim;
+	size_t next;
+	size_t n_finished;
+	int failed;
+	char stopping;
+};
+
+static void* worker_main(void* arg) {
+	Worker* worker = arg;
+	Silk_Workers* workers = worker->workers;
+	pthread_mutex_lock(&workers->lock);
+	for(;;) {
+		while(!workers->stopping && workers->next >= workers->n_runs)
+			pthread_cond_wait(&workers->work, &workers->lock);
+		if(workers->stopping)
+			break;
+
+		size_t begin = workers->next;
+		size_t end = begin + workers->claim < workers->n_runs ? begin + workers->claim : workers->n_runs;
+		workers->next = end;
+		Silk_Ctx* ctx = workers->ctx;
+		const Silk_Program* program = workers->program;
+		int* results = workers->results;
+		pthread_mutex_unlock(&workers->lock);
+
+		int failed = 0;
+		for(size_t i = begin; i < end; ++i) {
+			int ret = silk_program_run_on(ctx, program, worker->vm);
+			if(results)
+				results[i] = ret;
+			failed |= ret;
+		}
+
+		pthread_mutex_lock(&workers->lock);
+		workers->failed |= failed;
+		workers->n_finished += end - begin;
+		if(workers->n_finished == workers->n_runs)
+			pthread_cond_signal(&workers->done);
+	}
+	pthread_mutex_unlock(&workers->lock);
+	return NULL;
+}
+
+static void stop_workers(Silk_Workers* workers, size_t n_started) {
+	pthread_mutex_lock(&workers->lock);
+	workers->stopping = 1;
+	pthread_cond_broadcast(&workers->work);
+	pthread_mutex_unlock(&workers->lock);
+	for(size_t i = 0; i < n_started; ++i)
+		pthread_join(workers->workers[i].thread, NULL);
+}
+
+Silk_Workers* silk_workers_create(int n_threads) {
+	long n = n_threads;
+	if(n <= 0)
+		n = sysconf(_SC_NPROCESSORS_ONLN);
+	if(n < 1)
+		n = 1;
+
+	Silk_Workers* workers = calloc(1, sizeof(Silk_Workers));
+	if(!workers)
+		return NULL;
+	workers->workers = calloc(n, sizeof(Worker));
+	if(!workers->workers)
+		goto free_workers;
+	workers->n_workers = n;
+	if(pthread_mutex_init(&workers->batch_lock, NULL))
+		goto free_array;
+	if(pthread_mutex_init(&workers->lock, NULL))
+		goto free_batch_lock;
+	if(pthread_cond_init(&workers->work, NULL))
+		goto free_lock;
+	if(pthread_cond_init(&workers->done, NULL))
+		goto free_work;
+
+	size_t n_started = 0;
+	for(; n_started < workers->n_workers; ++n_started) {
+		Worker* worker = &workers->workers[n_started];
+		worker->workers = workers;
+		worker->vm = silk_vm_create();
+		if(!worker->vm)
+			break;
+		if(pthread_create(&worker->thread, NULL, worker_main, worker)) {
+			silk_vm_free(worker->vm);
+			break;
+		}
+	}
+	if(n_started == workers->n_workers)
+		return workers;
+
+	stop_workers(workers, n_started);
+	for(size_t i = 0; i < n_started; ++i)
+		silk_vm_free(workers->workers[i].vm);
+	pthread_cond_destroy(&workers->done);
+free_work:
+	pthread_cond_destroy(&workers->work);
+free_lock:
+	pthread_mutex_destroy(&workers->lock);
+free_batch_lock:
+	pthread_mutex_destroy(&workers->batch_lock);
+free_array:
+	free(workers->workers);
+free_workers:
+	free(workers);
+	return NULL;
+}
+
+int silk_workers_run(Silk_Workers* workers, Silk_Ctx* ctx, const Silk_Program* program,
+	size_t n_runs, int* results) {
+	if(!n_runs)
+		return 0;
+	pthread_mutex_lock(&workers->batch_lock);
+	pthread_mutex_lock(&workers->lock);
+	workers->ctx = ctx;
+	workers->program = program;
+	workers->results = results;
+	workers->claim = n_runs / (workers->n_workers * BATCH_CLAIMS_PER_THREAD);
+	if(!workers->claim)
+		workers->claim = 1;
+	workers->next = 0;
+	workers->n_finished = 0;
+	workers->failed = 0;
+	workers->n_runs = n_runs;
+	pthread_cond_broadcast(&workers->work);
+	while(workers->n_finished < n_runs)
+		pthread_cond_wait(&workers->done, &workers->lock);
+	int failed = workers->failed;
+	pthread_mutex_unlock(&workers->lock);
+	pthread_mutex_unlock(&workers->batch_lock);
+	return failed;
+}
+
+void silk_workers_free(Silk_Workers* workers) {
+	if(!workers)
+		return;
+	stop_workers(workers, workers->n_workers);
+	for(size_t i = 0; i < workers->n_workers; ++i)
+		silk_vm_free(workers->workers[i].vm);
+	pthread_cond_destroy(&workers->done);
+	pthread_cond_destroy(&workers->work);
+	pthread_mutex_destroy(&workers->lock);
+	pthread_mutex_destroy(&workers->batch_lock);
+	free(workers->workers);
+	free(workers);
+}
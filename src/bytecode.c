@@ -0,0 +1,78 @@
+#include "bytecode.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+static unsigned operand_width(Instruction* inst) {
+	if(!instruction_has_operand(inst->type))
+		return 0;
+	if(inst->val >= INT8_MIN && inst->val <= INT8_MAX)
+		return 1;
+	if(inst->val >= INT32_MIN && inst->val <= INT32_MAX)
+		return 2;
+	return 3;
+}
+
+int bytecode_pack(PackedCode* packed, Instruction* instructions, size_t inst_size,
+	FunctionInfo* functions, size_t n_functions) {
+	static const uint8_t lengths[4] = { 0, 1, 4, 8 };
+	assert(N_INSTRUCTIONS <= BYTECODE_OPCODE_MASK + 1);
+
+	size_t* offsets = malloc(sizeof(size_t) * (inst_size + 1));
+	if(!offsets)
+		return 1;
+	size_t size = 0;
+	for(size_t i = 0; i < inst_size; ++i) {
+		offsets[i] = size;
+		size += 1 + lengths[operand_width(&instructions[i])];
+	}
+	offsets[inst_size] = size;
+
+	// Trailing INST_EXIT stops execution that runs off the end
+	packed->code = malloc(size + 1 + BYTECODE_PADDING);
+	packed->entries = malloc(sizeof(size_t) * n_functions);
+	if(!packed->code || !packed->entries) {
+		free(packed->code);
+		free(packed->entries);
+		free(offsets);
+		return 1;
+	}
+
+	uint8_t* out = packed->code;
+	for(size_t i = 0; i < inst_size; ++i) {
+		unsigned width = operand_width(&instructions[i]);
+		*out++ = instructions[i].type | width << BYTECODE_WIDTH_SHIFT;
+		uint64_t val = instructions[i].val;
+		for(uint8_t j = 0; j < lengths[width]; ++j)
+			*out++ = val >> (j * 8);
+	}
+	*out++ = INST_EXIT;
+	memset(out, 0, BYTECODE_PADDING);
+	packed->size = size;
+
+	for(size_t i = 0; i < n_functions; ++i) {
+		assert(functions[i].start_addr <= inst_size);
+		packed->entries[i] = offsets[functions[i].start_addr];
+	}
+	packed->n_entries = n_functions;
+
+	free(offsets);
+	return 0;
+}
+
+void bytecode_deinit(PackedCode* packed) {
+	free(packed->code);
+	free(packed->entries);
+	packed->size = 0;
+	packed->n_entries = 0;
+}
+
+void bytecode_print(PackedCode* packed) {
+	for(const uint8_t* pc = packed->code; pc < packed->code + packed->size;) {
+		Instruction inst;
+		inst.type = *pc & BYTECODE_OPCODE_MASK;
+		printf("%6zu: ", (size_t) (pc - packed->code));
+		pc = bytecode_decode(pc, &inst.val);
+		instruction_print(&inst);
+	}
+}
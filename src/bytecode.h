@@ -0,0 +1,42 @@
+#ifndef _BYTECODE_H_
+#define _BYTECODE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "instruction.h"
+
+// Packed encoding: one opcode byte whose top two bits select the operand
+// width (none, 8, 32 or 64 bits), followed by the little-endian operand.
+#define BYTECODE_OPCODE_MASK 0x3f
+#define BYTECODE_WIDTH_SHIFT 6
+// Decoding always reads 8 operand bytes, so the stream is padded
+#define BYTECODE_PADDING 8
+
+typedef struct {
+	uint8_t* code;
+	size_t size;
+	// Byte offset of each FunctionInfo's start_addr
+	size_t* entries;
+	size_t n_entries;
+} PackedCode;
+
+int bytecode_pack(PackedCode* packed, Instruction* instructions, size_t inst_size,
+	FunctionInfo* functions, size_t n_functions);
+void bytecode_deinit(PackedCode* packed);
+void bytecode_print(PackedCode* packed);
+
+static inline const uint8_t* bytecode_decode(const uint8_t* pc, int64_t* val) {
+	static const uint8_t lengths[4] = { 0, 1, 4, 8 };
+	static const uint8_t shifts[4] = { 56, 56, 32, 0 };
+	unsigned width = *pc >> BYTECODE_WIDTH_SHIFT;
+	uint64_t raw;
+	memcpy(&raw, pc + 1, sizeof(raw));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	raw = __builtin_bswap64(raw);
+#endif
+	*val = (int64_t) (raw << shifts[width]) >> shifts[width];
+	return pc + 1 + lengths[width];
+}
+
+#endif
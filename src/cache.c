@@ -0,0 +1,264 @@
+#define _DEFAULT_SOURCE
+#include "cache.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#define CACHE_BYTE_ORDER 0x01020304u
+
+// FNV-1a over 8-byte words, so hashing keeps up with reading the source
+static uint64_t hash_more(uint64_t hash, const char* data, size_t size) {
+	size_t i = 0;
+	for(; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+		uint64_t word;
+		memcpy(&word, data + i, sizeof(word));
+		hash ^= word;
+		hash *= 1099511628211ULL;
+	}
+	for(; i < size; ++i) {
+		hash ^= (uint8_t) data[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+uint64_t cache_hash(const char* data, size_t size) {
+	return hash_more(14695981039346656037ULL, data, size);
+}
+
+#define INSTRUCTION_NAME(inst) #inst ","
+static const char instruction_names[] = FOR_EACH_INSTRUCTION(INSTRUCTION_NAME);
+#undef INSTRUCTION_NAME
+
+static uint64_t cache_version(void) {
+	uint64_t layout[] = { CACHE_FORMAT, CODEGEN_VERSION, sizeof(CacheHeader), sizeof(Instruction),
+		sizeof(FunctionInfo) };
+	uint64_t hash = cache_hash(instruction_names, sizeof(instruction_names) - 1);
+	return hash_more(hash, (const char*) layout, sizeof(layout));
+}
+
+// How many values an instruction reads off the top of the stack
+static int64_t instruction_reads(const Instruction* inst, const FunctionInfo* functions) {
+	switch(inst->type) {
+		case INST_SUM:
+		case INST_SUB:
+		case INST_MUL:
+		case INST_DIV:
+			return 2;
+		case INST_POP:
+		case INST_STORE:
+		case INST_STORE_GLOBAL:
+		case INST_ADD_IMM:
+		case INST_SUB_IMM:
+		case INST_MUL_IMM:
+		case INST_DIV_IMM:
+		case INST_STORE_KEEP:
+		case INST_STORE_GLOBAL_KEEP:
+			return 1;
+		case INST_SWAP:
+			return inst->val + 1;
+		case INST_CALL:
+		case INST_TAILCALL:
+			return functions[inst->val].n_args;
+		default:
+			return 0;
+	}
+}
+
+// The VM takes the compiler's word that operands are in range and that
+// a function never pushes past its max_stack or pops past its own
+// arguments, and only checks at calls. A cache file stands in for the
+// compiler, so what it holds gets checked against the same rules.
+// Functions are in the order of their code, which is how the JIT walks
+// them, and the body of one runs up to where the next one starts. Every
+// body ends in a return and the top level ends in EXIT, with nothing in
+// it that returns, so no run leaves the frames it's been given.
+static int check_code(const Instruction* code, size_t n_instructions,
+	const FunctionInfo* functions, size_t n_functions, size_t source_size) {
+	for(size_t i = 0; i < n_functions; ++i) {
+		const FunctionInfo* fun = &functions[i];
+		size_t end = i + 1 < n_functions ? functions[i + 1].start_addr : n_instructions;
+		// Every argument and local is named somewhere in the source, and
+		// no sizes get near where the checks at calls could overflow
+		if(fun->start_addr >= end || end > n_instructions ||
+			fun->n_locals > source_size || fun->n_args > fun->n_locals ||
+			fun->max_stack > INT32_MAX || (i == 0 && fun->n_args))
+			return 1;
+		InstructionType last = code[end - 1].type;
+		if(i == 0 ? last != INST_EXIT : !instruction_is_return(last))
+			return 1;
+
+		int64_t floor = -(int64_t) fun->n_args;
+		int64_t depth = 0;
+		int64_t max = 0;
+		for(size_t pc = fun->start_addr; pc < end; ++pc) {
+			const Instruction* inst = &code[pc];
+			int64_t val = inst->val;
+			if(i == 0 && instruction_is_return(inst->type))
+				return 1;
+			switch(inst->type) {
+				case INST_SWAP:
+					if(val < 0 || val >= depth - floor)
+						return 1;
+					break;
+				case INST_LOAD:
+				case INST_STORE:
+				case INST_STORE_KEEP:
+					if(val < 0 || (uint64_t) val >= fun->n_locals)
+						return 1;
+					break;
+				case INST_LOAD_GLOBAL:
+				case INST_STORE_GLOBAL:
+				case INST_STORE_GLOBAL_KEEP:
+					if(val < 0 || (uint64_t) val >= functions[0].n_locals)
+						return 1;
+					break;
+				case INST_LOAD_LOAD:
+					if(((uint64_t) val & 0xffff) >= fun->n_locals || ((uint64_t) val >> 16) >= fun->n_locals)
+						return 1;
+					break;
+				case INST_CALL:
+				case INST_TAILCALL:
+					if(val < 0 || (uint64_t) val >= n_functions)
+						return 1;
+					break;
+				default:
+					if((unsigned) inst->type >= N_INSTRUCTIONS)
+						return 1;
+					break;
+			}
+			if(depth - instruction_reads(inst, functions) < floor)
+				return 1;
+			// Same accounting as ast_max_stack
+			if(inst->type == INST_CALL || inst->type == INST_TAILCALL)
+				depth += 1 - (int64_t) functions[val].n_args;
+			else
+				depth += instruction_stack_effect((Instruction*) inst);
+			if(depth > max)
+				max = depth;
+		}
+		if((uint64_t) max > fun->max_stack)
+			return 1;
+	}
+	return 0;
+}
+
+static CacheHeader make_header(uint64_t source_hash, size_t source_size,
+	size_t n_instructions, size_t n_functions) {
+	return (CacheHeader){
+		.magic = CACHE_MAGIC,
+		.version = cache_version(),
+		.instruction_size = sizeof(Instruction),
+		.function_info_size = sizeof(FunctionInfo),
+		.n_instruction_types = N_INSTRUCTIONS,
+		.byte_order = CACHE_BYTE_ORDER,
+		.source_hash = source_hash,
+		.source_size = source_size,
+		.n_instructions = n_instructions,
+		.n_functions = n_functions
+	};
+}
+
+int cache_load(Cache* cache, const char* path, uint64_t source_hash, size_t source_size) {
+	int fd = open(path, O_RDONLY);
+	if(fd == -1)
+		return 1;
+	struct stat st;
+	if(fstat(fd, &st) == -1 || (size_t) st.st_size < sizeof(CacheHeader)) {
+		close(fd);
+		return 1;
+	}
+	void* map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if(map == MAP_FAILED)
+		return 1;
+
+	const CacheHeader* header = map;
+	CacheHeader expected = make_header(source_hash, source_size,
+		header->n_instructions, header->n_functions);
+	size_t size = sizeof(CacheHeader) + sizeof(Instruction) * header->n_instructions +
+		sizeof(FunctionInfo) * header->n_functions;
+	// The counts come from the file, so check them against its size
+	// before anything gets multiplied past it
+	if(header->magic != expected.magic || header->version != expected.version ||
+		header->instruction_size != expected.instruction_size ||
+		header->function_info_size != expected.function_info_size ||
+		header->n_instruction_types != expected.n_instruction_types ||
+		header->byte_order != expected.byte_order ||
+		header->source_hash != source_hash || header->source_size != source_size ||
+		header->n_instructions > (size_t) st.st_size / sizeof(Instruction) ||
+		header->n_functions > (size_t) st.st_size / sizeof(FunctionInfo) ||
+		!header->n_functions || size != (size_t) st.st_size ||
+		check_code((const Instruction*) (header + 1), header->n_instructions,
+			(const FunctionInfo*) ((const Instruction*) (header + 1) + header->n_instructions),
+			header->n_functions, source_size)) {
+		munmap(map, st.st_size);
+		return 1;
+	}
+
+	cache->map = map;
+	cache->map_size = st.st_size;
+	cache->instructions = (Instruction*) (header + 1);
+	cache->n_instructions = header->n_instructions;
+	cache->functions = (FunctionInfo*) (cache->instructions + cache->n_instructions);
+	cache->n_functions = header->n_functions;
+	cache->n_folded = header->n_folded;
+	cache->n_removed = header->n_removed;
+	return 0;
+}
+
+void cache_unload(Cache* cache) {
+	munmap(cache->map, cache->map_size);
+	cache->map = NULL;
+	cache->map_size = 0;
+}
+
+static int write_all(int fd, const void* data, size_t size) {
+	const char* p = data;
+	while(size) {
+		ssize_t written = write(fd, p, size);
+		if(written <= 0)
+			return 1;
+		p += written;
+		size -= written;
+	}
+	return 0;
+}
+
+int cache_save(const char* path, uint64_t source_hash, size_t source_size,
+	Instruction* instructions, size_t n_instructions, FunctionInfo* functions, size_t n_functions,
+	size_t n_folded, size_t n_removed) {
+	// Threads compiling the same script save to the same path at once,
+	// so each writes a file of its own
+	size_t len = strlen(path);
+	char* tmp = malloc(len + sizeof(".XXXXXX"));
+	if(!tmp)
+		return 1;
+	memcpy(tmp, path, len);
+	memcpy(tmp + len, ".XXXXXX", sizeof(".XXXXXX"));
+	int fd = mkstemp(tmp);
+	if(fd == -1) {
+		free(tmp);
+		return 1;
+	}
+	// mkstemp makes it readable by the owner alone
+	fchmod(fd, 0644);
+
+	CacheHeader header = make_header(source_hash, source_size, n_instructions, n_functions);
+	header.n_folded = n_folded;
+	header.n_removed = n_removed;
+	int failed = write_all(fd, &header, sizeof(header)) ||
+		write_all(fd, instructions, sizeof(Instruction) * n_instructions) ||
+		write_all(fd, functions, sizeof(FunctionInfo) * n_functions);
+	failed |= close(fd) == -1;
+	if(!failed)
+		failed = rename(tmp, path) == -1;
+	if(failed)
+		unlink(tmp);
+	free(tmp);
+	return failed;
+}
@@ -0,0 +1,59 @@
+#ifndef _CACHE_H_
+#define _CACHE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "instruction.h"
+
+// Compiled code kept on disk next to a script, in <script>.silkc. The
+// file is a CacheHeader followed by the instructions and the function
+// table as they sit in memory, so a loaded cache is used straight from
+// the mapping. Entry 0 of the table holds the global slot count.
+#define CACHE_MAGIC 0x636b6c6973ULL
+// Bump when the file's own layout changes. The version a cache gets
+// stamped with also hashes in CODEGEN_VERSION, the instruction set and
+// the struct sizes, so caches from another compiler never match.
+#define CACHE_FORMAT 2
+#define CACHE_SUFFIX ".silkc"
+
+typedef struct {
+	uint64_t magic;
+	uint64_t version;
+	// Layout of what follows, which differs between builds and hosts
+	uint16_t instruction_size;
+	uint16_t function_info_size;
+	uint32_t n_instruction_types;
+	uint32_t byte_order;
+	uint64_t source_hash;
+	uint64_t source_size;
+	uint64_t n_instructions;
+	uint64_t n_functions;
+	// What -b reports about the compile that made the cache
+	uint64_t n_folded;
+	uint64_t n_removed;
+} CacheHeader;
+
+typedef struct {
+	void* map;
+	size_t map_size;
+	Instruction* instructions;
+	size_t n_instructions;
+	FunctionInfo* functions;
+	size_t n_functions;
+	size_t n_folded;
+	size_t n_removed;
+} Cache;
+
+uint64_t cache_hash(const char* data, size_t size);
+// Returns nonzero when there's no cache for this source at path, it
+// was made by another version of the compiler or its code isn't
+// something the compiler could have made. Code that's loaded is as safe
+// to run as a fresh compile's.
+int cache_load(Cache* cache, const char* path, uint64_t source_hash, size_t source_size);
+void cache_unload(Cache* cache);
+// Replaces the cache at path in one step, so readers never see half of it
+int cache_save(const char* path, uint64_t source_hash, size_t source_size,
+	Instruction* instructions, size_t n_instructions, FunctionInfo* functions, size_t n_functions,
+	size_t n_folded, size_t n_removed);
+
+#endif
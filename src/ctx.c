@@ -1,11 +1,14 @@
 #include <silk.h>
 #include <string.h>
+#include "vm.h"
 
 int silk_ctx_init(Silk_Ctx* ctx) {
 	memset(ctx, 0, sizeof(Silk_Ctx));
-	return 0;
+	ctx->vm = silk_vm_create();
+	return ctx->vm == NULL;
 }
 
 void silk_ctx_deinit(Silk_Ctx* ctx) {
-	(void) ctx;
+	silk_vm_free(ctx->vm);
+	ctx->vm = NULL;
 }
@@ -0,0 +1,597 @@
+#include "emit.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+// Call or global used ahead of its declaration. The operand is filled in
+// once the whole script has been seen.
+typedef struct {
+	SymbolId id;
+	size_t code_pos;
+	int line;
+	// Set when code_pos is into Emitter::top rather than Emitter::funs
+	char top;
+} BackPatch;
+VECTOR_DEFINE(BackPatch)
+
+// Operator, assignment or call still waiting for operands in emit_expr
+typedef struct {
+	enum {
+		EMIT_BIN_OP,
+		EMIT_ASSIGNMENT,
+		EMIT_CALL
+	} type;
+	InstructionType op;
+	Symbol identifier;
+	int line;
+} EmitFrame;
+VECTOR_DEFINE(EmitFrame)
+
+#ifndef VECTOR_DEFINED_SymbolId
+#define VECTOR_DEFINED_SymbolId
+VECTOR_DEFINE(SymbolId)
+#endif
+
+typedef struct {
+	Parser* parser;
+	Silk_Ctx* ctx;
+	// Binding::scope holds the scope id of the function that declared
+	// `local`, so nothing needs undoing between functions
+	Resolver res;
+	// Top-level code and function bodies are emitted apart and joined at
+	// the end, the way ast_compile lays them out
+	Vector_Instruction top;
+	Vector_Instruction funs;
+	Vector_Instruction* code;
+	// Entry 0 is the top level. Function start addresses are into `funs`
+	// until the code is joined.
+	Vector_FunctionInfo infos;
+	Vector_BackPatch bpatches;
+	Vector_EmitFrame frames;
+	// Symbol declaring each global slot
+	Vector_SymbolId globals;
+	// Every symbol assigned to anywhere, locals included
+	Vector_SymbolId reassigned;
+	// Scope id and table entry of the function being emitted, 0 at the
+	// top level
+	size_t scope;
+	size_t fun;
+	size_t n_vars;
+} Emitter;
+
+// What the folding pass knows while replaying the code
+typedef struct {
+	// By symbol id
+	uint8_t* reassigned;
+	// By global slot
+	uint8_t* is_constant;
+	int64_t* constants;
+	SymbolId* globals;
+	size_t n_folded;
+} Folding;
+
+static inline void emit(Emitter* em, InstructionType type, int64_t val) {
+	vector_aappend(em->code, ((Instruction){ type, val }));
+}
+
+// The symbol table grows as the lexer goes, and the bindings with it
+static Binding* bind(Emitter* em, SymbolId id) {
+	if(id >= em->res.n_bindings && resolver_reserve(&em->res, id + 1))
+		return NULL;
+	return &em->res.bindings[id];
+}
+
+static int undeclared(Emitter* em, int line, SymbolId id) {
+	if(em->ctx->print_errors)
+		printf("%s:%d: error: Undeclared identifier \"" STR_FMT "\"\n",
+			em->ctx->filename, line, STR_ARG(em->parser->lexer->symbols.names[id]));
+	return 1;
+}
+
+static inline int is_local(Emitter* em, Binding* binding) {
+	return em->scope && binding->local >= 0 && binding->scope == em->scope;
+}
+
+// Globals are numbered in order of declaration. Top-level code only sees
+// those declared before it, function bodies see them all.
+static int emit_global(Emitter* em, InstructionType type, SymbolId id, int line) {
+	Binding* binding = &em->res.bindings[id];
+	if(binding->global < 0 && !em->scope)
+		return undeclared(em, line, id);
+	if(binding->global < 0)
+		vector_aappend(&em->bpatches, ((BackPatch){ id, em->code->size, line, 0 }));
+	emit(em, type, binding->global);
+	return 0;
+}
+
+static int emit_lookup(Emitter* em, Symbol identifier, int line) {
+	Binding* binding = bind(em, identifier.id);
+	if(!binding)
+		return 1;
+	if(is_local(em, binding)) {
+		emit(em, INST_LOAD, binding->local);
+		return 0;
+	}
+	return emit_global(em, INST_LOAD_GLOBAL, identifier.id, line);
+}
+
+static int emit_assignment(Emitter* em, Symbol identifier, int line) {
+	Binding* binding = bind(em, identifier.id);
+	if(!binding)
+		return 1;
+	vector_aappend(&em->reassigned, identifier.id);
+	if(is_local(em, binding)) {
+		emit(em, INST_STORE, binding->local);
+		emit(em, INST_LOAD, binding->local);
+		return 0;
+	}
+	return emit_global(em, INST_STORE_GLOBAL, identifier.id, line) ||
+		emit_global(em, INST_LOAD_GLOBAL, identifier.id, line);
+}
+
+static int emit_call(Emitter* em, Symbol identifier, int line) {
+	Binding* binding = bind(em, identifier.id);
+	if(!binding)
+		return 1;
+	if(binding->function < 0)
+		vector_aappend(&em->bpatches, ((BackPatch){ identifier.id, em->code->size, line, em->code == &em->top }));
+	emit(em, INST_CALL, binding->function + 1);
+	return 0;
+}
+
+// INST_EXIT for anything that isn't a binary operator
+static InstructionType token_to_instruction(TokenType type) {
+	switch(type) {
+		case TOKEN_PLUS: return INST_SUM;
+		case TOKEN_MINUS: return INST_SUB;
+		case TOKEN_ASTERISK: return INST_MUL;
+		case TOKEN_SLASH: return INST_DIV;
+		default: return INST_EXIT;
+	}
+}
+
+static inline int precedence(InstructionType op) {
+	return op == INST_MUL || op == INST_DIV ? 2 : 1;
+}
+
+static void reduce(Emitter* em, size_t frames_base, int min_precedence) {
+	while(em->frames.size > frames_base) {
+		EmitFrame* top = &em->frames.data[em->frames.size - 1];
+		if(top->type != EMIT_BIN_OP || precedence(top->op) < min_precedence)
+			return;
+		emit(em, top->op, 0);
+		--em->frames.size;
+	}
+}
+
+// Same grammar and errors as parse_expr. Operands are emitted as soon as
+// they're read and operators once both of theirs are, which is the order
+// compile_recur walks the tree in.
+static int emit_expr(Emitter* em) {
+	Parser* parser = em->parser;
+	size_t frames_base = em->frames.size;
+	int want_operand = 1;
+	for(;;) {
+		if(want_operand) {
+			int line = parser->tok.line;
+			TokenType type = parser->tok.type;
+			int64_t num = parser->tok.num;
+			Symbol sym = { parser->tok.str, parser->tok.sym };
+			if(
+				parser_expect_silent(parser, TOKEN_IDENTIFIER) &&
+				parser_expect_silent(parser, TOKEN_INT_LITERAL) &&
+				parser_expect(parser, TOKEN_STR_LITERAL)
+			)
+				goto fail;
+
+			if(type == TOKEN_IDENTIFIER && parser->tok.type == TOKEN_BRACKET_OPEN) {
+				if(parser_advance(parser))
+					goto fail;
+				vector_aappend(&em->frames, ((EmitFrame){ EMIT_CALL, INST_CALL, sym, line }));
+				want_operand = parser->tok.type != TOKEN_BRACKET_CLOSE;
+				continue;
+			}
+			if(type == TOKEN_IDENTIFIER && parser->tok.type == TOKEN_EQ_SIGN) {
+				if(parser_advance(parser))
+					goto fail;
+				vector_aappend(&em->frames, ((EmitFrame){ EMIT_ASSIGNMENT, INST_STORE, sym, line }));
+				continue;
+			}
+
+			if(type == TOKEN_IDENTIFIER) {
+				if(emit_lookup(em, sym, line))
+					goto fail;
+			}
+			else if(type == TOKEN_INT_LITERAL)
+				emit(em, INST_PUSH, num);
+			else {
+				// There's no instruction to compile one to
+				if(em->ctx->print_errors)
+					printf("%s:%d: error: String literals are not supported\n", em->ctx->filename, line);
+				goto fail;
+			}
+			want_operand = 0;
+			continue;
+		}
+
+		InstructionType op = token_to_instruction(parser->tok.type);
+		if(op != INST_EXIT) {
+			reduce(em, frames_base, precedence(op));
+			vector_aappend(&em->frames, ((EmitFrame){ .type = EMIT_BIN_OP, .op = op }));
+			if(parser_advance(parser))
+				goto fail;
+			want_operand = 1;
+			continue;
+		}
+
+		reduce(em, frames_base, 0);
+		if(em->frames.size == frames_base)
+			break;
+		EmitFrame frame = em->frames.data[em->frames.size - 1];
+		if(frame.type == EMIT_ASSIGNMENT) {
+			--em->frames.size;
+			if(emit_assignment(em, frame.identifier, frame.line))
+				goto fail;
+			continue;
+		}
+
+		assert(frame.type == EMIT_CALL);
+		if(parser->tok.type == TOKEN_COMMA && parser_advance(parser))
+			goto fail;
+		if(parser->tok.type != TOKEN_BRACKET_CLOSE) {
+			want_operand = 1;
+			continue;
+		}
+		if(parser_advance(parser))
+			goto fail;
+		--em->frames.size;
+		if(emit_call(em, frame.identifier, frame.line))
+			goto fail;
+	}
+	return 0;
+
+fail:
+	em->frames.size = frames_base;
+	return 1;
+}
+
+static int emit_return(Emitter* em) {
+	Parser* parser = em->parser;
+	if(parser_advance(parser))
+		return 1;
+
+	if(!parser_expect_silent(parser, TOKEN_SEMICOLON)) {
+		emit(em, INST_RET, 0);
+		return 0;
+	}
+
+	if(emit_expr(em))
+		return 1;
+	// A call in tail position reuses the current frame. An expression
+	// ends in INST_CALL only when the call is all there is to it.
+	Instruction* last = &em->code->data[em->code->size - 1];
+	if(last->type == INST_CALL)
+		last->type = INST_TAILCALL;
+	else
+		emit(em, INST_RET, 0);
+
+	return parser_expect(parser, TOKEN_SEMICOLON);
+}
+
+static int emit_var(Emitter* em) {
+	Parser* parser = em->parser;
+	if(parser_advance(parser))
+		return 1;
+
+	Symbol identifier = { parser->tok.str, parser->tok.sym };
+	if(parser_expect(parser, TOKEN_IDENTIFIER))
+		return 1;
+
+	if(parser_expect(parser, TOKEN_EQ_SIGN))
+		return 1;
+
+	// Redeclarations fail without a message, like they do in ast_compile
+	Binding* binding = bind(em, identifier.id);
+	if(!binding || (em->scope ? is_local(em, binding) : binding->global >= 0))
+		return 1;
+
+	if(emit_expr(em))
+		return 1;
+
+	binding = &em->res.bindings[identifier.id];
+	if(!em->scope) {
+		binding->global = em->globals.size;
+		vector_aappend(&em->globals, identifier.id);
+		emit(em, INST_STORE_GLOBAL, binding->global);
+		return 0;
+	}
+
+	int64_t index = em->n_vars++;
+	binding->local = index;
+	binding->scope = em->scope;
+	FunctionInfo* fun = &em->infos.data[em->fun];
+	if((size_t) index >= fun->n_locals)
+		fun->n_locals = index + 1;
+	emit(em, INST_STORE, index);
+	return 0;
+}
+
+static int emit_body(Emitter* em) {
+	Parser* parser = em->parser;
+	if(parser_expect(parser, TOKEN_CURLY_OPEN))
+		return 1;
+
+	for(;;) {
+		int failed;
+		switch(parser->tok.type) {
+			case TOKEN_RETURN:
+				failed = emit_return(em);
+				break;
+			case TOKEN_CURLY_CLOSE:
+				return parser_advance(parser);
+			case TOKEN_IDENTIFIER:
+			case TOKEN_INT_LITERAL:
+			case TOKEN_STR_LITERAL:
+				failed = emit_expr(em);
+				break;
+			case TOKEN_VAR:
+				failed = emit_var(em);
+				break;
+			case TOKEN_SEMICOLON:
+				if(parser_advance(parser))
+					return 1;
+				continue;
+			case TOKEN_EOF:
+				parser_unexpected(parser, TOKEN_CURLY_CLOSE);
+				return 1;
+			default:
+				parser_invalid(parser);
+				return 1;
+		}
+		if(failed)
+			return 1;
+	}
+}
+
+static int emit_function(Emitter* em) {
+	Parser* parser = em->parser;
+	if(parser_advance(parser))
+		return 1;
+
+	Symbol identifier = { parser->tok.str, parser->tok.sym };
+	if(parser_expect(parser, TOKEN_IDENTIFIER))
+		return 1;
+
+	if(parser_expect(parser, TOKEN_BRACKET_OPEN))
+		return 1;
+
+	// Functions are numbered in order of definition and calls go to the
+	// first definition of a name
+	Binding* binding = bind(em, identifier.id);
+	if(!binding)
+		return 1;
+	if(binding->function < 0)
+		binding->function = em->res.n_functions;
+	++em->res.n_functions;
+
+	em->fun = em->infos.size;
+	vector_aappend(&em->infos, ((FunctionInfo){ em->funs.size, 0, 0, 0 }));
+	em->scope = ++em->res.n_scopes;
+	em->code = &em->funs;
+
+	// Arguments share a scope with the body's declarations
+	size_t n_args = 0;
+	while(parser->tok.type != TOKEN_BRACKET_CLOSE) {
+		Symbol arg = { parser->tok.str, parser->tok.sym };
+		if(parser_expect(parser, TOKEN_IDENTIFIER))
+			return 1;
+
+		// The first of several same-named arguments wins
+		Binding* arg_binding = bind(em, arg.id);
+		if(!arg_binding)
+			return 1;
+		if(!is_local(em, arg_binding)) {
+			arg_binding->local = n_args;
+			arg_binding->scope = em->scope;
+		}
+		emit(em, INST_STORE, n_args++);
+
+		if(parser->tok.type == TOKEN_COMMA)
+			parser_expect(parser, TOKEN_COMMA);
+	}
+
+	if(parser_expect(parser, TOKEN_BRACKET_CLOSE))
+		return 1;
+
+	em->infos.data[em->fun].n_args = n_args;
+	em->infos.data[em->fun].n_locals = n_args;
+	em->n_vars = n_args;
+	if(emit_body(em))
+		return 1;
+	// Same implicit return as the tree walk adds
+	size_t start = em->infos.data[em->fun].start_addr;
+	if(em->funs.size == start || !instruction_is_return(em->funs.data[em->funs.size - 1].type)) {
+		emit(em, INST_PUSH, 0);
+		emit(em, INST_RET, 0);
+	}
+
+	em->scope = 0;
+	em->fun = 0;
+	em->code = &em->top;
+	return 0;
+}
+
+static int back_patch(Emitter* em, char top) {
+	for(size_t i = 0; i < em->bpatches.size; ++i) {
+		BackPatch* bpatch = &em->bpatches.data[i];
+		if(bpatch->top != top)
+			continue;
+		Instruction* inst = &(top ? &em->top : &em->funs)->data[bpatch->code_pos];
+		Binding* binding = &em->res.bindings[bpatch->id];
+		int is_call = inst->type == INST_CALL || inst->type == INST_TAILCALL;
+		int64_t val = is_call ? binding->function : binding->global;
+		if(val < 0)
+			return undeclared(em, bpatch->line, bpatch->id);
+		inst->val = is_call ? val + 1 : val;
+	}
+	return 0;
+}
+
+// Appends one instruction, folding it into what's already there the
+// way ast_fold_constants folds the tree. The operands of an operator are
+// the code right before it, so two pushes there are its operands.
+static void fold_append(Vector_Instruction* out, size_t floor, Instruction inst, Folding* folding) {
+	if(!folding->is_constant) {
+		vector_aappend(out, inst);
+		return;
+	}
+	Instruction* last = out->size > floor ? &out->data[out->size - 1] : NULL;
+	int64_t num;
+	switch(inst.type) {
+		case INST_LOAD_GLOBAL:
+			if(!folding->is_constant[inst.val])
+				break;
+			inst = (Instruction){ INST_PUSH, folding->constants[inst.val] };
+			++folding->n_folded;
+			break;
+		case INST_STORE_GLOBAL:
+			// A global nothing assigns to is only stored to by its
+			// declaration
+			if(last && last->type == INST_PUSH && !folding->reassigned[folding->globals[inst.val]] &&
+				!folding->is_constant[inst.val]) {
+				folding->is_constant[inst.val] = 1;
+				folding->constants[inst.val] = last->val;
+			}
+			break;
+		case INST_SUM:
+		case INST_SUB:
+		case INST_MUL:
+		case INST_DIV:
+			if(out->size < floor + 2 || last->type != INST_PUSH || last[-1].type != INST_PUSH ||
+				!instruction_fold(inst.type, last[-1].val, last->val, &num))
+				break;
+			--out->size;
+			out->data[out->size - 1].val = num;
+			++folding->n_folded;
+			return;
+		default:
+			break;
+	}
+	vector_aappend(out, inst);
+}
+
+// Lays out the top level, then INST_EXIT, then each function, folding as
+// it goes. The top level comes first, so function bodies see every
+// constant global.
+static size_t join(Emitter* em, Vector_Instruction* out, Vector_FunctionInfo* infos) {
+	size_t n_symbols = em->parser->lexer->symbols.size;
+	size_t n_globals = em->globals.size;
+	Folding folding = {
+		.reassigned = calloc(n_symbols + 1, sizeof(uint8_t)),
+		.is_constant = calloc(n_globals + 1, sizeof(uint8_t)),
+		.constants = malloc(sizeof(int64_t) * (n_globals + 1)),
+		.globals = em->globals.data,
+		.n_folded = 0
+	};
+	// Folding is only an optimization, the code runs all the same without
+	if(!folding.reassigned || !folding.constants) {
+		free(folding.is_constant);
+		folding.is_constant = NULL;
+	}
+	else
+		for(size_t i = 0; i < em->reassigned.size; ++i)
+			folding.reassigned[em->reassigned.data[i]] = 1;
+
+	for(size_t i = 0; i < em->top.size; ++i)
+		fold_append(out, 0, em->top.data[i], &folding);
+	vector_aappend(out, ((Instruction){ INST_EXIT, 0 }));
+
+	// Entry 0 describes the top level, whose frame holds the globals
+	vector_aappend(infos, ((FunctionInfo){ 0, 0, n_globals, 0 }));
+	for(size_t i = 1; i < em->infos.size; ++i) {
+		FunctionInfo info = em->infos.data[i];
+		size_t end = i + 1 < em->infos.size ? em->infos.data[i + 1].start_addr : em->funs.size;
+		size_t begin = info.start_addr;
+		info.start_addr = out->size;
+		for(size_t j = begin; j < end; ++j)
+			fold_append(out, info.start_addr, em->funs.data[j], &folding);
+		vector_aappend(infos, info);
+	}
+	for(size_t i = 0; i < infos->size; ++i) {
+		size_t end = i + 1 < infos->size ? infos->data[i + 1].start_addr : out->size;
+		infos->data[i].max_stack = ast_max_stack(out->data, infos->data[i].start_addr, end, infos->data);
+	}
+
+	free(folding.reassigned);
+	free(folding.is_constant);
+	free(folding.constants);
+	return folding.n_folded;
+}
+
+int emit_program(Parser* parser, Vector_Instruction* instructions, Vector_FunctionInfo* infos,
+	size_t* n_folded) {
+	Emitter em = {
+		.parser = parser,
+		.ctx = parser->lexer->ctx
+	};
+	if(resolver_init(&em.res, 256, 0))
+		return 1;
+	vector_Instruction_ainit(&em.top, 64);
+	vector_Instruction_ainit(&em.funs, 64);
+	vector_FunctionInfo_ainit(&em.infos, 16);
+	vector_BackPatch_ainit(&em.bpatches, 16);
+	vector_EmitFrame_ainit(&em.frames, 16);
+	vector_SymbolId_ainit(&em.globals, 64);
+	vector_SymbolId_ainit(&em.reassigned, 16);
+	em.code = &em.top;
+	vector_aappend(&em.infos, ((FunctionInfo){ 0, 0, 0, 0 }));
+
+	int ret = 1;
+	if(parser_advance(parser))
+		goto quit;
+
+	while(parser->tok.type != TOKEN_EOF) {
+		int failed;
+		switch(parser->tok.type) {
+			case TOKEN_IDENTIFIER:
+			case TOKEN_INT_LITERAL:
+			case TOKEN_STR_LITERAL:
+				failed = emit_expr(&em);
+				break;
+			case TOKEN_SEMICOLON:
+				if(parser_advance(parser))
+					goto quit;
+				continue;
+			case TOKEN_FUNCTION:
+				failed = emit_function(&em);
+				break;
+			case TOKEN_VAR:
+				failed = emit_var(&em);
+				break;
+			default:
+				parser_invalid(parser);
+				goto quit;
+		}
+		if(failed)
+			goto quit;
+	}
+
+	// ast_compile goes through the top level first, so its errors come
+	// first here too
+	if(back_patch(&em, 1) || back_patch(&em, 0))
+		goto quit;
+
+	*n_folded = join(&em, instructions, infos);
+	ret = 0;
+
+quit:
+	resolver_deinit(&em.res);
+	vector_deinit(&em.top);
+	vector_deinit(&em.funs);
+	vector_deinit(&em.infos);
+	vector_deinit(&em.bpatches);
+	vector_deinit(&em.frames);
+	vector_deinit(&em.globals);
+	vector_deinit(&em.reassigned);
+	return ret;
+}
@@ -0,0 +1,14 @@
+#ifndef _EMIT_H_
+#define _EMIT_H_
+
+#include "parser.h"
+
+// Single-pass front end: follows the grammar on the parser's token
+// stream and emits instructions as it goes, without building a tree.
+// Produces the same code and function table as parser_parse,
+// ast_fold_constants and ast_compile do together. n_folded gets the
+// number of folds, counted the way ast_fold_constants counts them.
+int emit_program(Parser* parser, Vector_Instruction* instructions, Vector_FunctionInfo* infos,
+	size_t* n_folded);
+
+#endif
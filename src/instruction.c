@@ -10,19 +10,94 @@ FOR_EACH_INSTRUCTION(ENUMERATOR)
 	}
 }
 
-void instruction_print(Instruction* inst) {
-	printf("%s ", instruction_type_to_str(inst->type));
-	switch(inst->type) {
+int instruction_is_return(InstructionType type) {
+	return type == INST_RET || type == INST_TAILCALL;
+}
+
+int instruction_has_operand(InstructionType type) {
+	switch(type) {
 		case INST_PUSH:
 		case INST_SWAP:
 		case INST_CALL:
+		case INST_TAILCALL:
 		case INST_LOAD:
 		case INST_STORE:
 		case INST_LOAD_GLOBAL:
 		case INST_STORE_GLOBAL:
-			printf("%ld", inst->val);
+		case INST_ADD_IMM:
+		case INST_SUB_IMM:
+		case INST_MUL_IMM:
+		case INST_DIV_IMM:
+		case INST_STORE_KEEP:
+		case INST_STORE_GLOBAL_KEEP:
+		case INST_LOAD_LOAD:
+			return 1;
 		default:
-			break;
+			return 0;
 	}
+}
+
+void instruction_print(Instruction* inst) {
+	printf("%s ", instruction_type_to_str(inst->type));
+	if(inst->type == INST_LOAD_LOAD)
+		printf("%lu, %lu", (uint64_t) inst->val & 0xffff, (uint64_t) inst->val >> 16);
+	else if(instruction_has_operand(inst->type))
+		printf("%ld", inst->val);
 	putchar('\n');
 }
+
+// Net operand stack change. INST_CALL and INST_TAILCALL depend on the
+// callee's argument count and are left to the caller.
+int instruction_stack_effect(Instruction* inst) {
+	switch(inst->type) {
+		case INST_LOAD_LOAD:
+			return 2;
+		case INST_PUSH:
+		case INST_LOAD:
+		case INST_LOAD_GLOBAL:
+			return 1;
+		case INST_POP:
+		case INST_STORE:
+		case INST_STORE_GLOBAL:
+		case INST_SUM:
+		case INST_SUB:
+		case INST_MUL:
+		case INST_DIV:
+			return -1;
+		default:
+			return 0;
+	}
+}
+
+// Evaluates a SUM, SUB, MUL or DIV of two constants, wrapping like the
+// VM's two's complement arithmetic does. Returns 0 for a division that
+// would fault, which is left for the VM to trip over at runtime.
+int instruction_fold(InstructionType type, int64_t lhs, int64_t rhs, int64_t* result) {
+	switch(type) {
+		case INST_SUM:
+			*result = (int64_t) ((uint64_t) lhs + (uint64_t) rhs);
+			return 1;
+		case INST_SUB:
+			*result = (int64_t) ((uint64_t) lhs - (uint64_t) rhs);
+			return 1;
+		case INST_MUL:
+			*result = (int64_t) ((uint64_t) lhs * (uint64_t) rhs);
+			return 1;
+		case INST_DIV:
+			if(rhs == 0 || (lhs == INT64_MIN && rhs == -1))
+				return 0;
+			*result = lhs / rhs;
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+void function_info_print(FunctionInfo* info) {
+	if(info->start_addr == FUNCTION_UNCOMPILED) {
+		printf("uncompiled, args %zu\n", info->n_args);
+		return;
+	}
+	printf("start %zu, args %zu, locals %zu, stack %zu\n", info->start_addr,
+		info->n_args, info->n_locals, info->max_stack);
+}
@@ -2,6 +2,7 @@
 #define _INSTRUCTION_H_
 
 #include <stdint.h>
+#include <stddef.h>
 
 #define FOR_EACH_INSTRUCTION(_) \
 	_(INST_PUSH) \
@@ -13,11 +14,19 @@
 	_(INST_STORE_GLOBAL) \
 	_(INST_EXIT) \
 	_(INST_CALL) \
+	_(INST_TAILCALL) \
 	_(INST_RET) \
 	_(INST_SUM) \
 	_(INST_SUB) \
 	_(INST_MUL) \
-	_(INST_DIV)
+	_(INST_DIV) \
+	_(INST_ADD_IMM) \
+	_(INST_SUB_IMM) \
+	_(INST_MUL_IMM) \
+	_(INST_DIV_IMM) \
+	_(INST_STORE_KEEP) \
+	_(INST_STORE_GLOBAL_KEEP) \
+	_(INST_LOAD_LOAD)
 
 typedef enum {
 #define ENUMERATOR(inst) inst,
@@ -25,12 +34,41 @@ FOR_EACH_INSTRUCTION(ENUMERATOR)
 #undef ENUMERATOR
 } InstructionType;
 
+enum {
+#define COUNT(inst) + 1
+	N_INSTRUCTIONS = 0 FOR_EACH_INSTRUCTION(COUNT)
+#undef COUNT
+};
+
+// Bump whenever the compiler, the constant folder or the optimizer
+// change the code a script compiles to. Bytecode caches are keyed on it,
+// so none made by the old compiler get run.
+#define CODEGEN_VERSION 1
+
 typedef struct {
 	InstructionType type;
 	int64_t val;
 } Instruction;
 
+// Per-function data the compiler hands to the VM. Entry 0 is the top
+// level, INST_CALL operands index into the table.
+typedef struct {
+	// FUNCTION_UNCOMPILED until the function has code
+	size_t start_addr;
+	size_t n_args;
+	size_t n_locals;
+	size_t max_stack;
+} FunctionInfo;
+
+#define FUNCTION_UNCOMPILED SIZE_MAX
+
 const char* instruction_type_to_str(InstructionType type);
+int instruction_has_operand(InstructionType type);
+// RET and TAILCALL, the instructions that leave a function
+int instruction_is_return(InstructionType type);
 void instruction_print(Instruction* inst);
+int instruction_stack_effect(Instruction* inst);
+int instruction_fold(InstructionType type, int64_t lhs, int64_t rhs, int64_t* result);
+void function_info_print(FunctionInfo* info);
 
 #endif
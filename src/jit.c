@@ -0,0 +1,422 @@
+#define _DEFAULT_SOURCE
+#include "jit.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <sys/mman.h>
+#include "vector.h"
+
+// State shared between jit_run and the generated code, addressed
+// through r14
+typedef struct {
+	int64_t* sp;
+	int64_t* locals;
+	int64_t* stack_end;
+	int64_t* slots_end;
+	size_t frames;
+	void* saved_rsp;
+	// Top of the VM's machine stack, which the code switches to. Every
+	// call level takes two words of it.
+	void* native_stack;
+} JitState;
+
+#if defined(__x86_64__)
+
+// Register assignment in the generated code:
+//   rbx  operand stack pointer (next free slot)
+//   r12  current frame's locals
+//   r13  globals, i.e. the top-level frame's locals
+//   r14  JitState*
+//   r15  call frames left
+//   rsp  the VM's native stack, with the caller's kept in saved_rsp
+// The operand stack itself stays in the VM's memory, so the state after
+// a run is exactly what vm_run would leave behind.
+enum {
+	RAX = 0, RCX = 1, RDX = 2, RBX = 3, RSP = 4,
+	R12 = 12, R13 = 13, R14 = 14, R15 = 15
+};
+
+#define JMP 0xe9
+#define JZ 0x84
+#define JA 0x87
+
+typedef struct {
+	uint8_t* data;
+	size_t size;
+	size_t capacity;
+	int failed;
+} JitBuffer;
+
+typedef struct {
+	size_t pos;
+	size_t function;
+} JitFixup;
+VECTOR_DEFINE(JitFixup)
+
+static void emit(JitBuffer* buf, uint8_t byte) {
+	if(buf->failed)
+		return;
+	if(buf->size >= buf->capacity) {
+		size_t capacity = buf->capacity ? buf->capacity * 2 : 4096;
+		uint8_t* data = realloc(buf->data, capacity);
+		if(!data) {
+			buf->failed = 1;
+			return;
+		}
+		buf->data = data;
+		buf->capacity = capacity;
+	}
+	buf->data[buf->size++] = byte;
+}
+
+static void emit_bytes(JitBuffer* buf, const char* bytes, size_t len) {
+	for(size_t i = 0; i < len; ++i)
+		emit(buf, bytes[i]);
+}
+#define EMIT(buf, bytes) emit_bytes(buf, bytes, sizeof(bytes) - 1)
+
+static void emit32(JitBuffer* buf, uint32_t val) {
+	for(int i = 0; i < 4; ++i)
+		emit(buf, val >> (i * 8));
+}
+
+static void emit64(JitBuffer* buf, uint64_t val) {
+	for(int i = 0; i < 8; ++i)
+		emit(buf, val >> (i * 8));
+}
+
+static void patch32(JitBuffer* buf, size_t pos, uint32_t val) {
+	if(buf->failed)
+		return;
+	for(int i = 0; i < 4; ++i)
+		buf->data[pos + i] = val >> (i * 8);
+}
+
+// <opcode> reg, [base + disp32] with REX.W. `reg` doubles as the /digit
+// opcode extension.
+static void emit_rm(JitBuffer* buf, uint8_t opcode, int reg, int base, int32_t disp) {
+	emit(buf, 0x48 | (reg & 8 ? 4 : 0) | (base & 8 ? 1 : 0));
+	emit(buf, opcode);
+	emit(buf, 0x80 | (reg & 7) << 3 | (base & 7));
+	if((base & 7) == RSP)
+		emit(buf, 0x24);
+	emit32(buf, disp);
+}
+
+static void emit_jump(JitBuffer* buf, uint8_t opcode, size_t target) {
+	if(opcode != JMP)
+		emit(buf, 0x0f);
+	emit(buf, opcode);
+	emit32(buf, target - (buf->size + 4));
+}
+
+static int fits_imm32(int64_t val) {
+	return val >= INT32_MIN && val <= INT32_MAX;
+}
+
+// mov rcx, imm64
+static void emit_load_rcx(JitBuffer* buf, int64_t val) {
+	EMIT(buf, "\x48\xb9");
+	emit64(buf, val);
+}
+
+static void emit_push_rax(JitBuffer* buf) {
+	emit_rm(buf, 0x89, RAX, RBX, 0);
+	EMIT(buf, "\x48\x83\xc3\x08"); // add rbx, 8
+}
+
+static void emit_pop_rax(JitBuffer* buf) {
+	EMIT(buf, "\x48\x83\xeb\x08"); // sub rbx, 8
+	emit_rm(buf, 0x8b, RAX, RBX, 0);
+}
+
+// Bails to `error` unless the callee's locals, placed `locals_offset`
+// slots past r12, and its operand stack use fit
+static void emit_call_checks(JitBuffer* buf, FunctionInfo* callee, size_t locals_offset,
+	size_t error) {
+	emit_rm(buf, 0x8d, RAX, R12, (locals_offset + callee->n_locals) * 8);
+	emit_rm(buf, 0x3b, RAX, R14, offsetof(JitState, slots_end));
+	emit_jump(buf, JA, error);
+	emit_rm(buf, 0x8d, RAX, RBX, callee->max_stack * 8);
+	emit_rm(buf, 0x3b, RAX, R14, offsetof(JitState, stack_end));
+	emit_jump(buf, JA, error);
+}
+
+static int compile_instruction(JitBuffer* buf, Vector_JitFixup* fixups, Instruction* inst,
+	FunctionInfo* fun, FunctionInfo* functions, size_t n_functions, size_t error_pos, size_t exit_pos) {
+	int64_t val = inst->val;
+	switch(inst->type) {
+		case INST_PUSH:
+			if(fits_imm32(val)) {
+				emit_rm(buf, 0xc7, 0, RBX, 0);
+				emit32(buf, val);
+				EMIT(buf, "\x48\x83\xc3\x08"); // add rbx, 8
+			}
+			else {
+				EMIT(buf, "\x48\xb8"); // mov rax, imm64
+				emit64(buf, val);
+				emit_push_rax(buf);
+			}
+			break;
+		case INST_POP:
+			EMIT(buf, "\x48\x83\xeb\x08"); // sub rbx, 8
+			break;
+		case INST_SWAP:
+			emit_rm(buf, 0x8b, RAX, RBX, -8);
+			emit_rm(buf, 0x8b, RCX, RBX, -8 - val * 8);
+			emit_rm(buf, 0x89, RCX, RBX, -8);
+			emit_rm(buf, 0x89, RAX, RBX, -8 - val * 8);
+			break;
+		case INST_LOAD:
+		case INST_LOAD_GLOBAL:
+			emit_rm(buf, 0x8b, RAX, inst->type == INST_LOAD ? R12 : R13, val * 8);
+			emit_push_rax(buf);
+			break;
+		case INST_STORE:
+		case INST_STORE_GLOBAL:
+			emit_pop_rax(buf);
+			emit_rm(buf, 0x89, RAX, inst->type == INST_STORE ? R12 : R13, val * 8);
+			break;
+		case INST_STORE_KEEP:
+		case INST_STORE_GLOBAL_KEEP:
+			emit_rm(buf, 0x8b, RAX, RBX, -8);
+			emit_rm(buf, 0x89, RAX, inst->type == INST_STORE_KEEP ? R12 : R13, val * 8);
+			break;
+		case INST_LOAD_LOAD:
+			emit_rm(buf, 0x8b, RAX, R12, ((uint64_t) val & 0xffff) * 8);
+			emit_rm(buf, 0x89, RAX, RBX, 0);
+			emit_rm(buf, 0x8b, RAX, R12, ((uint64_t) val >> 16) * 8);
+			emit_rm(buf, 0x89, RAX, RBX, 8);
+			EMIT(buf, "\x48\x83\xc3\x10"); // add rbx, 16
+			break;
+		case INST_EXIT:
+			emit_jump(buf, JMP, exit_pos);
+			break;
+		case INST_CALL:
+			if((size_t) val >= n_functions)
+				return 1;
+			EMIT(buf, "\x49\xff\xcf"); // dec r15
+			emit_jump(buf, JZ, error_pos);
+			emit_call_checks(buf, &functions[val], fun->n_locals, error_pos);
+			EMIT(buf, "\x41\x54"); // push r12
+			emit_rm(buf, 0x8d, R12, R12, fun->n_locals * 8);
+			emit(buf, 0xe8); // call rel32
+			vector_aappend(fixups, ((JitFixup){ buf->size, val }));
+			emit32(buf, 0);
+			EMIT(buf, "\x41\x5c"); // pop r12
+			EMIT(buf, "\x49\xff\xc7"); // inc r15
+			break;
+		case INST_TAILCALL:
+			// The callee takes over this frame and the native return address
+			if((size_t) val >= n_functions)
+				return 1;
+			emit_call_checks(buf, &functions[val], 0, error_pos);
+			emit(buf, JMP);
+			vector_aappend(fixups, ((JitFixup){ buf->size, val }));
+			emit32(buf, 0);
+			break;
+		case INST_RET:
+			emit(buf, 0xc3);
+			break;
+		case INST_SUM:
+		case INST_SUB:
+			emit_pop_rax(buf);
+			emit_rm(buf, inst->type == INST_SUM ? 0x01 : 0x29, RAX, RBX, -8);
+			break;
+		case INST_MUL:
+			emit_pop_rax(buf);
+			EMIT(buf, "\x48\x0f\xaf"); // imul rax, [rbx - 8]
+			emit(buf, 0x83);
+			emit32(buf, -8);
+			emit_rm(buf, 0x89, RAX, RBX, -8);
+			break;
+		case INST_DIV:
+			EMIT(buf, "\x48\x83\xeb\x08"); // sub rbx, 8
+			emit_rm(buf, 0x8b, RAX, RBX, -8);
+			EMIT(buf, "\x48\x99"); // cqo
+			emit_rm(buf, 0xf7, 7, RBX, 0); // idiv qword [rbx]
+			emit_rm(buf, 0x89, RAX, RBX, -8);
+			break;
+		case INST_ADD_IMM:
+		case INST_SUB_IMM:
+			if(fits_imm32(val)) {
+				emit_rm(buf, 0x81, inst->type == INST_ADD_IMM ? 0 : 5, RBX, -8);
+				emit32(buf, val);
+			}
+			else {
+				emit_load_rcx(buf, val);
+				emit_rm(buf, inst->type == INST_ADD_IMM ? 0x01 : 0x29, RCX, RBX, -8);
+			}
+			break;
+		case INST_MUL_IMM:
+			if(fits_imm32(val)) {
+				emit_rm(buf, 0x69, RAX, RBX, -8); // imul rax, [rbx - 8], imm32
+				emit32(buf, val);
+			}
+			else {
+				emit_load_rcx(buf, val);
+				emit_rm(buf, 0x8b, RAX, RBX, -8);
+				EMIT(buf, "\x48\x0f\xaf\xc1"); // imul rax, rcx
+			}
+			emit_rm(buf, 0x89, RAX, RBX, -8);
+			break;
+		case INST_DIV_IMM:
+			emit_load_rcx(buf, val);
+			emit_rm(buf, 0x8b, RAX, RBX, -8);
+			EMIT(buf, "\x48\x99"); // cqo
+			EMIT(buf, "\x48\xf7\xf9"); // idiv rcx
+			emit_rm(buf, 0x89, RAX, RBX, -8);
+			break;
+		default:
+			return 1;
+	}
+	return 0;
+}
+
+// Slot and stack displacements must fit in disp32
+#define JIT_MAX_SLOT (INT32_MAX / 16)
+
+static int operand_fits(Instruction* inst) {
+	switch(inst->type) {
+		case INST_SWAP:
+		case INST_LOAD:
+		case INST_STORE:
+		case INST_LOAD_GLOBAL:
+		case INST_STORE_GLOBAL:
+		case INST_STORE_KEEP:
+		case INST_STORE_GLOBAL_KEEP:
+			return inst->val >= 0 && inst->val < JIT_MAX_SLOT;
+		default:
+			return 1;
+	}
+}
+
+int jit_compile(JitCode* jit, Instruction* instructions, size_t inst_size,
+	FunctionInfo* functions, size_t n_functions) {
+	int ret = 1;
+	JitBuffer buf = { 0 };
+	Vector_JitFixup fixups;
+	vector_JitFixup_ainit(&fixups, 64);
+	size_t* offsets = malloc(sizeof(size_t) * (inst_size + 1));
+	if(!offsets)
+		goto quit;
+	for(size_t i = 0; i < n_functions; ++i)
+		if(functions[i].n_locals >= JIT_MAX_SLOT || functions[i].max_stack >= JIT_MAX_SLOT)
+			goto quit;
+
+	// Shared exits first, so every jump to them is a known backward jump
+	size_t error_pos = buf.size;
+	emit_rm(&buf, 0x8b, RSP, R14, offsetof(JitState, saved_rsp));
+	emit(&buf, 0xb8); // mov eax, VM_STACK_OVERFLOW
+	emit32(&buf, VM_STACK_OVERFLOW);
+	EMIT(&buf, "\xeb\x09"); // jmp leave
+	size_t exit_pos = buf.size;
+	emit_rm(&buf, 0x8b, RSP, R14, offsetof(JitState, saved_rsp));
+	EMIT(&buf, "\x31\xc0"); // xor eax, eax
+	// leave:
+	emit_rm(&buf, 0x89, RBX, R14, offsetof(JitState, sp));
+	EMIT(&buf, "\x41\x5f\x41\x5e\x41\x5d\x41\x5c\x5b\xc3"); // pop r15 ... rbx; ret
+
+	jit->entry = buf.size;
+	EMIT(&buf, "\x53\x41\x54\x41\x55\x41\x56\x41\x57"); // push rbx ... r15
+	EMIT(&buf, "\x49\x89\xfe"); // mov r14, rdi
+	emit_rm(&buf, 0x8b, RBX, R14, offsetof(JitState, sp));
+	emit_rm(&buf, 0x8b, R12, R14, offsetof(JitState, locals));
+	EMIT(&buf, "\x4d\x89\xe5"); // mov r13, r12
+	emit_rm(&buf, 0x8b, R15, R14, offsetof(JitState, frames));
+	emit_rm(&buf, 0x89, RSP, R14, offsetof(JitState, saved_rsp));
+	emit_rm(&buf, 0x8b, RSP, R14, offsetof(JitState, native_stack));
+
+	size_t next_fun = 0;
+	FunctionInfo* fun = &functions[0];
+	for(size_t i = 0; i < inst_size; ++i) {
+		while(next_fun < n_functions && functions[next_fun].start_addr <= i)
+			fun = &functions[next_fun++];
+		offsets[i] = buf.size;
+		if(!operand_fits(&instructions[i]) ||
+			compile_instruction(&buf, &fixups, &instructions[i], fun, functions, n_functions,
+				error_pos, exit_pos))
+			goto quit;
+	}
+	offsets[inst_size] = buf.size;
+	emit_jump(&buf, JMP, exit_pos);
+
+	for(size_t i = 0; i < fixups.size; ++i) {
+		size_t target = offsets[functions[fixups.data[i].function].start_addr];
+		patch32(&buf, fixups.data[i].pos, target - (fixups.data[i].pos + 4));
+	}
+	if(buf.failed)
+		goto quit;
+
+	jit->code = mmap(NULL, buf.size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(jit->code == MAP_FAILED)
+		goto quit;
+	memcpy(jit->code, buf.data, buf.size);
+	if(mprotect(jit->code, buf.size, PROT_READ | PROT_EXEC)) {
+		munmap(jit->code, buf.size);
+		goto quit;
+	}
+	jit->size = buf.size;
+	ret = 0;
+
+quit:
+	free(offsets);
+	free(buf.data);
+	vector_deinit(&fixups);
+	return ret;
+}
+
+void jit_free(JitCode* jit) {
+	munmap(jit->code, jit->size);
+	jit->code = NULL;
+	jit->size = 0;
+}
+
+int jit_run(JitCode* jit, VM* vm, FunctionInfo* functions, size_t n_functions) {
+	assert(n_functions);
+	(void) n_functions;
+	JitState state = {
+		.sp = vm->operand_stack.data + vm->operand_stack.sp,
+		.locals = vm->call_stack.slots,
+		.stack_end = vm->operand_stack.data + vm->operand_stack.capacity,
+		.slots_end = vm->call_stack.slots + vm->call_stack.slot_capacity,
+		.frames = vm->call_stack.capacity,
+		.saved_rsp = NULL
+	};
+	if(state.locals + functions[0].n_locals > state.slots_end ||
+		state.sp + functions[0].max_stack > state.stack_end ||
+		vm_reserve_native(vm, &state.native_stack))
+		return 1;
+
+	int (*entry)(JitState*) = (int (*)(JitState*)) ((uint8_t*) jit->code + jit->entry);
+	int ret = entry(&state);
+	vm->operand_stack.sp = state.sp - vm->operand_stack.data;
+	return ret;
+}
+
+#else
+
+int jit_compile(JitCode* jit, Instruction* instructions, size_t inst_size,
+	FunctionInfo* functions, size_t n_functions) {
+	(void) jit;
+	(void) instructions;
+	(void) inst_size;
+	(void) functions;
+	(void) n_functions;
+	return 1;
+}
+
+void jit_free(JitCode* jit) {
+	(void) jit;
+}
+
+int jit_run(JitCode* jit, VM* vm, FunctionInfo* functions, size_t n_functions) {
+	(void) jit;
+	(void) vm;
+	(void) functions;
+	(void) n_functions;
+	return 1;
+}
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef _JIT_H_
+#define _JIT_H_
+
+#include <stddef.h>
+#include "instruction.h"
+#include "vm.h"
+
+typedef struct {
+	void* code;
+	size_t size;
+	size_t entry;
+} JitCode;
+
+// Returns nonzero when the host or the program is not supported, in
+// which case the caller should fall back to the interpreter.
+int jit_compile(JitCode* jit, Instruction* instructions, size_t inst_size,
+	FunctionInfo* functions, size_t n_functions);
+void jit_free(JitCode* jit);
+
+// Runs on the VM's operand stack and slot array so the final state is
+// the same as after vm_run, and fails with VM_STACK_OVERFLOW where it
+// would.
+int jit_run(JitCode* jit, VM* vm, FunctionInfo* functions, size_t n_functions);
+
+#endif
@@ -1,131 +1,299 @@
 #include "lexer.h"
-#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <assert.h>
+#include <pthread.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+typedef struct {
+	const char* str;
+	size_t len;
+	TokenType type;
+} Keyword;
+
+static const Keyword keywords[] = {
+#define KEYWORD(tok, str) { str, sizeof(str) - 1, tok },
+	FOR_EACH_KEYWORD(KEYWORD)
+#undef KEYWORD
+};
+
+#define N_KEYWORDS (sizeof(keywords) / sizeof(keywords[0]))
+#define KEYWORD_SLOTS 256
+// Gives every keyword in FOR_EACH_KEYWORD its own slot. Pick a new one if
+// lexer_init starts failing after the keywords change.
+#define KEYWORD_SEED 1
+
+// Perfect hash over FOR_EACH_KEYWORD: the first, middle and last byte and
+// the length pick a slot. Slots hold the keyword index plus one. Filled in
+// once per process, whichever thread gets to a lexer first.
+static uint8_t keyword_slots[KEYWORD_SLOTS];
+static int keywords_collide;
+static pthread_once_t keyword_once = PTHREAD_ONCE_INIT;
+
+static inline unsigned keyword_hash(const char* str, size_t len) {
+	return ((uint8_t) str[0] * KEYWORD_SEED + (uint8_t) str[len / 2] * 7 + (uint8_t) str[len - 1] * 3 + len) &
+		(KEYWORD_SLOTS - 1);
+}
+
+static void keyword_init(void) {
+	for(size_t i = 0; i < N_KEYWORDS; ++i) {
+		uint8_t* slot = &keyword_slots[keyword_hash(keywords[i].str, keywords[i].len)];
+		if(*slot)
+			keywords_collide = 1;
+		*slot = i + 1;
+	}
+}
+
+static inline TokenType keyword_lookup(str_t str) {
+	if(!str.len)
+		return TOKEN_IDENTIFIER;
+	uint8_t slot = keyword_slots[keyword_hash(str.data, str.len)];
+	if(!slot)
+		return TOKEN_IDENTIFIER;
+	const Keyword* keyword = &keywords[slot - 1];
+	if(keyword->len != str.len || memcmp(keyword->str, str.data, str.len))
+		return TOKEN_IDENTIFIER;
+	return keyword->type;
+}
 
 int lexer_init(Lexer* lexer, Silk_Ctx* ctx, const char* data, const char* end) {
+	pthread_once(&keyword_once, keyword_init);
+	if(keywords_collide) {
+		if(ctx->print_errors)
+			printf("%s: error: Keywords share a hash slot, change KEYWORD_SEED\n", ctx->filename);
+		return 1;
+	}
 	lexer->ctx = ctx;
 	lexer->data = data;
 	lexer->end = end;
+	lexer->more = 0;
 	lexer->line = 1;
-	return 0;
+	return symbol_table_init(&lexer->symbols);
+}
+
+void lexer_deinit(Lexer* lexer) {
+	symbol_table_deinit(&lexer->symbols);
 }
 
-static inline int is_valid_identifier(char c) {
-	return
-		c != '(' && c != ')' &&
-		c != '{' && c != '}' &&
-		c != ';' &&
-		c != '+' &&
-		c != '*' && c != '/' &&
-		c != '.' && c != ',';
+enum {
+	CHAR_SPACE = 1 << 0,
+	CHAR_DIGIT = 1 << 1,
+	// Ends an identifier
+	CHAR_DELIM = 1 << 2
+};
+
+// Whitespace matches isspace() in the C locale
+static const uint8_t char_class[256] = {
+	['\t'] = CHAR_SPACE, ['\n'] = CHAR_SPACE, ['\v'] = CHAR_SPACE,
+	['\f'] = CHAR_SPACE, ['\r'] = CHAR_SPACE, [' '] = CHAR_SPACE,
+	['0'] = CHAR_DIGIT, ['1'] = CHAR_DIGIT, ['2'] = CHAR_DIGIT, ['3'] = CHAR_DIGIT,
+	['4'] = CHAR_DIGIT, ['5'] = CHAR_DIGIT, ['6'] = CHAR_DIGIT, ['7'] = CHAR_DIGIT,
+	['8'] = CHAR_DIGIT, ['9'] = CHAR_DIGIT,
+	['('] = CHAR_DELIM, [')'] = CHAR_DELIM, ['{'] = CHAR_DELIM, ['}'] = CHAR_DELIM,
+	[';'] = CHAR_DELIM, ['+'] = CHAR_DELIM, ['*'] = CHAR_DELIM, ['/'] = CHAR_DELIM,
+	['.'] = CHAR_DELIM, [','] = CHAR_DELIM
+};
+
+// TOKEN_EOF marks bytes that don't form a token on their own
+static const uint8_t single_char_tokens[256] = {
+	['('] = TOKEN_BRACKET_OPEN,
+	[')'] = TOKEN_BRACKET_CLOSE,
+	['{'] = TOKEN_CURLY_OPEN,
+	['}'] = TOKEN_CURLY_CLOSE,
+	[';'] = TOKEN_SEMICOLON,
+	[','] = TOKEN_COMMA,
+	['+'] = TOKEN_PLUS,
+	['-'] = TOKEN_MINUS,
+	['*'] = TOKEN_ASTERISK,
+	['/'] = TOKEN_SLASH,
+	['='] = TOKEN_EQ_SIGN
+};
+
+#define CLASS(c) char_class[(uint8_t) (c)]
+
+#ifdef __SSE2__
+// Bytes in [lo, hi], compared unsigned
+static inline __m128i in_range(__m128i v, char lo, char hi) {
+	__m128i t = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+	__m128i k = _mm_set1_epi8(hi - lo);
+	return _mm_cmpeq_epi8(_mm_max_epu8(t, k), k);
+}
+
+static inline __m128i space_mask(__m128i v) {
+	return _mm_or_si128(in_range(v, '\t', '\r'), _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+}
+
+// Everything that ends an identifier, the same set as CHAR_SPACE | CHAR_DELIM
+static inline __m128i ident_end_mask(__m128i v) {
+	__m128i mask = _mm_or_si128(space_mask(v), in_range(v, '(', ','));
+	mask = _mm_or_si128(mask, in_range(v, '.', '/'));
+	mask = _mm_or_si128(mask, _mm_cmpeq_epi8(v, _mm_set1_epi8(';')));
+	mask = _mm_or_si128(mask, _mm_cmpeq_epi8(v, _mm_set1_epi8('{')));
+	return _mm_or_si128(mask, _mm_cmpeq_epi8(v, _mm_set1_epi8('}')));
 }
+#endif
 
-static inline char* copy_str_to_heap(const char* str) {
-	size_t len = strlen(str);
-	char* new = malloc(len + 1);
-	assert(new);
-	return memcpy(new, str, len + 1);
+// Runs of one or two bytes are the common case (a space between tokens,
+// a newline at the end of a statement), so the vector loops only start
+// once the scalar check has seen a longer run.
+#define SCALAR_PREFIX 2
+
+// Skips a run of whitespace, counting the newlines in it
+static inline const char* skip_space(const char* p, const char* end, int* line) {
+	for(int i = 0; i < SCALAR_PREFIX; ++i) {
+		if(p >= end || !(CLASS(*p) & CHAR_SPACE))
+			return p;
+		*line += *p == '\n';
+		++p;
+	}
+#ifdef __SSE2__
+	while(end - p >= 16) {
+		__m128i v = _mm_loadu_si128((const __m128i*) p);
+		unsigned other = ~_mm_movemask_epi8(space_mask(v)) & 0xffff;
+		unsigned newlines = _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')));
+		if(other) {
+			unsigned n = __builtin_ctz(other);
+			*line += __builtin_popcount(newlines & ((1u << n) - 1));
+			return p + n;
+		}
+		*line += __builtin_popcount(newlines);
+		p += 16;
+	}
+#endif
+	while(p < end && CLASS(*p) & CHAR_SPACE) {
+		*line += *p == '\n';
+		++p;
+	}
+	return p;
+}
+
+static inline const char* scan_identifier(const char* p, const char* end) {
+	for(int i = 0; i < SCALAR_PREFIX * 2; ++i) {
+		if(p >= end || CLASS(*p) & (CHAR_SPACE | CHAR_DELIM))
+			return p;
+		++p;
+	}
+#ifdef __SSE2__
+	while(end - p >= 16) {
+		unsigned stop = _mm_movemask_epi8(ident_end_mask(_mm_loadu_si128((const __m128i*) p)));
+		if(stop)
+			return p + __builtin_ctz(stop);
+		p += 16;
+	}
+#endif
+	while(p < end && !(CLASS(*p) & (CHAR_SPACE | CHAR_DELIM)))
+		++p;
+	return p;
 }
 
 int lexer_next(Lexer* lexer, Token* tok) {
-again:
+	lexer->data = skip_space(lexer->data, lexer->end, &lexer->line);
 	tok->line = lexer->line;
-#define DATA_SIZE 128
-	char data[DATA_SIZE];
 	if(lexer->data >= lexer->end) {
+		if(lexer->more)
+			return LEXER_NEED_INPUT;
 		tok->type = TOKEN_EOF;
 		return 0;
 	}
-	if(isspace(*lexer->data)) {
-		if(*lexer->data == '\n')
-			++lexer->line;
+
+	TokenType single = single_char_tokens[(uint8_t) *lexer->data];
+	if(single != TOKEN_EOF) {
+		tok->type = single;
 		++lexer->data;
-		goto again;
+		goto ret;
 	}
-
-#define SINGLE_CHAR_TOKEN(c, toktype) \
-	do { \
-		if(*lexer->data == c) { \
-			tok->type = toktype; \
-			goto inc_ret; \
-		} \
-	} \
-	while(0)
-
-	SINGLE_CHAR_TOKEN('(', TOKEN_BRACKET_OPEN);
-	SINGLE_CHAR_TOKEN(')', TOKEN_BRACKET_CLOSE);
-	SINGLE_CHAR_TOKEN('{', TOKEN_CURLY_OPEN);
-	SINGLE_CHAR_TOKEN('}', TOKEN_CURLY_CLOSE);
-	SINGLE_CHAR_TOKEN(';', TOKEN_SEMICOLON);
-	SINGLE_CHAR_TOKEN(',', TOKEN_COMMA);
-	SINGLE_CHAR_TOKEN('+', TOKEN_PLUS);
-	SINGLE_CHAR_TOKEN('-', TOKEN_MINUS);
-	SINGLE_CHAR_TOKEN('*', TOKEN_ASTERISK);
-	SINGLE_CHAR_TOKEN('/', TOKEN_SLASH);
-	SINGLE_CHAR_TOKEN('=', TOKEN_EQ_SIGN);
-	if(isdigit(*lexer->data)) {
+	const char* begin = lexer->data;
+	if(CLASS(*lexer->data) & CHAR_DIGIT) {
+		// Digit runs are short and each digit feeds the accumulator, so a
+		// vector scan wouldn't pay for itself here
 		int64_t num;
-		for(num = 0; isdigit(*lexer->data) && lexer->data < lexer->end;
+		for(num = 0; lexer->data < lexer->end && CLASS(*lexer->data) & CHAR_DIGIT;
 			++lexer->data) {
 			num *= 10;
 			num += *lexer->data - '0';
 		}
+		if(lexer->data == lexer->end && lexer->more)
+			goto need_input;
 		tok->type = TOKEN_INT_LITERAL;
 		tok->num = num;
 		goto ret;
 	}
 	if(*lexer->data == '"') {
-		++lexer->data;
-		size_t i = 0;
-		for(i = 0; i < DATA_SIZE && lexer->data < lexer->end &&
-			*lexer->data != '"'; ++i, ++lexer->data)
-			data[i] = *lexer->data;
+		const char* quote = memchr(begin + 1, '"', lexer->end - begin - 1);
+		if(!quote && lexer->more)
+			goto need_input;
+		lexer->data = quote ? quote : lexer->end;
 
-		data[ i < DATA_SIZE ? i : DATA_SIZE - 1 ] = 0;
+		tok->type = TOKEN_STR_LITERAL;
+		tok->str = (str_t){ begin + 1, lexer->data - begin - 1 };
 		if(lexer->data < lexer->end)
 			++lexer->data;
-
-		tok->type = TOKEN_STR_LITERAL;
-		tok->data = copy_str_to_heap(data);
 		goto ret;
 	}
 	else {
-		size_t i;
-		for(i = 0; !isspace(*lexer->data) && is_valid_identifier(*lexer->data)
-			&& lexer->data < lexer->end && i < DATA_SIZE; ++i, ++lexer->data)
-			data[i] = *lexer->data;
-
-		data[ i < DATA_SIZE ? i : DATA_SIZE - 1 ] = 0;
-		if(!strcmp(data, "function")) {
-			tok->type = TOKEN_FUNCTION;
-			goto ret;
-		}
-		if(!strcmp(data, "return")) {
-			tok->type = TOKEN_RETURN;
-			goto ret;
-		}
-		if(!strcmp(data, "var")) {
-			tok->type = TOKEN_VAR;
-			goto ret;
-		}
-		else {
-			tok->type = TOKEN_IDENTIFIER;
-			tok->data = copy_str_to_heap(data);
-			goto ret;
-		}
+		lexer->data = scan_identifier(begin, lexer->end);
+		if(lexer->data == lexer->end && lexer->more)
+			goto need_input;
+
+		tok->str = (str_t){ begin, lexer->data - begin };
+		tok->type = keyword_lookup(tok->str);
+		if(tok->type == TOKEN_IDENTIFIER && symbol_intern(&lexer->symbols, tok->str, &tok->sym))
+			return 1;
+		goto ret;
 	}
 
-inc_ret:
-	++lexer->data;
+need_input:
+	lexer->data = begin;
+	return LEXER_NEED_INPUT;
+
 ret:
 	if(lexer->ctx->print_tokens)
 		lexer_print_token(tok);
 	return 0;
 }
 
+// Takes the same steps as lexer_next, minus producing the tokens
+int lexer_skip_block(Lexer* lexer) {
+	const char* p = lexer->data;
+	const char* end = lexer->end;
+	size_t depth = 1;
+	for(;;) {
+		p = skip_space(p, end, &lexer->line);
+		if(p >= end)
+			break;
+		TokenType single = single_char_tokens[(uint8_t) *p];
+		if(single == TOKEN_CURLY_OPEN)
+			++depth;
+		else if(single == TOKEN_CURLY_CLOSE && !--depth) {
+			lexer->data = p + 1;
+			return 0;
+		}
+
+		if(single != TOKEN_EOF)
+			++p;
+		else if(CLASS(*p) & CHAR_DIGIT)
+			while(p < end && CLASS(*p) & CHAR_DIGIT)
+				++p;
+		else if(*p == '"') {
+			const char* quote = memchr(p + 1, '"', end - p - 1);
+			p = quote ? quote + 1 : end;
+		}
+		else
+			p = scan_identifier(p, end);
+	}
+	lexer->data = p;
+	return 1;
+}
+
+void lexer_seek(Lexer* lexer, const char* data, const char* end, int line) {
+	lexer->data = data;
+	lexer->end = end;
+	lexer->line = line;
+}
+
 const char* lexer_token_type_to_str(TokenType type) {
 	switch(type) {
 #define ENUMERATOR(tok) case tok: return &#tok[6];
@@ -138,21 +306,10 @@ const char* lexer_token_type_to_str(TokenType type) {
 void lexer_print_token(Token* tok) {
 	printf("%s ", lexer_token_type_to_str(tok->type));
 	if(tok->type == TOKEN_IDENTIFIER)
-		printf("%s", tok->data);
+		printf(STR_FMT, STR_ARG(tok->str));
 	else if(tok->type == TOKEN_INT_LITERAL)
 		printf("%ld", tok->num);
 	else if(tok->type == TOKEN_STR_LITERAL)
-		printf("%s", tok->data);
+		printf(STR_FMT, STR_ARG(tok->str));
 	putchar('\n');
 }
-
-void lexer_destroy_token(Token* tok) {
-	switch(tok->type) {
-		case TOKEN_STR_LITERAL:
-		case TOKEN_IDENTIFIER:
-			free(tok->data);
-			tok->data = NULL;
-		default:
-			break;
-	}
-}
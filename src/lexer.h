@@ -4,6 +4,9 @@
 #include <stdint.h>
 #include <silk.h>
 
+#include "str.h"
+#include "symbol.h"
+
 #define FOR_EACH_TOKEN(_) \
 	_(TOKEN_EOF) \
 	_(TOKEN_BRACKET_OPEN) \
@@ -30,27 +33,51 @@ FOR_EACH_TOKEN(ENUMERATOR)
 #undef ENUMERATOR
 } TokenType;
 
+// Identifiers that lex as their own token
+#define FOR_EACH_KEYWORD(_) \
+	_(TOKEN_FUNCTION, "function") \
+	_(TOKEN_RETURN, "return") \
+	_(TOKEN_VAR, "var")
+
 typedef struct {
 	TokenType type;
 	int line;
 	union {
 		char whitespace_char;
-		char* data;
+		str_t str;
 		int64_t num;
 	};
+	// Interned id of a TOKEN_IDENTIFIER
+	SymbolId sym;
 } Token;
 
+// Returned by lexer_next when more input is expected and the next token
+// could continue past the end of what has arrived so far. The lexer is
+// left at the start of that token.
+#define LEXER_NEED_INPUT 2
+
 typedef struct {
 	Silk_Ctx* ctx;
 	const char* data;
 	const char* end;
+	// Set while `end` is only the end of the input received so far
+	char more;
 	int line;
+	// Every identifier seen so far. The table owns copies of the names,
+	// so the source can be freed once it has been lexed.
+	SymbolTable symbols;
 } Lexer;
 
 int lexer_init(Lexer* lexer, Silk_Ctx* ctx, const char* data, const char* end);
+void lexer_deinit(Lexer* lexer);
 int lexer_next(Lexer* lexer, Token* tok);
+// Skips past the '}' matching the '{' lexed last. Returns 1 if the input
+// ends first.
+int lexer_skip_block(Lexer* lexer);
+// Carries on lexing from another part of the same source. Symbols keep
+// their ids.
+void lexer_seek(Lexer* lexer, const char* data, const char* end, int line);
 const char* lexer_token_type_to_str(TokenType type);
 void lexer_print_token(Token* tok);
-void lexer_destroy_token(Token* tok);
 
 #endif
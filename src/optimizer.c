@@ -0,0 +1,86 @@
+#include "optimizer.h"
+#include <stdint.h>
+
+static int fuse(Instruction first, Instruction second, Instruction* fused) {
+	switch(first.type) {
+		case INST_PUSH:
+			switch(second.type) {
+				case INST_SUM:
+					*fused = (Instruction){ INST_ADD_IMM, first.val };
+					return 1;
+				case INST_SUB:
+					*fused = (Instruction){ INST_SUB_IMM, first.val };
+					return 1;
+				case INST_MUL:
+					*fused = (Instruction){ INST_MUL_IMM, first.val };
+					return 1;
+				case INST_DIV:
+					*fused = (Instruction){ INST_DIV_IMM, first.val };
+					return 1;
+				default:
+					return 0;
+			}
+		case INST_STORE:
+			if(second.type != INST_LOAD || second.val != first.val)
+				return 0;
+			*fused = (Instruction){ INST_STORE_KEEP, first.val };
+			return 1;
+		case INST_STORE_GLOBAL:
+			if(second.type != INST_LOAD_GLOBAL || second.val != first.val)
+				return 0;
+			*fused = (Instruction){ INST_STORE_GLOBAL_KEEP, first.val };
+			return 1;
+		case INST_LOAD:
+			if(second.type != INST_LOAD ||
+				(uint64_t) first.val > UINT16_MAX || (uint64_t) second.val > UINT16_MAX)
+				return 0;
+			*fused = (Instruction){ INST_LOAD_LOAD, (int64_t) ((uint64_t) first.val | (uint64_t) second.val << 16) };
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+// Rewrites adjacent instruction pairs into superinstructions in place and
+// relocates the function table. Returns the number of instructions removed.
+size_t optimizer_run(Vector_Instruction* instructions, Vector_FunctionInfo* infos) {
+	Instruction* code = instructions->data;
+	size_t size = instructions->size;
+	size_t out = 0;
+	size_t next_fun = 0;
+
+	for(size_t i = 0; i < size;) {
+		while(next_fun < infos->size && infos->data[next_fun].start_addr == i)
+			infos->data[next_fun++].start_addr = out;
+
+		// A pair must not straddle a function entry point
+		int has_second = i + 1 < size &&
+			!(next_fun < infos->size && infos->data[next_fun].start_addr == i + 1);
+
+		Instruction fused;
+		if(has_second && fuse(code[i], code[i + 1], &fused)) {
+			code[out++] = fused;
+			i += 2;
+		}
+		else
+			code[out++] = code[i++];
+	}
+	while(next_fun < infos->size)
+		infos->data[next_fun++].start_addr = out;
+
+	instructions->size = out;
+	return size - out;
+}
+
+size_t optimizer_run_tail(Vector_Instruction* instructions, size_t begin) {
+	FunctionInfo entry = { 0, 0, 0, 0 };
+	Vector_FunctionInfo infos = { .data = &entry, .capacity = 1, .size = 1 };
+	Vector_Instruction tail = {
+		.data = instructions->data + begin,
+		.capacity = instructions->size - begin,
+		.size = instructions->size - begin
+	};
+	size_t removed = optimizer_run(&tail, &infos);
+	instructions->size = begin + tail.size;
+	return removed;
+}
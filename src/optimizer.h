@@ -0,0 +1,13 @@
+#ifndef _OPTIMIZER_H_
+#define _OPTIMIZER_H_
+
+#include <stddef.h>
+#include "ast.h"
+
+// A new or changed rewrite needs a CODEGEN_VERSION bump, see instruction.h
+size_t optimizer_run(Vector_Instruction* instructions, Vector_FunctionInfo* infos);
+// Optimizes instructions[begin..] as a single function, for code that
+// gets compiled a piece at a time. The function table is left alone.
+size_t optimizer_run_tail(Vector_Instruction* instructions, size_t begin);
+
+#endif
@@ -7,6 +7,43 @@
 
 int parser_init(Parser* parser, Lexer* lexer) {
 	parser->lexer = lexer;
+	parser->tokens = NULL;
+	parser->lazy = 0;
+	arena_init(&parser->arena);
+	if(vector_ASTNode_ptr_t_init(&parser->nodes, 64))
+		return 1;
+	if(vector_Symbol_init(&parser->syms, 16)) {
+		vector_deinit(&parser->nodes);
+		return 1;
+	}
+	if(vector_ExprFrame_init(&parser->frames, 16)) {
+		vector_deinit(&parser->nodes);
+		vector_deinit(&parser->syms);
+		return 1;
+	}
+	return 0;
+}
+
+void parser_deinit(Parser* parser) {
+	arena_deinit(&parser->arena);
+	vector_deinit(&parser->nodes);
+	vector_deinit(&parser->syms);
+	vector_deinit(&parser->frames);
+}
+
+void parser_reset(Parser* parser) {
+	arena_deinit(&parser->arena);
+	arena_init(&parser->arena);
+}
+
+// Tokens come straight from the lexer unless the parser was handed a
+// buffered list, which stays on its final TOKEN_EOF
+static inline int advance(Parser* parser) {
+	if(!parser->tokens)
+		return lexer_next(parser->lexer, &parser->tok);
+	parser->tok = *parser->tokens;
+	if(parser->tok.type != TOKEN_EOF)
+		++parser->tokens;
 	return 0;
 }
 
@@ -20,14 +57,14 @@ static inline void unexpected(Parser* parser, TokenType expected) {
 
 static int expect(Parser* parser, TokenType expected) {
 	if(parser->tok.type == expected)
-		return lexer_next(parser->lexer, &parser->tok);
+		return advance(parser);
 	unexpected(parser, expected);
 	return 1;
 }
 
 static int expect_silent(Parser* parser, TokenType expected) {
 	if(parser->tok.type == expected)
-		return lexer_next(parser->lexer, &parser->tok);
+		return advance(parser);
 	return 1;
 }
 
@@ -39,13 +76,41 @@ static inline void invalid(Parser* parser) {
 	}
 }
 
-static void scope_append(ASTNode* scope, ASTNode* appendant) {
-	size_t new_size = (scope->scope.n_nodes + 1) * sizeof(ASTNode*);
-	ASTNode** new = realloc(scope->scope.nodes, new_size);
-	assert(new);
-	scope->scope.nodes = new;
-	scope->scope.nodes[scope->scope.n_nodes] = appendant;
-	++scope->scope.n_nodes;
+int parser_advance(Parser* parser) {
+	return advance(parser);
+}
+
+int parser_expect(Parser* parser, TokenType expected) {
+	return expect(parser, expected);
+}
+
+int parser_expect_silent(Parser* parser, TokenType expected) {
+	return expect_silent(parser, expected);
+}
+
+void parser_unexpected(Parser* parser, TokenType expected) {
+	unexpected(parser, expected);
+}
+
+void parser_invalid(Parser* parser) {
+	invalid(parser);
+}
+
+// Moves the nodes pushed since `base` into an exactly sized arena array
+static ASTNodeList pop_nodes(Parser* parser, size_t base) {
+	ASTNodeList list = { parser->nodes.size - base, NULL };
+	list.data = arena_copy(&parser->arena, &parser->nodes.data[base], sizeof(ASTNode*) * list.size);
+	assert(list.data || !list.size);
+	parser->nodes.size = base;
+	return list;
+}
+
+static SymbolList pop_syms(Parser* parser, size_t base) {
+	SymbolList list = { parser->syms.size - base, NULL };
+	list.data = arena_copy(&parser->arena, &parser->syms.data[base], sizeof(Symbol) * list.size);
+	assert(list.data || !list.size);
+	parser->syms.size = base;
+	return list;
 }
 
 static inline int is_bin_op(TokenType type) {
@@ -66,138 +131,153 @@ static int token_to_bin_op(TokenType type) {
 	}
 }
 
-static ASTNode* parse_expr(Parser* parser) {
-	ASTNode* expr_node = ast_create_node((ASTNode){
-		.type = NODE_EXPR,
-		.line = parser->tok.line
-	});
+static inline int precedence(int op) {
+	return op == NODE_EXPR_MUL || op == NODE_EXPR_DIV ? 2 : 1;
+}
 
-	TokenType lhs_type = parser->tok.type;
-	int64_t num = parser->tok.num;
-	char* data = parser->tok.data;
-	if(
-		expect_silent(parser, TOKEN_IDENTIFIER) &&
-		expect_silent(parser, TOKEN_INT_LITERAL) &&
-		expect(parser, TOKEN_STR_LITERAL)
-	) {
-		free(expr_node);
-		return NULL;
+// Turns the operators on top of the frame stack that bind at least as
+// tightly as min_precedence into nodes, leftmost first
+static void reduce(Parser* parser, size_t frames_base, int min_precedence) {
+	while(parser->frames.size > frames_base) {
+		ExprFrame* top = &parser->frames.data[parser->frames.size - 1];
+		if(top->type != FRAME_BIN_OP || precedence(top->op) < min_precedence)
+			return;
+		ASTNode* rhs = parser->nodes.data[--parser->nodes.size];
+		ASTNode* lhs = parser->nodes.data[--parser->nodes.size];
+		ASTNode* bin_op = ast_create_node(&parser->arena, (ASTNode){
+			.type = NODE_EXPR,
+			.expr = {
+				.type = NODE_EXPR_BIN_OP,
+				.bin_op = {
+					.type = top->op,
+					.lhs = lhs,
+					.rhs = rhs
+				}
+			}
+		});
+		vector_aappend(&parser->nodes, bin_op);
+		--parser->frames.size;
 	}
+}
 
-	if(lhs_type == TOKEN_IDENTIFIER) {
-		if(parser->tok.type == TOKEN_BRACKET_OPEN) {
-			if(lexer_next(parser->lexer, &parser->tok)) {
-				free(data);
-				free(expr_node);
-				return NULL;
+// Precedence climbing without recursion: operands are pushed onto
+// parser->nodes, and operators, assignments and calls waiting for their
+// operands onto parser->frames, so nesting only costs heap. '*' and '/'
+// bind tighter than '+' and '-', and equal precedence associates to the
+// left.
+//
+// Nothing is freed on error: the whole tree goes with the arena in
+// parser_deinit
+static ASTNode* parse_expr(Parser* parser) {
+	size_t frames_base = parser->frames.size;
+	size_t nodes_base = parser->nodes.size;
+	int want_operand = 1;
+	for(;;) {
+		if(want_operand) {
+			ASTNode* operand = ast_create_node(&parser->arena, (ASTNode){
+				.type = NODE_EXPR,
+				.line = parser->tok.line
+			});
+
+			TokenType type = parser->tok.type;
+			int64_t num = parser->tok.num;
+			str_t data = parser->tok.str;
+			Symbol sym = { data, parser->tok.sym };
+			if(
+				expect_silent(parser, TOKEN_IDENTIFIER) &&
+				expect_silent(parser, TOKEN_INT_LITERAL) &&
+				expect(parser, TOKEN_STR_LITERAL)
+			)
+				goto fail;
+
+			if(type == TOKEN_IDENTIFIER && parser->tok.type == TOKEN_BRACKET_OPEN) {
+				if(advance(parser))
+					goto fail;
+				operand->expr.type = NODE_EXPR_FUN_CALL;
+				operand->expr.fun_call.identifier = sym;
+				vector_aappend(&parser->frames, ((ExprFrame){ FRAME_CALL, operand, 0, parser->nodes.size }));
+				want_operand = parser->tok.type != TOKEN_BRACKET_CLOSE;
+				continue;
 			}
-
-			vector_ASTNode_ptr_t_ainit(&expr_node->expr.fun_call.args, 64);
-			while(parser->tok.type != TOKEN_BRACKET_CLOSE) {
-				ASTNode* arg = parse_expr(parser);
-				if(!arg) {
-					for(size_t i = 0; i < expr_node->expr.fun_call.args.size; ++i)
-						ast_destroy(expr_node->expr.fun_call.args.data[i]);
-					vector_deinit(&expr_node->expr.fun_call.args);
-					free(data);
-					free(expr_node);
-					return NULL;
-				}
-
-				vector_aappend(&expr_node->expr.fun_call.args, arg);
-
-				if(parser->tok.type == TOKEN_COMMA) {
-					if(lexer_next(parser->lexer, &parser->tok)) {
-						for(size_t i = 0; i < expr_node->expr.fun_call.args.size; ++i)
-							ast_destroy(expr_node->expr.fun_call.args.data[i]);
-						vector_deinit(&expr_node->expr.fun_call.args);
-						free(data);
-						free(expr_node);
-						return NULL;
-					}
-				}
+			if(type == TOKEN_IDENTIFIER && parser->tok.type == TOKEN_EQ_SIGN) {
+				if(advance(parser))
+					goto fail;
+				operand->expr.type = NODE_EXPR_VAR_REASSIGNMENT;
+				operand->expr.var_assignment.identifier = sym;
+				vector_aappend(&parser->frames, ((ExprFrame){ FRAME_ASSIGNMENT, operand, 0, 0 }));
+				continue;
 			}
 
-			if(expect(parser, TOKEN_BRACKET_CLOSE)) {
-				for(size_t i = 0; i < expr_node->expr.fun_call.args.size; ++i)
-					ast_destroy(expr_node->expr.fun_call.args.data[i]);
-				vector_deinit(&expr_node->expr.fun_call.args);
-				free(data);
-				free(expr_node);
-				return NULL;
+			if(type == TOKEN_IDENTIFIER) {
+				operand->expr.type = NODE_EXPR_VAR_LOOKUP;
+				operand->expr.var_lookup.identifier = sym;
 			}
-			expr_node->expr.type = NODE_EXPR_FUN_CALL;
-			expr_node->expr.fun_call.identifier = data;
-		}
-		else if(parser->tok.type == TOKEN_EQ_SIGN) {
-			expr_node->expr.type = NODE_EXPR_VAR_REASSIGNMENT;
-			expr_node->expr.var_assignment.identifier = data;
-
-			if(lexer_next(parser->lexer, &parser->tok)) {
-				free(data);
-				free(expr_node);
-				return NULL;
+			else if(type == TOKEN_INT_LITERAL) {
+				operand->expr.type = NODE_EXPR_INT_LIT;
+				operand->expr.int_lit.num = num;
 			}
-
-			ASTNode* expr = parse_expr(parser);
-			if(!expr) {
-				free(data);
-				free(expr_node);
-				return NULL;
+			else {
+				operand->expr.type = NODE_EXPR_STR_LIT;
+				operand->expr.str_lit.str = data;
 			}
-			expr_node->expr.var_assignment.expr = expr;
+			vector_aappend(&parser->nodes, operand);
+			want_operand = 0;
+			continue;
 		}
-		else {
-			expr_node->expr.type = NODE_EXPR_VAR_LOOKUP;
-			expr_node->expr.var_lookup.identifier = data;
+
+		if(is_bin_op(parser->tok.type)) {
+			int op = token_to_bin_op(parser->tok.type);
+			reduce(parser, frames_base, precedence(op));
+			vector_aappend(&parser->frames, ((ExprFrame){ FRAME_BIN_OP, NULL, op, 0 }));
+			if(advance(parser))
+				goto fail;
+			want_operand = 1;
+			continue;
 		}
 
-	}
-	else if(lhs_type == TOKEN_INT_LITERAL) {
-		expr_node->expr.type = NODE_EXPR_INT_LIT;
-		expr_node->expr.int_lit.num = num;
-	}
-	else if(lhs_type == TOKEN_STR_LITERAL) {
-		expr_node->expr.type = NODE_EXPR_STR_LIT;
-		expr_node->expr.str_lit.str = data;
-	}
-	else
-		assert(0);
-
-	if(is_bin_op(parser->tok.type)) {
-		ASTNode* lhs = expr_node;
-		TokenType type = parser->tok.type;
-		if(lexer_next(parser->lexer, &parser->tok)) {
-			ast_destroy(lhs);
-			return NULL;
+		// Whatever is open ends here: an assignment's value, a call
+		// argument or the expression itself
+		reduce(parser, frames_base, 0);
+		if(parser->frames.size == frames_base)
+			break;
+		ExprFrame* top = &parser->frames.data[parser->frames.size - 1];
+		if(top->type == FRAME_ASSIGNMENT) {
+			top->node->expr.var_assignment.expr = parser->nodes.data[--parser->nodes.size];
+			vector_aappend(&parser->nodes, top->node);
+			--parser->frames.size;
+			continue;
 		}
-		ASTNode* rhs = parse_expr(parser);
-		if(!rhs) {
-			ast_destroy(lhs);
-			return NULL;
+
+		assert(top->type == FRAME_CALL);
+		if(parser->tok.type == TOKEN_COMMA && advance(parser))
+			goto fail;
+		if(parser->tok.type != TOKEN_BRACKET_CLOSE) {
+			want_operand = 1;
+			continue;
 		}
-		expr_node = ast_create_node((ASTNode){
-			.type = NODE_EXPR,
-			.expr = {
-				.type = NODE_EXPR_BIN_OP,
-				.bin_op = {
-					.type = token_to_bin_op(type),
-					.lhs = lhs,
-					.rhs = rhs
-				}
-			}
-		});
+		if(advance(parser))
+			goto fail;
+		ASTNode* call = top->node;
+		call->expr.fun_call.args = pop_nodes(parser, top->base);
+		--parser->frames.size;
+		vector_aappend(&parser->nodes, call);
 	}
 
-	return expr_node;
+	assert(parser->nodes.size == nodes_base + 1);
+	return parser->nodes.data[--parser->nodes.size];
+
+fail:
+	parser->frames.size = frames_base;
+	parser->nodes.size = nodes_base;
+	return NULL;
 }
 
 static ASTNode* parse_return(Parser* parser) {
 	int line = parser->tok.line;
-	if(lexer_next(parser->lexer, &parser->tok))
+	if(advance(parser))
 		return NULL;
 
-	ASTNode* ret_node = ast_create_node((ASTNode){
+	ASTNode* ret_node = ast_create_node(&parser->arena, (ASTNode){
 		.type = NODE_RET_STATEMENT,
 		.line = line,
 		.ret = {
@@ -209,42 +289,34 @@ static ASTNode* parse_return(Parser* parser) {
 		return ret_node;
 
 	ASTNode* expr_node = parse_expr(parser);
-	if(!expr_node) {
-		ast_destroy(ret_node);
+	if(!expr_node)
 		return NULL;
-	}
 
 	ret_node->ret.expr = expr_node;
 
-	if(expect(parser, TOKEN_SEMICOLON)) {
-		ast_destroy(ret_node);
+	if(expect(parser, TOKEN_SEMICOLON))
 		return NULL;
-	}
 
 	return ret_node;
 }
 
 static ASTNode* parse_var(Parser* parser) {
 	int line = parser->tok.line;
-	if(lexer_next(parser->lexer, &parser->tok))
+	if(advance(parser))
 		return NULL;
 
-	char* identifier = parser->tok.data;
+	Symbol identifier = { parser->tok.str, parser->tok.sym };
 	if(expect(parser, TOKEN_IDENTIFIER))
 		return NULL;
 
-	if(expect(parser, TOKEN_EQ_SIGN)) {
-		free(identifier);
+	if(expect(parser, TOKEN_EQ_SIGN))
 		return NULL;
-	}
 
 	ASTNode* expr_node = parse_expr(parser);
-	if(!expr_node) {
-		free(identifier);
+	if(!expr_node)
 		return NULL;
-	}
 
-	ASTNode* var_node = ast_create_node((ASTNode){
+	ASTNode* var_node = ast_create_node(&parser->arena, (ASTNode){
 		.type = NODE_VAR_STATEMENT,
 		.line = line,
 		.var = {
@@ -256,7 +328,7 @@ static ASTNode* parse_var(Parser* parser) {
 }
 
 static ASTNode* parse_scope(Parser* parser) {
-	ASTNode* scope_node = ast_create_node((ASTNode){
+	ASTNode* scope_node = ast_create_node(&parser->arena, (ASTNode){
 		.type = NODE_SCOPE,
 		.line = parser->tok.line,
 		.scope = {
@@ -264,128 +336,132 @@ static ASTNode* parse_scope(Parser* parser) {
 			NULL
 		}
 	});
-	if(expect(parser, TOKEN_CURLY_OPEN)) {
-		ast_destroy(scope_node);
+	if(expect(parser, TOKEN_CURLY_OPEN))
 		return NULL;
-	}
 
+	size_t base = parser->nodes.size;
 	for(;;) {
+		ASTNode* child;
 		switch(parser->tok.type) {
-			case TOKEN_RETURN: {
-				ASTNode* ret_node = parse_return(parser);
-				if(!ret_node) {
-					ast_destroy(scope_node);
-					return NULL;
-				}
-				scope_append(scope_node, ret_node);
+			case TOKEN_RETURN:
+				child = parse_return(parser);
 				break;
-			}
-			case TOKEN_CURLY_CLOSE:
-				if(lexer_next(parser->lexer, &parser->tok)) {
-					ast_destroy(scope_node);
+			case TOKEN_CURLY_CLOSE: {
+				if(advance(parser))
 					return NULL;
-				}
+				ASTNodeList nodes = pop_nodes(parser, base);
+				scope_node->scope.n_nodes = nodes.size;
+				scope_node->scope.nodes = nodes.data;
 				return scope_node;
+			}
 			case TOKEN_IDENTIFIER:
 			case TOKEN_INT_LITERAL:
-			case TOKEN_STR_LITERAL: {
-				ASTNode* expr_node = parse_expr(parser);
-				if(!expr_node) {
-					ast_destroy(scope_node);
-					return NULL;
-				}
-				scope_append(scope_node, expr_node);
+			case TOKEN_STR_LITERAL:
+				child = parse_expr(parser);
 				break;
-			}
-			case TOKEN_VAR: {
-				ASTNode* var_node = parse_var(parser);
-				if(!var_node) {
-					ast_destroy(scope_node);
-					return NULL;
-				}
-				scope_append(scope_node, var_node);
+			case TOKEN_VAR:
+				child = parse_var(parser);
 				break;
-			}
 			case TOKEN_SEMICOLON:
-				if(lexer_next(parser->lexer, &parser->tok)) {
-					ast_destroy(scope_node);
+				if(advance(parser))
 					return NULL;
-				}
-				break;
+				continue;
 			case TOKEN_EOF:
 				unexpected(parser, TOKEN_CURLY_CLOSE);
-				ast_destroy(scope_node);
 				return NULL;
 			default:
 				invalid(parser);
-				ast_destroy(scope_node);
 				return NULL;
 		}
+		if(!child)
+			return NULL;
+		vector_aappend(&parser->nodes, child);
 	}
 }
 
 static ASTNode* parse_function(Parser* parser) {
 	int line = parser->tok.line;
-	if(lexer_next(parser->lexer, &parser->tok))
+	if(advance(parser))
 		return NULL;
 
-	char* identifier = parser->tok.data;
+	Symbol identifier = { parser->tok.str, parser->tok.sym };
 	if(expect(parser, TOKEN_IDENTIFIER))
 		return NULL;
 
 	if(expect(parser, TOKEN_BRACKET_OPEN))
 		return NULL;
 
-	Vector_str_t arguments;
-	vector_str_t_ainit(&arguments, 64);
-
+	size_t base = parser->syms.size;
 	while(parser->tok.type != TOKEN_BRACKET_CLOSE) {
-		char* arg = parser->tok.data;
-		if(expect(parser, TOKEN_IDENTIFIER)) {
-			for(size_t i = 0; i < arguments.size; ++i)
-				free(arguments.data[i]);
-			vector_deinit(&arguments);
-			free(identifier);
+		Symbol arg = { parser->tok.str, parser->tok.sym };
+		if(expect(parser, TOKEN_IDENTIFIER))
 			return NULL;
-		}
 
-		vector_aappend(&arguments, arg);
+		vector_aappend(&parser->syms, arg);
 
 		if(parser->tok.type == TOKEN_COMMA)
 			expect(parser, TOKEN_COMMA);
 	}
 
-	if(expect(parser, TOKEN_BRACKET_CLOSE)) {
-		for(size_t i = 0; i < arguments.size; ++i)
-			free(arguments.data[i]);
-		vector_deinit(&arguments);
-		free(identifier);
+	if(expect(parser, TOKEN_BRACKET_CLOSE))
 		return NULL;
-	}
 
-	ASTNode* body = parse_scope(parser);
-	if(!body) {
-		for(size_t i = 0; i < arguments.size; ++i)
-			free(arguments.data[i]);
-		vector_deinit(&arguments);
-		free(identifier);
-		return NULL;
+	SymbolList arguments = pop_syms(parser, base);
+	ASTNode* body = NULL;
+	str_t source = { NULL, 0 };
+	int body_line = parser->tok.line;
+	if(parser->lazy && !parser->tokens) {
+		// The '{' is the last thing the lexer went past
+		const char* begin = parser->lexer->data - 1;
+		if(parser->tok.type != TOKEN_CURLY_OPEN) {
+			unexpected(parser, TOKEN_CURLY_OPEN);
+			return NULL;
+		}
+		if(lexer_skip_block(parser->lexer)) {
+			parser->tok = (Token){ .type = TOKEN_EOF, .line = parser->lexer->line };
+			unexpected(parser, TOKEN_CURLY_CLOSE);
+			return NULL;
+		}
+		source = (str_t){ begin, parser->lexer->data - begin };
+		if(advance(parser))
+			return NULL;
+	}
+	else {
+		body = parse_scope(parser);
+		if(!body)
+			return NULL;
 	}
 
-	ASTNode* fun_node = ast_create_node((ASTNode){
+	ASTNode* fun_node = ast_create_node(&parser->arena, (ASTNode){
 		.type = NODE_FUN_STATEMENT,
 		.line = line,
 		.fun = {
 			.identifier = identifier,
 			.arguments = arguments,
-			.body = body
+			.body = body,
+			.source = source,
+			.body_line = body_line
 		}
 	});
 	return fun_node;
 }
 
+int parser_parse_body(Parser* parser, ASTNode* fun) {
+	assert(fun->type == NODE_FUN_STATEMENT && !fun->fun.body);
+	str_t source = fun->fun.source;
+	lexer_seek(parser->lexer, source.data, source.data + source.len, fun->fun.body_line);
+	if(advance(parser))
+		return 1;
+	fun->fun.body = parse_scope(parser);
+	if(!fun->fun.body)
+		return 1;
+	if(parser->lexer->ctx->print_ast)
+		ast_print_node(fun, 1);
+	return 0;
+}
+
 ASTNode* parser_parse(Parser* parser) {
-	ASTNode* root = ast_create_node((ASTNode){
+	ASTNode* root = ast_create_node(&parser->arena, (ASTNode){
 		.type = NODE_SCOPE,
 		.scope = {
 			0,
@@ -393,70 +469,50 @@ ASTNode* parser_parse(Parser* parser) {
 		}
 	});
 
-	if(lexer_next(parser->lexer, &parser->tok)) {
-		ast_destroy(root);
+	if(advance(parser))
 		return NULL;
-	}
 
-	for(;;) {
+	size_t base = parser->nodes.size;
+	while(parser->tok.type != TOKEN_EOF) {
+		ASTNode* child;
 		switch(parser->tok.type) {
-			case TOKEN_EOF:
-				goto out;
 			case TOKEN_IDENTIFIER:
 			case TOKEN_INT_LITERAL:
-			case TOKEN_STR_LITERAL: {
-				ASTNode* expr_node = parse_expr(parser);
-				if(!expr_node) {
-					ast_destroy(root);
-					root = NULL;
-					goto out;
-				}
-				scope_append(root, expr_node);
+			case TOKEN_STR_LITERAL:
+				child = parse_expr(parser);
 				break;
-			}
 			case TOKEN_SEMICOLON:
-				if(lexer_next(parser->lexer, &parser->tok)) {
-					ast_destroy(root);
-					root = NULL;
-					goto out;
-				}
-				break;
-			case TOKEN_FUNCTION: {
-				ASTNode* fun_node = parse_function(parser);
-				if(!fun_node) {
-					ast_destroy(root);
-					root = NULL;
-					goto out;
-				}
-				scope_append(root, fun_node);
+				if(advance(parser))
+					return NULL;
+				continue;
+			case TOKEN_FUNCTION:
+				child = parse_function(parser);
 				break;
-			}
-			case TOKEN_VAR: {
-				ASTNode* var_node = parse_var(parser);
-				if(!var_node) {
-					ast_destroy(root);
-					root = NULL;
-					goto out;
-				}
-				scope_append(root, var_node);
+			case TOKEN_VAR:
+				child = parse_var(parser);
 				break;
-			}
 			default:
 				invalid(parser);
-				ast_destroy(root);
-				root = NULL;
-				goto out;
+				return NULL;
 		}
+		if(!child)
+			return NULL;
+		vector_aappend(&parser->nodes, child);
 	}
 
-out:
-	if(!root) {
-		lexer_destroy_token(&parser->tok);
-		return NULL;
-	}
+	ASTNodeList nodes = pop_nodes(parser, base);
+	root->scope.n_nodes = nodes.size;
+	root->scope.nodes = nodes.data;
 
 	if(parser->lexer->ctx->print_ast)
 		ast_print_node(root, 1);
 
 	return root;
 }
+
+ASTNode* parser_parse_tokens(Parser* parser, const Token* tokens) {
+	parser->tokens = tokens;
+	ASTNode* root = parser_parse(parser);
+	parser->tokens = NULL;
+	return root;
+}
@@ -4,12 +4,61 @@
 #include "lexer.h"
 #include "ast.h"
 
+// Operator, assignment or call still waiting for operands in parse_expr
+typedef struct {
+	enum {
+		FRAME_BIN_OP,
+		FRAME_ASSIGNMENT,
+		FRAME_CALL
+	} type;
+	// The assignment or call being built
+	ASTNode* node;
+	int op;
+	// Where a call's arguments start in Parser::nodes
+	size_t base;
+} ExprFrame;
+#ifndef VECTOR_DEFINED_ExprFrame
+#define VECTOR_DEFINED_ExprFrame
+VECTOR_DEFINE(ExprFrame)
+#endif
+
 typedef struct {
 	Lexer* lexer;
 	Token tok;
+	// Owns every node parser_parse returns
+	Arena arena;
+	// Children of the scopes, calls and parameter lists still being
+	// parsed. Each one is copied into the arena once it's complete.
+	Vector_ASTNode_ptr_t nodes;
+	Vector_Symbol syms;
+	Vector_ExprFrame frames;
+	// Set while parsing a buffered token list
+	const Token* tokens;
+	// Skip function bodies, leaving them for parser_parse_body. Has no
+	// effect on buffered token lists.
+	char lazy;
 } Parser;
 
 int parser_init(Parser* parser, Lexer* lexer);
+// Frees the AST along with the parser
+void parser_deinit(Parser* parser);
 ASTNode* parser_parse(Parser* parser);
+// Parses a list of tokens ending in TOKEN_EOF instead of pulling them
+// from the lexer. Identifiers and string literals in the list must stay
+// valid until the tree is done with.
+ASTNode* parser_parse_tokens(Parser* parser, const Token* tokens);
+// Parses the body of a function that was skipped over. The lexer is
+// moved to the body's source, which has to be the one parsed before.
+int parser_parse_body(Parser* parser, ASTNode* fun);
+// Frees every tree parsed so far, keeping the parser usable
+void parser_reset(Parser* parser);
+
+// Token handling for front ends that follow the grammar without building
+// a tree. Errors are reported the same way the parser reports them.
+int parser_advance(Parser* parser);
+int parser_expect(Parser* parser, TokenType expected);
+int parser_expect_silent(Parser* parser, TokenType expected);
+void parser_unexpected(Parser* parser, TokenType expected);
+void parser_invalid(Parser* parser);
 
 #endif
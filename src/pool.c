@@ -0,0 +1,77 @@
+#include <silk.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "vm.h"
+
+struct Silk_VMPool {
+	pthread_mutex_t lock;
+	Silk_VM** idle;
+	size_t n_idle;
+	size_t capacity;
+};
+
+Silk_VM* silk_vm_create(void) {
+	Silk_VM* vm = malloc(sizeof(Silk_VM));
+	if(!vm)
+		return NULL;
+	vm_init(vm);
+	return vm;
+}
+
+void silk_vm_free(Silk_VM* vm) {
+	if(!vm)
+		return;
+	vm_deinit(vm);
+	free(vm);
+}
+
+Silk_VMPool* silk_vm_pool_create(void) {
+	Silk_VMPool* pool = malloc(sizeof(Silk_VMPool));
+	if(!pool)
+		return NULL;
+	if(pthread_mutex_init(&pool->lock, NULL)) {
+		free(pool);
+		return NULL;
+	}
+	pool->idle = NULL;
+	pool->n_idle = 0;
+	pool->capacity = 0;
+	return pool;
+}
+
+Silk_VM* silk_vm_pool_acquire(Silk_VMPool* pool) {
+	pthread_mutex_lock(&pool->lock);
+	Silk_VM* vm = pool->n_idle ? pool->idle[--pool->n_idle] : NULL;
+	pthread_mutex_unlock(&pool->lock);
+	return vm ? vm : silk_vm_create();
+}
+
+void silk_vm_pool_release(Silk_VMPool* pool, Silk_VM* vm) {
+	if(!vm)
+		return;
+	pthread_mutex_lock(&pool->lock);
+	if(pool->n_idle == pool->capacity) {
+		size_t capacity = pool->capacity ? pool->capacity * 2 : 16;
+		Silk_VM** idle = realloc(pool->idle, sizeof(Silk_VM*) * capacity);
+		if(!idle) {
+			// Can't keep it, so let it go
+			pthread_mutex_unlock(&pool->lock);
+			silk_vm_free(vm);
+			return;
+		}
+		pool->idle = idle;
+		pool->capacity = capacity;
+	}
+	pool->idle[pool->n_idle++] = vm;
+	pthread_mutex_unlock(&pool->lock);
+}
+
+void silk_vm_pool_free(Silk_VMPool* pool) {
+	if(!pool)
+		return;
+	for(size_t i = 0; i < pool->n_idle; ++i)
+		silk_vm_free(pool->idle[i]);
+	free(pool->idle);
+	pthread_mutex_destroy(&pool->lock);
+	free(pool);
+}
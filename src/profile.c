@@ -0,0 +1,87 @@
+#ifndef SILK_NO_PROFILE
+
+#include "profile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROFILE_TOP_PAIRS 10
+
+int profile_init(Profile* prof, size_t n_functions, size_t max_depth) {
+	memset(prof, 0, sizeof(Profile));
+	prof->prev_op = -1;
+	prof->calls = calloc(n_functions, sizeof(uint64_t));
+	prof->inclusive = calloc(n_functions, sizeof(uint64_t));
+	prof->exclusive = calloc(n_functions, sizeof(uint64_t));
+	prof->frames = malloc(sizeof(ProfileFrame) * max_depth);
+	if(!prof->calls || !prof->inclusive || !prof->exclusive || !prof->frames) {
+		profile_deinit(prof);
+		return 1;
+	}
+	prof->n_functions = n_functions;
+	prof->max_depth = max_depth;
+	return 0;
+}
+
+void profile_deinit(Profile* prof) {
+	free(prof->calls);
+	free(prof->inclusive);
+	free(prof->exclusive);
+	free(prof->frames);
+	prof->calls = NULL;
+	prof->inclusive = NULL;
+	prof->exclusive = NULL;
+	prof->frames = NULL;
+}
+
+// Charges the last instruction and closes the frames still open at exit
+void profile_finish(Profile* prof) {
+	if(prof->prev_op >= 0)
+		prof->cycles[prof->prev_op] += profile_now() - prof->last;
+	prof->prev_op = -1;
+	while(prof->depth)
+		profile_ret(prof);
+}
+
+void profile_print(Profile* prof, FunctionInfo* functions, size_t n_functions) {
+	puts("----- opcodes -----");
+	printf("%-20s %12s %14s %10s\n", "opcode", "count", "cycles", "cycles/op");
+	for(int i = 0; i < N_INSTRUCTIONS; ++i) {
+		if(!prof->counts[i])
+			continue;
+		printf("%-20s %12lu %14lu %10.1f\n", instruction_type_to_str(i), prof->counts[i],
+			prof->cycles[i], (double) prof->cycles[i] / prof->counts[i]);
+	}
+
+	puts("----- functions -----");
+	printf("%-8s %-10s %12s %14s %14s\n", "index", "start", "calls", "inclusive", "exclusive");
+	for(size_t i = 0; i < n_functions && i < prof->n_functions; ++i) {
+		if(!prof->calls[i])
+			continue;
+		printf("%-8zu %-10zu %12lu %14lu %14lu\n", i, functions[i].start_addr,
+			prof->calls[i], prof->inclusive[i], prof->exclusive[i]);
+	}
+
+	puts("----- pairs -----");
+	// Selection of the most frequent pairs, marking each one as it's printed
+	uint8_t printed[N_INSTRUCTIONS][N_INSTRUCTIONS];
+	memset(printed, 0, sizeof(printed));
+	for(int n = 0; n < PROFILE_TOP_PAIRS; ++n) {
+		int best_first = -1;
+		int best_second = -1;
+		for(int i = 0; i < N_INSTRUCTIONS; ++i)
+			for(int j = 0; j < N_INSTRUCTIONS; ++j)
+				if(prof->pairs[i][j] && !printed[i][j] && (best_first < 0 ||
+					prof->pairs[i][j] > prof->pairs[best_first][best_second])) {
+					best_first = i;
+					best_second = j;
+				}
+		if(best_first < 0)
+			break;
+		printed[best_first][best_second] = 1;
+		printf("%-20s %-20s %12lu\n", instruction_type_to_str(best_first),
+			instruction_type_to_str(best_second), prof->pairs[best_first][best_second]);
+	}
+}
+
+#endif
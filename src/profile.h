@@ -0,0 +1,82 @@
+#ifndef _PROFILE_H_
+#define _PROFILE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "instruction.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+
+typedef struct {
+	size_t function;
+	uint64_t start;
+	uint64_t children;
+} ProfileFrame;
+
+// Filled in by vm_run_profiled. Times are in TSC cycles on x86 and clock()
+// ticks elsewhere.
+typedef struct {
+	uint64_t counts[N_INSTRUCTIONS];
+	uint64_t cycles[N_INSTRUCTIONS];
+	uint64_t pairs[N_INSTRUCTIONS][N_INSTRUCTIONS];
+	int prev_op;
+	uint64_t last;
+
+	// Indexed like the FunctionInfo table
+	uint64_t* calls;
+	uint64_t* inclusive;
+	uint64_t* exclusive;
+	size_t n_functions;
+
+	ProfileFrame* frames;
+	size_t depth;
+	size_t max_depth;
+} Profile;
+
+int profile_init(Profile* prof, size_t n_functions, size_t max_depth);
+void profile_deinit(Profile* prof);
+void profile_finish(Profile* prof);
+void profile_print(Profile* prof, FunctionInfo* functions, size_t n_functions);
+
+static inline uint64_t profile_now(void) {
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return clock();
+#endif
+}
+
+static inline void profile_op(Profile* prof, InstructionType op) {
+	uint64_t now = profile_now();
+	if(prof->prev_op >= 0) {
+		prof->cycles[prof->prev_op] += now - prof->last;
+		++prof->pairs[prof->prev_op][op];
+	}
+	++prof->counts[op];
+	prof->prev_op = op;
+	prof->last = now;
+}
+
+static inline void profile_call(Profile* prof, size_t function) {
+	if(prof->depth >= prof->max_depth)
+		return;
+	prof->frames[prof->depth++] = (ProfileFrame){ function, profile_now(), 0 };
+	++prof->calls[function];
+}
+
+static inline void profile_ret(Profile* prof) {
+	if(!prof->depth)
+		return;
+	ProfileFrame* frame = &prof->frames[--prof->depth];
+	uint64_t elapsed = profile_now() - frame->start;
+	prof->inclusive[frame->function] += elapsed;
+	prof->exclusive[frame->function] += elapsed - frame->children;
+	if(prof->depth)
+		prof->frames[prof->depth - 1].children += elapsed;
+}
+
+#endif
@@ -8,114 +8,519 @@
 #include <stdlib.h>
 
 #include "parser.h"
+#include "emit.h"
 #include "vm.h"
+#include "optimizer.h"
+#include "jit.h"
+#include "cache.h"
 
-static int map_file(const char* filename, char** mem, size_t* file_size) {
-	int fd = open(filename, O_RDONLY);
-	if(fd == -1)
-		return -1;
-
+static int map_file(int fd, char** mem, size_t* file_size) {
 	struct stat st;
 	if(fstat(fd, &st) == -1)
-		goto error;
+		return 1;
+	// Pipes, sockets and the like can't be mapped, and neither can an
+	// empty file
+	if(!S_ISREG(st.st_mode) || !st.st_size)
+		return 1;
 	*file_size = st.st_size;
 
 	*mem = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
-	if(*mem == MAP_FAILED)
-		goto error;
-
-	return fd;
+	return *mem == MAP_FAILED;
+}
 
-error:
-	close(fd);
-	return -1;
+static inline int intlen(size_t i) {
+	int len = 1;
+	while(i > 9) {
+		++len;
+		i /= 10;
+	}
+	return len;
 }
 
-int silk_run_file(Silk_Ctx* ctx, const char* filename) {
-	char* file;
-	size_t size;
-	int fd = map_file(filename, &file, &size);
-	if(fd == -1)
-		return 1;
+// What a lazy run needs to compile functions as they're first called.
+// functions[i] is the tree of table entry i + 1.
+typedef struct {
+	Parser* parser;
+	Resolver* res;
+	Vector_ASTNode_ptr_t* functions;
+} LazyCode;
 
-	if(!ctx->filename)
-		ctx->filename = filename;
+static int run_lazy(Silk_Ctx* ctx, LazyCode* lazy, VM* vm, Vector_Instruction* insts,
+	Vector_FunctionInfo* funcs) {
+	int ret;
+	while((ret = vm_run(vm, insts->data, insts->size, funcs->data, funcs->size)) == VM_MISSING_FUNCTION) {
+		ASTNode* fun = lazy->functions->data[vm->missing - 1];
+		if(parser_parse_body(lazy->parser, fun) ||
+			resolver_reserve(lazy->res, lazy->parser->lexer->symbols.size))
+			return 1;
+		ast_fold_statement(fun);
 
-	int ret = silk_run(ctx, file, file + size);
-	close(fd);
+		size_t begin = insts->size;
+		if(ast_compile_function(ctx, lazy->res, insts, funcs, fun, vm->missing))
+			return 1;
+		optimizer_run_tail(insts, begin);
 
+		if(ctx->print_bytecode) {
+			for(size_t i = begin; i < insts->size; ++i) {
+				printf("%*zu: ", intlen(insts->size), i);
+				instruction_print(&insts->data[i]);
+			}
+			printf("%*zu: ", intlen(funcs->size), vm->missing);
+			function_info_print(&funcs->data[vm->missing]);
+			puts("-----");
+		}
+	}
 	return ret;
 }
 
-int silk_run_string(Silk_Ctx* ctx, const char* js_data) {
-	size_t len = strlen(js_data);
-	return silk_run(ctx, js_data, js_data + len);
+struct Silk_Program {
+	Vector_Instruction instructions;
+	Vector_FunctionInfo functions;
+	// Filled in when compiled with compact_bytecode
+	PackedCode packed;
+	size_t n_folded;
+	size_t n_removed;
+	// The mapping the code lives in when it came from a cache file
+	Cache cache;
+	// What errors call the program when the ctx running it has no
+	// filename. Only set on programs silk_compile hands out.
+	char* name;
+};
+
+static void program_deinit(Silk_Program* program) {
+	if(program->cache.map)
+		cache_unload(&program->cache);
+	else {
+		vector_deinit(&program->instructions);
+		vector_deinit(&program->functions);
+	}
+	bytecode_deinit(&program->packed);
 }
 
-static inline int intlen(size_t i) {
-	int len = 1;
-	while(i > 9) {
-		++len;
-		i /= 10;
+// Runs compiled code on vm in whichever way ctx asks for. lazy is NULL
+// unless there are functions left to compile, and only then is program
+// changed.
+static int execute(Silk_Ctx* ctx, Silk_Program* program, LazyCode* lazy, VM* vm) {
+	Vector_Instruction* insts = &program->instructions;
+	Vector_FunctionInfo* funcs = &program->functions;
+	int ret = 1;
+	PackedCode local = { 0 };
+	PackedCode* packed = &program->packed;
+	if(ctx->compact_bytecode && !lazy && !packed->code) {
+		if(bytecode_pack(&local, insts->data, insts->size, funcs->data, funcs->size))
+			return 1;
+		packed = &local;
 	}
-	return len;
+
+	// Top-level expression statements leave their values on the stack and
+	// globals live in the first frame, so both grow with the script size
+	vm_reset(vm);
+	if(vm_reserve(vm, ctx, funcs->data[0].max_stack, funcs->data[0].n_locals))
+		goto free_packed;
+
+	if(ctx->print_bytecode) {
+		if(ctx->compact_bytecode && !lazy)
+			bytecode_print(packed);
+		else
+			for(size_t i = 0; i < insts->size; ++i) {
+				printf("%*zu: ", intlen(insts->size), i);
+				instruction_print(&insts->data[i]);
+			}
+		puts("-----");
+		for(size_t i = 0; i < funcs->size; ++i) {
+			printf("%*zu: ", intlen(funcs->size), i);
+			function_info_print(&funcs->data[i]);
+		}
+		printf("-----\nconstant folding: %zu nodes folded\n", program->n_folded);
+		printf("peephole: %zu instructions removed\n", program->n_removed);
+		printf("size: %zu bytes as Instruction", insts->size * sizeof(Instruction));
+		if(ctx->compact_bytecode && !lazy)
+			printf(", %zu bytes packed", packed->size);
+		putchar('\n');
+		if(lazy)
+			puts("-----");
+	}
+
+	// The JIT falls back to the interpreter for anything it can't handle.
+	// Profiling always runs the plain instruction loop.
+	JitCode jit;
+	int failed;
+#ifndef SILK_NO_PROFILE
+	Profile prof;
+#endif
+	if(lazy)
+		failed = run_lazy(ctx, lazy, vm, insts, funcs);
+#ifndef SILK_NO_PROFILE
+	else if(ctx->profile) {
+		if(profile_init(&prof, funcs->size, vm->call_stack.capacity))
+			goto free_packed;
+		failed = vm_run_profiled(vm, insts->data, insts->size, funcs->data, funcs->size, &prof);
+		if(!failed)
+			profile_print(&prof, funcs->data, funcs->size);
+		profile_deinit(&prof);
+	}
+#endif
+	else if(ctx->jit && !jit_compile(&jit, insts->data, insts->size, funcs->data, funcs->size)) {
+		failed = jit_run(&jit, vm, funcs->data, funcs->size);
+		jit_free(&jit);
+	}
+	else if(ctx->compact_bytecode)
+		failed = vm_run_packed(vm, packed, funcs->data, funcs->size);
+	else
+		failed = vm_run(vm, insts->data, insts->size, funcs->data, funcs->size);
+	if(failed == VM_STACK_OVERFLOW && ctx->print_errors)
+		printf("%s: error: stack overflow\n", ctx->filename);
+	if(failed)
+		goto free_packed;
+
+	if(ctx->print_stack_on_exit) {
+		puts("-----");
+		size_t sz = vm->operand_stack.sp;
+		for(size_t i = 0; i < vm->operand_stack.sp; ++i)
+			printf("%ld\n", vm->operand_stack.data[sz - i - 1]);
+		puts("-----");
+	}
+	ret = 0;
+
+free_packed:
+	bytecode_deinit(&local);
+	return ret;
 }
 
-int silk_run(Silk_Ctx* ctx, const char* js_data, const char* js_data_end) {
-	if(!ctx->filename)
-		ctx->filename = "(unnamed)";
+// The VM a run goes on: one checked out of ctx's pool if it has one,
+// ctx's own otherwise. A ctx that has neither gets a VM for the run.
+static VM* acquire_vm(Silk_Ctx* ctx) {
+	if(ctx->vm_pool)
+		return silk_vm_pool_acquire(ctx->vm_pool);
+	return ctx->vm ? ctx->vm : silk_vm_create();
+}
+
+static void release_vm(Silk_Ctx* ctx, VM* vm) {
+	if(ctx->vm_pool)
+		silk_vm_pool_release(ctx->vm_pool, vm);
+	else if(vm != ctx->vm)
+		silk_vm_free(vm);
+}
+
+static int execute_on_ctx(Silk_Ctx* ctx, Silk_Program* program, LazyCode* lazy) {
+	VM* vm = acquire_vm(ctx);
+	if(!vm)
+		return 1;
+	int ret = execute(ctx, program, lazy, vm);
+	release_vm(ctx, vm);
+	return ret;
+}
 
+// Runs a script whose functions get compiled as they're first called.
+// The tree has to outlive the run, so there's no Silk_Program for it.
+static int run_lazy_source(Silk_Ctx* ctx, const char* js_data, const char* js_data_end) {
 	Lexer lexer;
 	if(lexer_init(&lexer, ctx, js_data, js_data_end))
 		return 1;
 
 	Parser parser;
-	if(parser_init(&parser, &lexer))
+	if(parser_init(&parser, &lexer)) {
+		lexer_deinit(&lexer);
 		return 1;
+	}
+	parser.lazy = 1;
+
+	int ret = 1;
+	Silk_Program program = { 0 };
+	vector_Instruction_ainit(&program.instructions, 64);
+	vector_FunctionInfo_ainit(&program.functions, 16);
+	Resolver res;
+	Vector_ASTNode_ptr_t functions;
+	vector_ASTNode_ptr_t_ainit(&functions, 16);
+	LazyCode lazy = { &parser, &res, &functions };
 
 	ASTNode* root = parser_parse(&parser);
 	if(!root)
+		goto free_code;
+	program.n_folded = ast_fold_constants(root, lexer.symbols.size);
+	for(size_t i = 0; i < root->scope.n_nodes; ++i)
+		if(root->scope.nodes[i]->type == NODE_FUN_STATEMENT)
+			vector_aappend(&functions, root->scope.nodes[i]);
+	if(resolver_init(&res, lexer.symbols.size, 0))
+		goto free_code;
+	if(!ast_compile_top(ctx, &res, &program.instructions, &program.functions, root)) {
+		program.n_removed = optimizer_run_tail(&program.instructions, 0);
+		ret = execute_on_ctx(ctx, &program, &lazy);
+	}
+	resolver_deinit(&res);
+
+free_code:
+	vector_deinit(&functions);
+	program_deinit(&program);
+	parser_deinit(&parser);
+	lexer_deinit(&lexer);
+	return ret;
+}
+
+// Runs the whole front end and the peephole pass. The tree goes away
+// with the parser before this returns.
+static int compile_program(Silk_Ctx* ctx, const char* js_data, const char* js_data_end,
+	Silk_Program* program) {
+	*program = (Silk_Program){ 0 };
+	Lexer lexer;
+	if(lexer_init(&lexer, ctx, js_data, js_data_end))
 		return 1;
 
-	Vector_Instruction insts;
-	vector_Instruction_ainit(&insts, 64);
-	if(ast_compile(ctx, &insts, root)) {
-		ast_destroy(root);
-		vector_deinit(&insts);
+	Parser parser;
+	if(parser_init(&parser, &lexer)) {
+		lexer_deinit(&lexer);
 		return 1;
 	}
 
-	VM vm;
-	if(vm_init(&vm, 64, 64)) {
-		ast_destroy(root);
-		vector_deinit(&insts);
+	int ret = 1;
+	vector_Instruction_ainit(&program->instructions, 64);
+	vector_FunctionInfo_ainit(&program->functions, 16);
+	if(ctx->single_pass) {
+		if(emit_program(&parser, &program->instructions, &program->functions, &program->n_folded))
+			goto quit;
+	}
+	else {
+		ASTNode* root = parser_parse(&parser);
+		if(!root)
+			goto quit;
+		program->n_folded = ast_fold_constants(root, lexer.symbols.size);
+		if(ast_compile(ctx, &program->instructions, &program->functions, root, lexer.symbols.size))
+			goto quit;
 	}
+	program->n_removed = optimizer_run(&program->instructions, &program->functions);
+	if(ctx->compact_bytecode && bytecode_pack(&program->packed, program->instructions.data,
+		program->instructions.size, program->functions.data, program->functions.size))
+		goto quit;
+	ret = 0;
 
-	if(ctx->print_bytecode) {
-		for(size_t i = 0; i < insts.size; ++i) {
-			printf("%*zu: ", intlen(insts.size), i);
-			instruction_print(&insts.data[i]);
+quit:
+	parser_deinit(&parser);
+	lexer_deinit(&lexer);
+	if(ret)
+		program_deinit(program);
+	return ret;
+}
+
+// Loads the code cached for a script at <filename>.silkc. With
+// `compile` set, a missing or stale cache gets replaced by a fresh
+// compile. Returns 1 when there's no program, 2 when only because the
+// cache didn't match and `compile` was unset.
+static int load_program(Silk_Ctx* ctx, const char* filename, const char* js_data, size_t size,
+	int compile, Silk_Program* program) {
+	size_t len = strlen(filename);
+	char* path = malloc(len + sizeof(CACHE_SUFFIX));
+	if(!path)
+		return 1;
+	memcpy(path, filename, len);
+	memcpy(path + len, CACHE_SUFFIX, sizeof(CACHE_SUFFIX));
+
+	int ret = 0;
+	uint64_t hash = cache_hash(js_data, size);
+	*program = (Silk_Program){ 0 };
+	if(!cache_load(&program->cache, path, hash, size)) {
+		Cache* cache = &program->cache;
+		program->instructions = (Vector_Instruction){
+			.data = cache->instructions,
+			.capacity = cache->n_instructions,
+			.size = cache->n_instructions
+		};
+		program->functions = (Vector_FunctionInfo){
+			.data = cache->functions,
+			.capacity = cache->n_functions,
+			.size = cache->n_functions
+		};
+		program->n_folded = cache->n_folded;
+		program->n_removed = cache->n_removed;
+		if(ctx->compact_bytecode && bytecode_pack(&program->packed, cache->instructions,
+			cache->n_instructions, cache->functions, cache->n_functions)) {
+			program_deinit(program);
+			ret = 1;
 		}
 	}
+	else if(!compile)
+		ret = 2;
+	else if(compile_program(ctx, js_data, js_data + size, program))
+		ret = 1;
+	else {
+		// A cache that can't be written only costs the next run a compile
+		Vector_Instruction* insts = &program->instructions;
+		Vector_FunctionInfo* funcs = &program->functions;
+		cache_save(path, hash, size, insts->data, insts->size, funcs->data, funcs->size,
+			program->n_folded, program->n_removed);
+	}
+	free(path);
+	return ret;
+}
+
+// Runs work on a copy of the caller's ctx with the filename filled in,
+// so the caller's is only ever read and can be shared between threads
+static Silk_Ctx named(const Silk_Ctx* ctx, const char* filename) {
+	Silk_Ctx copy = *ctx;
+	if(!copy.filename)
+		copy.filename = filename;
+	return copy;
+}
 
-	if(vm_run(&vm, insts.data, insts.size)) {
-		vm_deinit(&vm);
-		ast_destroy(root);
-		vector_deinit(&insts);
+int silk_run(Silk_Ctx* ctx, const char* js_data, const char* js_data_end) {
+	Silk_Ctx run = named(ctx, "(unnamed)");
+	ctx = &run;
+	if(ctx->lazy)
+		return run_lazy_source(ctx, js_data, js_data_end);
+
+	Silk_Program program;
+	if(compile_program(ctx, js_data, js_data_end, &program))
 		return 1;
+	int ret = execute_on_ctx(ctx, &program, NULL);
+	program_deinit(&program);
+	return ret;
+}
+
+int silk_run_string(Silk_Ctx* ctx, const char* js_data) {
+	size_t len = strlen(js_data);
+	return silk_run(ctx, js_data, js_data + len);
+}
+
+int silk_run_file(Silk_Ctx* ctx, const char* filename) {
+	int fd = open(filename, O_RDONLY);
+	if(fd == -1)
+		return 1;
+
+	Silk_Ctx run = named(ctx, filename);
+	ctx = &run;
+
+	char* file;
+	size_t size;
+	int ret;
+	if(map_file(fd, &file, &size))
+		ret = silk_run_fd(ctx, fd);
+	else if(ctx->bytecode_cache) {
+		// Lazy runs use a cache but don't compile everything to make one
+		Silk_Program program;
+		ret = load_program(ctx, filename, file, size, !ctx->lazy, &program);
+		if(!ret) {
+			ret = execute_on_ctx(ctx, &program, NULL);
+			program_deinit(&program);
+		}
+		else if(ret == 2)
+			ret = silk_run(ctx, file, file + size);
+		munmap(file, size);
+	}
+	else {
+		ret = silk_run(ctx, file, file + size);
+		munmap(file, size);
 	}
+	close(fd);
 
-	if(ctx->print_stack_on_exit) {
-		puts("-----");
-		size_t sz = vm.operand_stack.sp;
-		for(size_t i = 0; i < vm.operand_stack.sp; ++i)
-			printf("%ld\n", vm.operand_stack.data[sz - i - 1]);
-		puts("-----");
+	return ret;
+}
+
+// Keeps a copy of name in a program that's been compiled, freeing the
+// program if that fails
+static Silk_Program* name_program(Silk_Program* program, const char* name) {
+	size_t len = strlen(name) + 1;
+	program->name = malloc(len);
+	if(!program->name) {
+		program_deinit(program);
+		free(program);
+		return NULL;
 	}
+	memcpy(program->name, name, len);
+	return program;
+}
 
-	vm_deinit(&vm);
-	ast_destroy(root);
-	vector_deinit(&insts);
+Silk_Program* silk_compile(Silk_Ctx* ctx, const char* js_data, const char* js_data_end) {
+	Silk_Ctx run = named(ctx, "(unnamed)");
+	ctx = &run;
+	Silk_Program* program = malloc(sizeof(Silk_Program));
+	if(!program)
+		return NULL;
+	if(compile_program(ctx, js_data, js_data_end, program)) {
+		free(program);
+		return NULL;
+	}
+	return name_program(program, ctx->filename);
+}
+
+// Reads what can't be mapped, like a pipe, into memory
+static char* read_all(int fd, size_t* size) {
+	size_t capacity = 64 * 1024;
+	char* data = malloc(capacity);
+	*size = 0;
+	while(data) {
+		if(*size == capacity) {
+			char* grown = realloc(data, capacity * 2);
+			if(!grown)
+				break;
+			data = grown;
+			capacity *= 2;
+		}
+		ssize_t got = read(fd, data + *size, capacity - *size);
+		if(got == 0)
+			return data;
+		if(got < 0)
+			break;
+		*size += got;
+	}
+	free(data);
+	return NULL;
+}
+
+Silk_Program* silk_compile_file(Silk_Ctx* ctx, const char* filename) {
+	int fd = open(filename, O_RDONLY);
+	if(fd == -1)
+		return NULL;
+
+	Silk_Ctx run = named(ctx, filename);
+	ctx = &run;
+
+	Silk_Program* program = malloc(sizeof(Silk_Program));
+	if(!program) {
+		close(fd);
+		return NULL;
+	}
+
+	char* file;
+	size_t size;
+	int failed;
+	if(!map_file(fd, &file, &size)) {
+		if(ctx->bytecode_cache)
+			failed = load_program(ctx, filename, file, size, 1, program);
+		else
+			failed = compile_program(ctx, file, file + size, program);
+		munmap(file, size);
+	}
+	else if((file = read_all(fd, &size))) {
+		failed = compile_program(ctx, file, file + size, program);
+		free(file);
+	}
+	else
+		failed = 1;
+	close(fd);
+
+	if(failed) {
+		free(program);
+		return NULL;
+	}
+	return name_program(program, ctx->filename);
+}
+
+int silk_program_run(Silk_Ctx* ctx, const Silk_Program* program) {
+	Silk_Ctx run = named(ctx, program->name);
+	// Nothing gets written through the copy
+	Silk_Program view = *program;
+	return execute_on_ctx(&run, &view, NULL);
+}
+
+int silk_program_run_on(Silk_Ctx* ctx, const Silk_Program* program, Silk_VM* vm) {
+	Silk_Ctx run = named(ctx, program->name);
+	Silk_Program view = *program;
+	return execute(&run, &view, NULL, vm);
+}
 
-	return 0;
+void silk_program_free(Silk_Program* program) {
+	if(!program)
+		return;
+	program_deinit(program);
+	free(program->name);
+	free(program);
 }
@@ -0,0 +1,21 @@
+#ifndef _STR_H_
+#define _STR_H_
+
+#include <stddef.h>
+#include <string.h>
+
+// A slice of the source text. Tokens and AST nodes point straight into the
+// buffer handed to silk_run, so it has to outlive them.
+typedef struct {
+	const char* data;
+	size_t len;
+} str_t;
+
+#define STR_FMT "%.*s"
+#define STR_ARG(str) (int) (str).len, (str).data
+
+static inline int str_eq(str_t a, str_t b) {
+	return a.len == b.len && !memcmp(a.data, b.data, a.len);
+}
+
+#endif
@@ -0,0 +1,310 @@
+#include <silk.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "parser.h"
+#include "vm.h"
+#include "optimizer.h"
+
+#define STREAM_READ_SIZE (64 * 1024)
+
+#ifndef VECTOR_DEFINED_Token
+#define VECTOR_DEFINED_Token
+VECTOR_DEFINE(Token)
+#endif
+
+#ifndef VECTOR_DEFINED_int64_t
+#define VECTOR_DEFINED_int64_t
+VECTOR_DEFINE(int64_t)
+#endif
+
+struct Silk_Stream {
+	// Copy of the caller's, with the filename filled in
+	Silk_Ctx ctx;
+	Lexer lexer;
+	Parser parser;
+	// The start of a token cut off by the end of the previous chunk,
+	// followed by the current chunk
+	char* buffer;
+	size_t buffer_capacity;
+	// Tokens not parsed yet. Identifiers point into the symbol table and
+	// string literals are copied into `strings`, so neither depends on
+	// the buffer.
+	Vector_Token tokens;
+	Arena strings;
+	// Tokens before this one make up complete top-level statements
+	size_t complete;
+	int depth;
+	Resolver res;
+	// Function bodies. Top-level code is appended to them while it runs.
+	Vector_Instruction code;
+	// Top-level code waiting for the functions it calls
+	Vector_Instruction top;
+	Vector_FunctionInfo infos;
+	// Functions compiled since the last run, in code order
+	Vector_int64_t unsized;
+	size_t printed;
+	VM vm;
+	int failed;
+};
+
+Silk_Stream* silk_stream_open(Silk_Ctx* ctx) {
+	Silk_Stream* stream = calloc(1, sizeof(Silk_Stream));
+	if(!stream)
+		return NULL;
+	stream->ctx = *ctx;
+	if(!stream->ctx.filename)
+		stream->ctx.filename = "(stream)";
+
+	if(lexer_init(&stream->lexer, &stream->ctx, NULL, NULL))
+		goto free_stream;
+	stream->lexer.more = 1;
+	if(parser_init(&stream->parser, &stream->lexer))
+		goto free_lexer;
+	if(resolver_init(&stream->res, 0, 1))
+		goto free_parser;
+	vm_init(&stream->vm);
+
+	arena_init(&stream->strings);
+	vector_Token_ainit(&stream->tokens, 256);
+	vector_Instruction_ainit(&stream->code, 256);
+	vector_Instruction_ainit(&stream->top, 256);
+	vector_FunctionInfo_ainit(&stream->infos, 16);
+	vector_int64_t_ainit(&stream->unsized, 16);
+	return stream;
+
+free_parser:
+	parser_deinit(&stream->parser);
+free_lexer:
+	lexer_deinit(&stream->lexer);
+free_stream:
+	free(stream);
+	return NULL;
+}
+
+// Runs the pending top-level code on the persistent VM, so globals and
+// the operand stack carry over from one run to the next
+static int run(Silk_Stream* stream) {
+	if(!stream->top.size)
+		return 0;
+
+	optimizer_run_tail(&stream->top, 0);
+	size_t begin = stream->code.size;
+	for(size_t i = 0; i < stream->top.size; ++i)
+		vector_aappend(&stream->code, stream->top.data[i]);
+	vector_aappend(&stream->code, ((Instruction){ INST_EXIT, 0 }));
+	stream->top.size = 0;
+
+	FunctionInfo* infos = stream->infos.data;
+	for(size_t i = 0; i < stream->unsized.size; ++i) {
+		FunctionInfo* info = &infos[stream->unsized.data[i]];
+		size_t end = i + 1 < stream->unsized.size
+			? infos[stream->unsized.data[i + 1]].start_addr
+			: begin;
+		info->max_stack = ast_max_stack(stream->code.data, info->start_addr, end, infos);
+	}
+	stream->unsized.size = 0;
+	infos[0].start_addr = begin;
+	infos[0].max_stack = ast_max_stack(stream->code.data, begin, stream->code.size, infos);
+
+	if(stream->ctx.print_bytecode) {
+		for(size_t i = stream->printed; i < stream->code.size; ++i) {
+			printf("%zu: ", i);
+			instruction_print(&stream->code.data[i]);
+		}
+		puts("-----");
+		stream->printed = begin;
+	}
+
+	// Same budget silk_run gives a whole script
+	VM* vm = &stream->vm;
+	int failed = vm_reserve(vm, &stream->ctx, infos[0].max_stack, infos[0].n_locals);
+	if(!failed)
+		failed = vm_run(vm, stream->code.data, stream->code.size, infos, stream->infos.size);
+	if(failed == VM_STACK_OVERFLOW && stream->ctx.print_errors)
+		printf("%s: error: stack overflow\n", stream->ctx.filename);
+	stream->code.size = begin;
+	return failed;
+}
+
+// Parses, compiles and, once nothing is missing, runs the complete
+// statements at the front of the token list
+static int flush(Silk_Stream* stream) {
+	if(!stream->complete)
+		return 0;
+
+	// The parser stops at an EOF token standing in for the first token
+	// that isn't part of a complete statement
+	Vector_Token* tokens = &stream->tokens;
+	vector_aappend(tokens, ((Token){ .type = TOKEN_EOF, .line = stream->lexer.line }));
+	Token saved = tokens->data[stream->complete];
+	tokens->data[stream->complete] = (Token){ .type = TOKEN_EOF, .line = saved.line };
+	ASTNode* root = parser_parse_tokens(&stream->parser, tokens->data);
+	tokens->data[stream->complete] = saved;
+	--tokens->size;
+	if(!root)
+		return 1;
+
+	if(resolver_reserve(&stream->res, stream->lexer.symbols.size))
+		return 1;
+	for(size_t i = 0; i < root->scope.n_nodes; ++i) {
+		ASTNode* node = root->scope.nodes[i];
+		ast_fold_statement(node);
+		size_t begin = stream->code.size;
+		int64_t function;
+		if(ast_compile_statement(&stream->ctx, &stream->res, &stream->top, &stream->code,
+			&stream->infos, node, &function))
+			return 1;
+		if(function >= 0) {
+			optimizer_run_tail(&stream->code, begin);
+			vector_aappend(&stream->unsized, function);
+		}
+	}
+	parser_reset(&stream->parser);
+
+	// Keep the tokens of the statement still coming in, along with their
+	// strings, and let go of the rest
+	size_t rest = tokens->size - stream->complete;
+	memmove(tokens->data, tokens->data + stream->complete, sizeof(Token) * rest);
+	tokens->size = rest;
+	stream->complete = 0;
+	Arena strings;
+	arena_init(&strings);
+	for(size_t i = 0; i < rest; ++i) {
+		Token* tok = &tokens->data[i];
+		if(tok->type != TOKEN_STR_LITERAL || !tok->str.len)
+			continue;
+		tok->str.data = arena_copy(&strings, tok->str.data, tok->str.len);
+		if(!tok->str.data) {
+			arena_deinit(&strings);
+			return 1;
+		}
+	}
+	arena_deinit(&stream->strings);
+	stream->strings = strings;
+
+	if(stream->res.n_unresolved)
+		return 0;
+	return run(stream);
+}
+
+// Lexes as far into the buffer as possible, then handles the statements
+// that are now complete
+static int pump(Silk_Stream* stream) {
+	for(;;) {
+		Token tok;
+		int status = lexer_next(&stream->lexer, &tok);
+		if(status == LEXER_NEED_INPUT)
+			break;
+		if(status)
+			return 1;
+		if(tok.type == TOKEN_EOF) {
+			stream->complete = stream->tokens.size;
+			break;
+		}
+
+		if(tok.type == TOKEN_IDENTIFIER)
+			tok.str = stream->lexer.symbols.names[tok.sym];
+		else if(tok.type == TOKEN_STR_LITERAL && tok.str.len) {
+			tok.str.data = arena_copy(&stream->strings, tok.str.data, tok.str.len);
+			if(!tok.str.data)
+				return 1;
+		}
+		vector_aappend(&stream->tokens, tok);
+
+		// Top-level statements end in a semicolon, or a closing brace
+		// for functions
+		if(tok.type == TOKEN_CURLY_OPEN)
+			++stream->depth;
+		else if(tok.type == TOKEN_CURLY_CLOSE && stream->depth > 0 && !--stream->depth)
+			stream->complete = stream->tokens.size;
+		else if(tok.type == TOKEN_SEMICOLON && !stream->depth)
+			stream->complete = stream->tokens.size;
+	}
+	return flush(stream);
+}
+
+int silk_stream_feed(Silk_Stream* stream, const char* data, size_t size) {
+	if(stream->failed)
+		return 1;
+
+	Lexer* lexer = &stream->lexer;
+	size_t carry = stream->buffer ? (size_t) (lexer->end - lexer->data) : 0;
+	size_t offset = stream->buffer ? (size_t) (lexer->data - stream->buffer) : 0;
+	if(carry + size > stream->buffer_capacity) {
+		size_t capacity = stream->buffer_capacity * 2 > carry + size
+			? stream->buffer_capacity * 2
+			: carry + size;
+		char* buffer = realloc(stream->buffer, capacity);
+		if(!buffer)
+			return stream->failed = 1;
+		stream->buffer = buffer;
+		stream->buffer_capacity = capacity;
+	}
+	memmove(stream->buffer, stream->buffer + offset, carry);
+	memcpy(stream->buffer + carry, data, size);
+	lexer->data = stream->buffer;
+	lexer->end = stream->buffer + carry + size;
+
+	return stream->failed = pump(stream);
+}
+
+int silk_stream_close(Silk_Stream* stream) {
+	int failed = stream->failed;
+	if(!failed) {
+		stream->lexer.more = 0;
+		if(!stream->buffer)
+			stream->lexer.data = stream->lexer.end = "";
+		failed = pump(stream) ||
+			ast_check_resolved(&stream->ctx, &stream->res, &stream->lexer.symbols);
+	}
+
+	VM* vm = &stream->vm;
+	if(!failed && stream->ctx.print_stack_on_exit) {
+		puts("-----");
+		size_t sz = vm->operand_stack.sp;
+		for(size_t i = 0; i < vm->operand_stack.sp; ++i)
+			printf("%ld\n", vm->operand_stack.data[sz - i - 1]);
+		puts("-----");
+	}
+
+	vm_deinit(vm);
+	vector_deinit(&stream->unsized);
+	vector_deinit(&stream->infos);
+	vector_deinit(&stream->top);
+	vector_deinit(&stream->code);
+	vector_deinit(&stream->tokens);
+	arena_deinit(&stream->strings);
+	resolver_deinit(&stream->res);
+	parser_deinit(&stream->parser);
+	lexer_deinit(&stream->lexer);
+	free(stream->buffer);
+	free(stream);
+	return failed;
+}
+
+int silk_run_fd(Silk_Ctx* ctx, int fd) {
+	Silk_Stream* stream = silk_stream_open(ctx);
+	if(!stream)
+		return 1;
+
+	char* chunk = malloc(STREAM_READ_SIZE);
+	int failed = !chunk;
+	while(!failed) {
+		ssize_t n = read(fd, chunk, STREAM_READ_SIZE);
+		if(n < 0 && errno == EINTR)
+			continue;
+		if(n <= 0) {
+			failed = n < 0;
+			break;
+		}
+		failed = silk_stream_feed(stream, chunk, n);
+	}
+	free(chunk);
+
+	if(failed)
+		stream->failed = 1;
+	return silk_stream_close(stream);
+}
@@ -0,0 +1,98 @@
+#include "symbol.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define SYMBOL_INITIAL_SLOTS 256
+
+int symbol_table_init(SymbolTable* table) {
+	arena_init(&table->arena);
+	table->size = 0;
+	table->names_capacity = SYMBOL_INITIAL_SLOTS / 2;
+	table->slots_capacity = SYMBOL_INITIAL_SLOTS;
+	table->names = malloc(sizeof(str_t) * table->names_capacity);
+	table->hashes = malloc(sizeof(uint32_t) * table->names_capacity);
+	table->slots = calloc(table->slots_capacity, sizeof(SymbolId));
+	if(!table->names || !table->hashes || !table->slots) {
+		symbol_table_deinit(table);
+		return 1;
+	}
+	return 0;
+}
+
+void symbol_table_deinit(SymbolTable* table) {
+	arena_deinit(&table->arena);
+	free(table->names);
+	free(table->hashes);
+	free(table->slots);
+	table->names = NULL;
+	table->hashes = NULL;
+	table->slots = NULL;
+	table->size = 0;
+}
+
+// FNV-1a
+static inline uint32_t hash_name(str_t name) {
+	uint32_t hash = 2166136261u;
+	for(size_t i = 0; i < name.len; ++i) {
+		hash ^= (uint8_t) name.data[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+// Keeps the load factor at or below one half
+static int grow(SymbolTable* table) {
+	size_t names_capacity = table->names_capacity * 2;
+	str_t* names = realloc(table->names, sizeof(str_t) * names_capacity);
+	if(!names)
+		return 1;
+	table->names = names;
+	uint32_t* hashes = realloc(table->hashes, sizeof(uint32_t) * names_capacity);
+	if(!hashes)
+		return 1;
+	table->hashes = hashes;
+	table->names_capacity = names_capacity;
+
+	size_t slots_capacity = table->slots_capacity * 2;
+	SymbolId* slots = calloc(slots_capacity, sizeof(SymbolId));
+	if(!slots)
+		return 1;
+	for(size_t id = 0; id < table->size; ++id) {
+		size_t i = table->hashes[id] & (slots_capacity - 1);
+		while(slots[i])
+			i = (i + 1) & (slots_capacity - 1);
+		slots[i] = id + 1;
+	}
+	free(table->slots);
+	table->slots = slots;
+	table->slots_capacity = slots_capacity;
+	return 0;
+}
+
+int symbol_intern(SymbolTable* table, str_t name, SymbolId* id) {
+	uint32_t hash = hash_name(name);
+	size_t mask = table->slots_capacity - 1;
+	size_t i = hash & mask;
+	for(; table->slots[i]; i = (i + 1) & mask) {
+		SymbolId found = table->slots[i] - 1;
+		if(table->hashes[found] == hash && str_eq(table->names[found], name)) {
+			*id = found;
+			return 0;
+		}
+	}
+
+	if(table->size == table->names_capacity) {
+		if(grow(table))
+			return 1;
+		mask = table->slots_capacity - 1;
+		for(i = hash & mask; table->slots[i]; i = (i + 1) & mask);
+	}
+	const char* copy = name.len ? arena_copy(&table->arena, name.data, name.len) : name.data;
+	if(!copy)
+		return 1;
+	*id = table->size++;
+	table->names[*id] = (str_t){ copy, name.len };
+	table->hashes[*id] = hash;
+	table->slots[i] = *id + 1;
+	return 0;
+}
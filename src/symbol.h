@@ -0,0 +1,38 @@
+#ifndef _SYMBOL_H_
+#define _SYMBOL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "str.h"
+#include "arena.h"
+
+typedef uint32_t SymbolId;
+
+// An identifier as it appears in the source, along with its interned id.
+// Equal names always get the same id, so later passes can index arrays
+// by id instead of comparing strings.
+typedef struct {
+	str_t str;
+	SymbolId id;
+} Symbol;
+
+// Open-addressed hash table from names to ids. Ids are dense, starting
+// at 0 in order of first appearance. Names are copied into the table, so
+// they outlive the buffer they were lexed from.
+typedef struct {
+	Arena arena;
+	str_t* names;
+	uint32_t* hashes;
+	size_t size;
+	size_t names_capacity;
+	// Hold id + 1, with 0 for an empty slot
+	SymbolId* slots;
+	size_t slots_capacity;
+} SymbolTable;
+
+int symbol_table_init(SymbolTable* table);
+void symbol_table_deinit(SymbolTable* table);
+int symbol_intern(SymbolTable* table, str_t name, SymbolId* id);
+
+#endif
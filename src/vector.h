@@ -28,11 +28,12 @@
 \
 	static inline int vector_##type##_append(Vector_##type* vec, type val) { \
 		if(vec->size >= vec->capacity) { \
-			type* reassign = realloc(vec->data, sizeof(type) * (vec->capacity + 20)); \
+			size_t capacity = vec->capacity ? vec->capacity * 2 : 16; \
+			type* reassign = realloc(vec->data, sizeof(type) * capacity); \
 			if(!reassign) \
 				return 1; \
 			vec->data = reassign; \
-			vec->capacity += 20; \
+			vec->capacity = capacity; \
 		} \
 		vec->data[vec->size++] = val; \
 		return 0; \
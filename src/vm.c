@@ -1,183 +1,135 @@
+#define _DEFAULT_SOURCE
 #include "vm.h"
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
 #include <assert.h>
-
-typedef struct {
-	int64_t* data;
-	size_t capacity;
-} VM_LocalsTable;
-
-typedef struct {
-	VM_LocalsTable locals;
-	size_t ret_addr;
-} VM_CallFrame;
-
-static inline int stack_init(VM_Stack* stack, size_t stack_capacity) {
-	assert(sizeof(int64_t) >= sizeof(void*));
-	stack->data = malloc(sizeof(int64_t) * stack_capacity);
-	if(!stack->data)
-		return 1;
-	stack->capacity = stack_capacity;
-	stack->sp = 0;
-	return 0;
-}
-
-static inline void stack_deinit(VM_Stack* stack) {
-	free(stack->data);
-	stack->capacity = 0;
-	stack->sp = 0;
+#include <unistd.h>
+#include <sys/mman.h>
+
+// Stacks are mapped with MAP_NORESERVE, so pages only take memory once
+// a run gets to them, and end in a page that can't be touched, so a
+// missed check crashes instead of writing over whatever comes next
+static size_t region_size(size_t n, size_t size) {
+	size_t page = sysconf(_SC_PAGESIZE);
+	return (n * size + page - 1) / page * page + page;
 }
 
-static inline void stack_push(VM_Stack* stack, int64_t val) {
-	assert(stack->sp < stack->capacity);
-	stack->data[stack->sp++] = val;
-}
-
-static inline int64_t stack_pop(VM_Stack* stack) {
-	assert(stack->sp);
-	return stack->data[--stack->sp];
+static void* region_map(size_t n, size_t size) {
+	if(n > (SIZE_MAX / 2) / size)
+		return NULL;
+	size_t bytes = region_size(n, size);
+	char* region = mmap(NULL, bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if(region == MAP_FAILED)
+		return NULL;
+	if(mprotect(region, bytes - sysconf(_SC_PAGESIZE), PROT_READ | PROT_WRITE)) {
+		munmap(region, bytes);
+		return NULL;
+	}
+	return region;
 }
 
-static inline int64_t stack_peek(VM_Stack* stack) {
-	assert(stack->sp);
-	return stack->data[stack->sp - 1];
+static void region_unmap(void* region, size_t n, size_t size) {
+	if(region)
+		munmap(region, region_size(n, size));
 }
 
-static inline int table_init(VM_LocalsTable* table, size_t table_capacity) {
-	table->data = malloc(sizeof(int64_t) * table_capacity);
-	if(!table->data)
+// Makes region hold at least n entries, keeping the first `keep`. It at
+// least doubles, so top levels that grow a bit at a time don't remap on
+// every run.
+static int region_reserve(void** region, size_t* mapped, size_t n, size_t size, size_t keep) {
+	if(n <= *mapped)
+		return 0;
+	if(n < *mapped * 2)
+		n = *mapped * 2;
+	void* new = region_map(n, size);
+	if(!new)
 		return 1;
-	table->capacity = table_capacity;
+	if(keep)
+		memcpy(new, *region, keep * size);
+	region_unmap(*region, *mapped, size);
+	*region = new;
+	*mapped = n;
 	return 0;
 }
 
-static inline void table_deinit(VM_LocalsTable* table) {
-	free(table->data);
-	table->capacity = 0;
+void vm_init(VM* vm) {
+	memset(vm, 0, sizeof(VM));
 }
 
-static inline int64_t table_get(VM_LocalsTable* table, size_t i) {
-	assert(i < table->capacity);
-	return table->data[i];
-}
-
-static inline void table_put(VM_LocalsTable* table, size_t i, int64_t val) {
-	assert(i < table->capacity);
-	table->data[i] = val;
+void vm_deinit(VM* vm) {
+	region_unmap(vm->operand_stack.data, vm->operand_stack.mapped, sizeof(int64_t));
+	region_unmap(vm->call_stack.frames, vm->call_stack.mapped, sizeof(VM_CallFrame));
+	region_unmap(vm->call_stack.slots, vm->call_stack.slots_mapped, sizeof(int64_t));
+	region_unmap(vm->native_stack, vm->native_mapped, sizeof(int64_t));
+	free(vm->translated);
+	vm_init(vm);
 }
 
-int vm_init(VM* vm, size_t stack_capacity, size_t table_capacity) {
-	if(stack_init(&vm->operand_stack, stack_capacity))
+int vm_reserve_native(VM* vm, void** top) {
+	size_t page = sysconf(_SC_PAGESIZE);
+	// The stack grows down, so the first page guards its far end
+	size_t words = page / sizeof(int64_t) + 2 * vm->call_stack.capacity;
+	size_t mapped = vm->native_mapped;
+	if(region_reserve(&vm->native_stack, &vm->native_mapped, words, sizeof(int64_t), 0))
 		return 1;
-	if(stack_init(&vm->call_stack, stack_capacity)) {
-		stack_deinit(&vm->operand_stack);
+	if(vm->native_mapped != mapped && mprotect(vm->native_stack, page, PROT_NONE)) {
+		region_unmap(vm->native_stack, vm->native_mapped, sizeof(int64_t));
+		vm->native_stack = NULL;
+		vm->native_mapped = 0;
 		return 1;
 	}
-	vm->table_capacity = table_capacity;
+	*top = (char*) vm->native_stack + region_size(vm->native_mapped, sizeof(int64_t)) - page;
 	return 0;
 }
 
-void vm_deinit(VM* vm) {
-	stack_deinit(&vm->operand_stack);
-	stack_deinit(&vm->call_stack);
+void vm_reset(VM* vm) {
+	vm->operand_stack.sp = 0;
+	vm->stopped = 0;
 }
 
-static inline VM_CallFrame* cf_create(size_t table_capacity, size_t ret_addr) {
-	VM_CallFrame* cf = malloc(sizeof(VM_CallFrame));
-	assert(!cf || !table_init(&cf->locals, table_capacity));
-	cf->ret_addr = ret_addr;
-	return cf;
-}
+int vm_reserve(VM* vm, const Silk_Ctx* ctx, size_t top_stack, size_t top_locals) {
+	size_t depth = ctx->call_depth ? ctx->call_depth : SILK_DEFAULT_CALL_DEPTH;
+	size_t size = ctx->stack_size ? ctx->stack_size : SILK_DEFAULT_STACK_SIZE;
+	VM_Stack* stack = &vm->operand_stack;
+	VM_FrameStack* calls = &vm->call_stack;
+	size_t stack_capacity = stack->sp + top_stack + size;
+	size_t slot_capacity = top_locals + size;
+	// The top level takes a frame too
+	size_t frame_capacity = depth + 1;
+	if(stack_capacity < size || slot_capacity < size || !frame_capacity)
+		return 1;
 
-static inline void cf_destroy(VM_CallFrame* cf) {
-	table_deinit(&cf->locals);
-	free(cf);
+	size_t globals = top_locals < calls->slots_mapped ? top_locals : calls->slots_mapped;
+	if(region_reserve((void**) &stack->data, &stack->mapped, stack_capacity, sizeof(int64_t), stack->sp) ||
+		region_reserve((void**) &calls->frames, &calls->mapped, frame_capacity, sizeof(VM_CallFrame), 0) ||
+		region_reserve((void**) &calls->slots, &calls->slots_mapped, slot_capacity, sizeof(int64_t), globals))
+		return 1;
+	stack->capacity = stack_capacity;
+	calls->capacity = frame_capacity;
+	calls->slot_capacity = slot_capacity;
+	return 0;
 }
 
-int vm_run(VM* vm, Instruction* instructions, size_t inst_size) {
-	VM_CallFrame* global_cf = cf_create(vm->table_capacity, 0);
-	stack_push(&vm->call_stack, (int64_t) global_cf);
+#if defined(__GNUC__) && !defined(SILK_SWITCH_DISPATCH)
+#define VM_THREADED_DISPATCH
+#endif
 
-	int64_t val1;
-	int64_t val2;
-	for(size_t pc = 0; pc < inst_size; ++pc) {
-		Instruction* inst = &instructions[pc];
-		VM_CallFrame* current_cf = (VM_CallFrame*) stack_peek(&vm->call_stack);
-		switch(inst->type) {
-			case INST_PUSH:
-				stack_push(&vm->operand_stack, inst->val);
-				break;
-			case INST_POP:
-				stack_pop(&vm->operand_stack);
-				break;
-			case INST_SWAP: {
-				assert(vm->operand_stack.sp > (size_t) inst->val);
-				val1 = vm->operand_stack.data[vm->operand_stack.sp - 1];
-				size_t other_pos = vm->operand_stack.sp - 1 - inst->val;
-				vm->operand_stack.data[vm->operand_stack.sp - 1] = vm->operand_stack.data[other_pos]; 
-				vm->operand_stack.data[other_pos] = val1;
-				break;
-			}
-			case INST_LOAD:
-			case INST_LOAD_GLOBAL: {
-				VM_LocalsTable* locals = inst->type == INST_LOAD
-					? &current_cf->locals
-					: &global_cf->locals;
-				val1 = table_get(locals, inst->val);
-				stack_push(&vm->operand_stack, val1);
-				break;
-			}
-			case INST_STORE:
-			case INST_STORE_GLOBAL: {
-				VM_LocalsTable* locals = inst->type == INST_STORE
-					? &current_cf->locals
-					: &global_cf->locals;
-				val1 = stack_pop(&vm->operand_stack);
-				table_put(locals, inst->val, val1);
-				break;
-			}
-			case INST_EXIT:
-				goto quit;
-			case INST_CALL: {
-				VM_CallFrame* new_cf = cf_create(vm->table_capacity, pc + 1);
-				stack_push(&vm->call_stack, (int64_t) new_cf);
-				pc = inst->val - 1;
-				break;
-			}
-			case INST_RET: {
-				VM_CallFrame* old_cf = (VM_CallFrame*) stack_pop(&vm->call_stack);
-				pc = old_cf->ret_addr - 1;
-				cf_destroy(old_cf);
-				break;
-			}
-			case INST_SUM:
-				val1 = stack_pop(&vm->operand_stack);
-				val2 = stack_pop(&vm->operand_stack);
-				stack_push(&vm->operand_stack, val2 + val1);
-				break;
-			case INST_SUB:
-				val1 = stack_pop(&vm->operand_stack);
-				val2 = stack_pop(&vm->operand_stack);
-				stack_push(&vm->operand_stack, val2 - val1);
-				break;
-			case INST_MUL:
-				val1 = stack_pop(&vm->operand_stack);
-				val2 = stack_pop(&vm->operand_stack);
-				stack_push(&vm->operand_stack, val2 * val1);
-				break;
-			case INST_DIV:
-				val1 = stack_pop(&vm->operand_stack);
-				val2 = stack_pop(&vm->operand_stack);
-				stack_push(&vm->operand_stack, val2 / val1);
-				break;
-			default:
-				assert(0);
-		}
-	}
-quit:
-	while(vm->call_stack.sp) {
-		VM_CallFrame* cf = (VM_CallFrame*) stack_pop(&vm->call_stack);
-		cf_destroy(cf);
-	}
-	return 0;
-}
+#ifdef VM_THREADED_DISPATCH
+typedef struct {
+	const void* handler;
+	int64_t val;
+} VM_ThreadedInstruction;
+#endif
+
+#include "vm_loop.h"
+
+#define VM_LOOP_PACKED
+#include "vm_loop.h"
+#undef VM_LOOP_PACKED
+
+#ifndef SILK_NO_PROFILE
+#define VM_LOOP_PROFILE
+#include "vm_loop.h"
+#undef VM_LOOP_PROFILE
+#endif
@@ -3,23 +3,92 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <silk.h>
 #include "instruction.h"
+#include "bytecode.h"
+#include "profile.h"
 
+// Each stack is a mapping of its own with a guard page after it. A run
+// may use capacity entries, which vm_reserve sets from the ctx's budget;
+// mapped is how many the mapping holds.
 typedef struct {
 	int64_t* data;
 	size_t capacity;
+	size_t mapped;
 	size_t sp;
 } VM_Stack;
 
 typedef struct {
+	int64_t* locals;
+	const FunctionInfo* fun;
+	size_t ret_addr;
+} VM_CallFrame;
+
+// Frames live in one preallocated array and each frame's locals are a
+// window into a shared slot array, sized exactly to the function's
+// FunctionInfo::n_locals, so calls and returns never allocate.
+typedef struct {
+	VM_CallFrame* frames;
+	size_t capacity;
+	size_t mapped;
+	int64_t* slots;
+	size_t slot_capacity;
+	size_t slots_mapped;
+} VM_FrameStack;
+
+// Silk_VM in the public API
+typedef struct Silk_VM {
 	VM_Stack operand_stack;
-	VM_Stack call_stack;
-	size_t table_capacity;
+	VM_FrameStack call_stack;
+	// Scratch for the code as threaded dispatch translates it, kept
+	// between runs
+	void* translated;
+	size_t translated_capacity;
+	// Machine stack the JIT's code runs on, from vm_reserve_native
+	void* native_stack;
+	size_t native_mapped;
+	// Set when vm_run stopped at a call to a function with no code yet.
+	// The next vm_run picks up at that call.
+	char stopped;
+	size_t stop_pc;
+	size_t stop_frame;
+	size_t missing;
 } VM;
 
-int vm_init(VM* vm, size_t stack_capacity, size_t table_capacity);
+// vm_run's result when it stops at the call to function vm->missing
+#define VM_MISSING_FUNCTION 2
+// A call went deeper than the budget vm_reserve was given. Calls are
+// checked, pushes aren't: a call makes sure the callee's locals and
+// FunctionInfo::max_stack values fit.
+#define VM_STACK_OVERFLOW 3
+
+// Starts with empty stacks, vm_reserve maps them
+void vm_init(VM* vm);
 void vm_deinit(VM* vm);
+// Sizes the stacks for code whose top level needs top_stack values on
+// top of what's on the operand stack and top_locals globals, plus ctx's
+// stack_size and call_depth for everything it calls. Mappings only ever
+// grow, keeping the operand stack and the globals, so one VM can run
+// code as it gets compiled or one program after another.
+int vm_reserve(VM* vm, const Silk_Ctx* ctx, size_t top_stack, size_t top_locals);
+// Maps a machine stack deep enough for every call the budget allows,
+// two words a call, and points top at its end. It has guard pages on
+// both sides.
+int vm_reserve_native(VM* vm, void** top);
+// Empties the operand stack and forgets where a run stopped, so the next
+// run starts from the top. Nothing gets freed.
+void vm_reset(VM* vm);
 
-int vm_run(VM* vm, Instruction* instructions, size_t inst_size);
+// Calls to FUNCTION_UNCOMPILED functions stop the VM with
+// VM_MISSING_FUNCTION. Once the function has code, run again with the
+// same function table to carry on.
+int vm_run(VM* vm, Instruction* instructions, size_t inst_size,
+	FunctionInfo* functions, size_t n_functions);
+int vm_run_packed(VM* vm, PackedCode* packed, FunctionInfo* functions, size_t n_functions);
+#ifndef SILK_NO_PROFILE
+// Same as vm_run, with every dispatch, call and return recorded in prof
+int vm_run_profiled(VM* vm, Instruction* instructions, size_t inst_size,
+	FunctionInfo* functions, size_t n_functions, Profile* prof);
+#endif
 
 #endif
@@ -0,0 +1,312 @@
+// Body of the interpreter loop. vm.c includes this once per code
+// format: plain Instruction arrays, and the packed byte stream when
+// VM_LOOP_PACKED is defined. VM_LOOP_PROFILE builds an Instruction loop
+// with the profiling hooks; in every other copy they expand to nothing.
+
+#ifdef VM_LOOP_PACKED
+int vm_run_packed(VM* vm, PackedCode* packed, FunctionInfo* functions, size_t n_functions) {
+#elif defined(VM_LOOP_PROFILE)
+int vm_run_profiled(VM* vm, Instruction* instructions, size_t inst_size,
+	FunctionInfo* functions, size_t n_functions, Profile* prof) {
+#else
+int vm_run(VM* vm, Instruction* instructions, size_t inst_size,
+	FunctionInfo* functions, size_t n_functions) {
+#endif
+#ifdef VM_THREADED_DISPATCH
+	static const void* const handlers[] = {
+#define HANDLER(inst) &&do_##inst,
+		FOR_EACH_INSTRUCTION(HANDLER)
+#undef HANDLER
+	};
+#define CASE(inst) do_##inst
+#define SWITCH_BEGIN
+#define SWITCH_END
+#else
+#define CASE(inst) case inst
+#define SWITCH_END \
+			default: \
+				assert(0); \
+		}
+#endif
+
+#ifdef VM_LOOP_PROFILE
+#define PROFILE_OP(index) \
+	do { \
+		if((index) < inst_size) \
+			profile_op(prof, instructions[index].type); \
+	} while(0)
+#define PROFILE_CALL(index) profile_call(prof, index)
+#define PROFILE_RET() profile_ret(prof)
+#define PROFILE_EXIT() profile_finish(prof)
+#else
+#define PROFILE_OP(index)
+#define PROFILE_CALL(index)
+#define PROFILE_RET()
+#define PROFILE_EXIT()
+#endif
+
+#if defined(VM_LOOP_PACKED) || defined(VM_LOOP_PROFILE)
+#define CHECK_COMPILED(index)
+#else
+#define CHECK_COMPILED(index) \
+	do { \
+		if(functions[index].start_addr == FUNCTION_UNCOMPILED) { \
+			vm->missing = (index); \
+			goto stop; \
+		} \
+	} while(0)
+#endif
+
+#if defined(VM_LOOP_PACKED)
+	// Operands are decoded as each instruction is dispatched. The packed
+	// stream ends in an INST_EXIT, so running off the end needs no check.
+	const uint8_t* code = packed->code;
+	const uint8_t* pc = code;
+	const uint8_t* next;
+	int64_t val;
+#define VAL val
+#define RET_ADDR ((size_t) (next - code))
+#define ENTRY(index) packed->entries[index]
+#define NEXT() do { pc = next; DISPATCH(); } while(0)
+#ifdef VM_THREADED_DISPATCH
+#define DISPATCH() \
+	do { \
+		next = bytecode_decode(pc, &val); \
+		assert((*pc & BYTECODE_OPCODE_MASK) < sizeof(handlers) / sizeof(handlers[0])); \
+		goto *handlers[*pc & BYTECODE_OPCODE_MASK]; \
+	} while(0)
+#else
+#define DISPATCH() goto dispatch
+#define SWITCH_BEGIN \
+	dispatch: \
+		next = bytecode_decode(pc, &val); \
+		switch(*pc & BYTECODE_OPCODE_MASK) {
+#endif
+#elif defined(VM_THREADED_DISPATCH)
+	// Translate the instruction stream into handler addresses once, so
+	// dispatch is a single indirect jump. The trailing entry catches
+	// execution running off the end of the code.
+	if(vm->translated_capacity < inst_size + 1) {
+		void* translated = realloc(vm->translated, sizeof(VM_ThreadedInstruction) * (inst_size + 1));
+		if(!translated)
+			return 1;
+		vm->translated = translated;
+		vm->translated_capacity = inst_size + 1;
+	}
+	VM_ThreadedInstruction* code = vm->translated;
+	for(size_t i = 0; i < inst_size; ++i) {
+		assert(instructions[i].type < sizeof(handlers) / sizeof(handlers[0]));
+		code[i].handler = handlers[instructions[i].type];
+		code[i].val = instructions[i].val;
+	}
+	code[inst_size].handler = &&quit;
+
+	VM_ThreadedInstruction* pc = code;
+#define VAL pc->val
+#define RET_ADDR ((size_t) (pc - code + 1))
+#define ENTRY(index) functions[index].start_addr
+#define NEXT() do { ++pc; DISPATCH(); } while(0)
+#define DISPATCH() do { PROFILE_OP((size_t) (pc - code)); goto *pc->handler; } while(0)
+#else
+	Instruction* code = instructions;
+	Instruction* pc = code;
+#define VAL pc->val
+#define RET_ADDR ((size_t) (pc - code + 1))
+#define ENTRY(index) functions[index].start_addr
+#define NEXT() do { ++pc; DISPATCH(); } while(0)
+#define DISPATCH() goto dispatch
+#define SWITCH_BEGIN \
+	dispatch: \
+		if(pc >= code + inst_size) \
+			goto quit; \
+		PROFILE_OP((size_t) (pc - code)); \
+		switch(pc->type) {
+#endif
+
+#define PUSH(val) do { assert(sp < sp_begin + vm->operand_stack.capacity); *sp++ = (val); } while(0)
+#define POP() (assert(sp > sp_begin), *--sp)
+#define TOP() (assert(sp > sp_begin), sp[-1])
+#define LOCAL(frame, i) (frame)->locals[(assert((size_t) (i) < (frame)->fun->n_locals), (i))]
+
+	assert(n_functions);
+	(void) n_functions;
+	VM_CallFrame* global_cf = vm->call_stack.frames;
+	global_cf->locals = vm->call_stack.slots;
+	global_cf->fun = &functions[0];
+	global_cf->ret_addr = 0;
+	VM_CallFrame* cf = global_cf;
+	assert(global_cf->fun->n_locals <= vm->call_stack.slot_capacity);
+
+	int64_t* sp_begin = vm->operand_stack.data;
+	int64_t* sp = sp_begin + vm->operand_stack.sp;
+	// Where the budget vm_reserve set runs out
+	const VM_CallFrame* frames_end = vm->call_stack.frames + vm->call_stack.capacity;
+	const int64_t* slots_end = vm->call_stack.slots + vm->call_stack.slot_capacity;
+	const int64_t* sp_end = sp_begin + vm->operand_stack.capacity;
+
+	int64_t val1;
+	int64_t val2;
+
+#if !defined(VM_LOOP_PACKED) && !defined(VM_LOOP_PROFILE)
+	if(vm->stopped) {
+		// Retry the call that stopped the last run
+		vm->stopped = 0;
+		pc = code + vm->stop_pc;
+		cf = global_cf + vm->stop_frame;
+		DISPATCH();
+	}
+#endif
+	assert(sp + global_cf->fun->max_stack <= sp_end);
+
+	// Entry 0 is the top level. It starts the code unless the code was
+	// compiled a piece at a time.
+	pc = code + ENTRY(0);
+	PROFILE_CALL(0);
+	DISPATCH();
+	SWITCH_BEGIN
+	CASE(INST_PUSH):
+		PUSH(VAL);
+		NEXT();
+	CASE(INST_POP):
+		(void) POP();
+		NEXT();
+	CASE(INST_SWAP): {
+		assert(sp - sp_begin > VAL);
+		val1 = sp[-1];
+		sp[-1] = sp[-1 - VAL];
+		sp[-1 - VAL] = val1;
+		NEXT();
+	}
+	CASE(INST_LOAD):
+		PUSH(LOCAL(cf, VAL));
+		NEXT();
+	CASE(INST_LOAD_GLOBAL):
+		PUSH(LOCAL(global_cf, VAL));
+		NEXT();
+	CASE(INST_STORE):
+		LOCAL(cf, VAL) = POP();
+		NEXT();
+	CASE(INST_STORE_GLOBAL):
+		LOCAL(global_cf, VAL) = POP();
+		NEXT();
+	CASE(INST_EXIT):
+		goto quit;
+	CASE(INST_CALL): {
+		assert((size_t) VAL < n_functions);
+		CHECK_COMPILED((size_t) VAL);
+		const FunctionInfo* callee = &functions[VAL];
+		int64_t* locals = cf->locals + cf->fun->n_locals;
+		// Everything the callee pushes fits in its max_stack, so this is
+		// the only place that checks
+		if(cf + 1 == frames_end || locals + callee->n_locals > slots_end ||
+			sp + callee->max_stack > sp_end)
+			goto overflow;
+		++cf;
+		cf->locals = locals;
+		cf->fun = callee;
+		cf->ret_addr = RET_ADDR;
+		PROFILE_CALL((size_t) VAL);
+		pc = code + ENTRY(VAL);
+		DISPATCH();
+	}
+	CASE(INST_TAILCALL): {
+		// Nothing in the current frame is live after a call in tail
+		// position, so the callee takes it over and returns straight to
+		// the caller's caller
+		assert((size_t) VAL < n_functions);
+		CHECK_COMPILED((size_t) VAL);
+		const FunctionInfo* callee = &functions[VAL];
+		assert(cf > global_cf);
+		if(cf->locals + callee->n_locals > slots_end || sp + callee->max_stack > sp_end)
+			goto overflow;
+		cf->fun = callee;
+		PROFILE_RET();
+		PROFILE_CALL((size_t) VAL);
+		pc = code + ENTRY(VAL);
+		DISPATCH();
+	}
+	CASE(INST_RET):
+		assert(cf > global_cf);
+		pc = code + cf->ret_addr;
+		--cf;
+		PROFILE_RET();
+		DISPATCH();
+	CASE(INST_SUM):
+		val1 = POP();
+		val2 = TOP();
+		sp[-1] = val2 + val1;
+		NEXT();
+	CASE(INST_SUB):
+		val1 = POP();
+		val2 = TOP();
+		sp[-1] = val2 - val1;
+		NEXT();
+	CASE(INST_MUL):
+		val1 = POP();
+		val2 = TOP();
+		sp[-1] = val2 * val1;
+		NEXT();
+	CASE(INST_DIV):
+		val1 = POP();
+		val2 = TOP();
+		sp[-1] = val2 / val1;
+		NEXT();
+	CASE(INST_ADD_IMM):
+		sp[-1] = TOP() + VAL;
+		NEXT();
+	CASE(INST_SUB_IMM):
+		sp[-1] = TOP() - VAL;
+		NEXT();
+	CASE(INST_MUL_IMM):
+		sp[-1] = TOP() * VAL;
+		NEXT();
+	CASE(INST_DIV_IMM):
+		sp[-1] = TOP() / VAL;
+		NEXT();
+	CASE(INST_STORE_KEEP):
+		LOCAL(cf, VAL) = TOP();
+		NEXT();
+	CASE(INST_STORE_GLOBAL_KEEP):
+		LOCAL(global_cf, VAL) = TOP();
+		NEXT();
+	CASE(INST_LOAD_LOAD):
+		PUSH(LOCAL(cf, (uint64_t) VAL & 0xffff));
+		PUSH(LOCAL(cf, (uint64_t) VAL >> 16));
+		NEXT();
+	SWITCH_END
+
+#undef LOCAL
+#undef TOP
+#undef POP
+#undef PUSH
+#undef DISPATCH
+#undef NEXT
+#undef ENTRY
+#undef RET_ADDR
+#undef VAL
+#undef SWITCH_END
+#undef SWITCH_BEGIN
+#undef CASE
+
+#if !defined(VM_LOOP_PACKED) && !defined(VM_LOOP_PROFILE)
+	goto quit;
+stop:
+	vm->stopped = 1;
+	vm->stop_pc = pc - code;
+	vm->stop_frame = cf - global_cf;
+#endif
+quit:
+	PROFILE_EXIT();
+	vm->operand_stack.sp = sp - sp_begin;
+	return vm->stopped ? VM_MISSING_FUNCTION : 0;
+overflow:
+	PROFILE_EXIT();
+	vm->operand_stack.sp = sp - sp_begin;
+	return VM_STACK_OVERFLOW;
+}
+
+#undef CHECK_COMPILED
+#undef PROFILE_EXIT
+#undef PROFILE_RET
+#undef PROFILE_CALL
+#undef PROFILE_OP